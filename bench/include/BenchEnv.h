@@ -0,0 +1,50 @@
+#ifndef BenchEnv_H
+#define BenchEnv_H
+/******************************************************************************/
+/* devtools-bench  -  benchmark environment                                   */
+/******************************************************************************/
+/** @file  BenchEnv.h
+  * @brief Shared generator instance and helpers to run the tool executables
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "BenchGenerator.h"
+
+#include "benchmark/benchmark.h"
+
+#include <string>
+
+/**
+ * @brief environment shared by all benchmarks
+*/
+class BenchEnv
+{
+public:
+  /**
+   * @brief get the generator writing into the benchmark data directory
+   * @return BenchGenerator reference
+  */
+  static BenchGenerator& GetGenerator();
+  /**
+   * @brief run a tool executable, the benchmark is skipped with an error if it fails
+   * @param state benchmark state
+   * @param cmd command line
+   * @param maxExitCode highest exit code accepted as success (tools report warnings with exit code 1)
+   * @return true if the tool exit code does not exceed maxExitCode
+  */
+  static bool RunTool(benchmark::State& state, const std::string& cmd, int maxExitCode = 0);
+  /**
+   * @brief quote a path for a command line
+   * @param path file or directory name
+   * @return quoted path
+  */
+  static std::string Quote(const std::string& path);
+};
+
+#endif // BenchEnv_H
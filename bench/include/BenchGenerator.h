@@ -0,0 +1,120 @@
+#ifndef BenchGenerator_H
+#define BenchGenerator_H
+/******************************************************************************/
+/* devtools-bench  -  synthetic input generator                               */
+/******************************************************************************/
+/** @file  BenchGenerator.h
+  * @brief Deterministic generator for synthetic packs, solutions and SVD files
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <string>
+
+/**
+ * @brief size of a synthetic pack: N devices x M components x K conditions x F files per component
+*/
+struct BenchPackParams {
+  unsigned devices = 8;
+  unsigned components = 64;
+  unsigned conditions = 16;
+  unsigned files = 4;
+};
+
+/**
+ * @brief size of a synthetic solution: C contexts (target types) x L layers per project
+*/
+struct BenchSolutionParams {
+  unsigned contexts = 4;
+  unsigned layers = 2;
+};
+
+/**
+ * @brief size of a synthetic SVD file: P peripherals (every fourth one is a dim array) x R registers
+*/
+struct BenchSvdParams {
+  unsigned peripherals = 64;
+  unsigned registers = 16;
+};
+
+/**
+ * @brief Writes synthetic inputs below a root directory. The content depends only on the parameters,
+ *        so results of different runs and commits are comparable. Files are named after their parameters
+ *        and are only rewritten if their content changed, so repeated runs reuse the generated trees.
+*/
+class BenchGenerator
+{
+public:
+  /**
+   * @brief constructor
+   * @param rootDir directory receiving the generated files
+  */
+  BenchGenerator(const std::string& rootDir);
+
+  /**
+   * @brief get root directory
+   * @return absolute root directory
+  */
+  const std::string& GetRootDir() const { return m_rootDir; }
+  /**
+   * @brief get pack root directory in CMSIS_PACK_ROOT layout
+   * @return directory holding generated packs as <vendor>/<name>/<version>
+  */
+  std::string GetPackRoot() const;
+
+  /**
+   * @brief get name of the pack generated for given parameters
+   * @param params pack size
+   * @return pack name
+  */
+  static std::string GetPackName(const BenchPackParams& params);
+  /**
+   * @brief get name of a generated device
+   * @param index device index
+   * @return device name
+  */
+  static std::string GetDeviceName(unsigned index);
+  /**
+   * @brief get component ID in csolution notation
+   * @param params pack size
+   * @param index component index
+   * @return component ID as 'ARM::Bench:<Cgroup>:<Csub>'
+  */
+  static std::string GetComponentId(const BenchPackParams& params, unsigned index);
+
+  /**
+   * @brief generate a pack with pdsc, files referenced by components and license
+   * @param params pack size
+   * @return absolute pdsc file name, empty string on error
+  */
+  std::string GeneratePack(const BenchPackParams& params);
+  /**
+   * @brief generate a csolution with one project and layers selecting all components of a pack
+   * @param params solution size
+   * @param pack pack providing devices and components, generated if missing
+   * @return absolute csolution file name, empty string on error
+  */
+  std::string GenerateSolution(const BenchSolutionParams& params, const BenchPackParams& pack);
+  /**
+   * @brief generate an SVD file
+   * @param params SVD size
+   * @return absolute SVD file name, empty string on error
+  */
+  std::string GenerateSvd(const BenchSvdParams& params);
+
+protected:
+  static std::string GetGroupName(const BenchPackParams& params, unsigned index);
+  static std::string CreatePdsc(const BenchPackParams& params);
+  static std::string CreateSvd(const BenchSvdParams& params);
+  bool WriteFile(const std::string& fileName, const std::string& content);
+
+private:
+  std::string m_rootDir;
+};
+
+#endif // BenchGenerator_H
@@ -0,0 +1,338 @@
+/******************************************************************************/
+/* devtools-bench  -  synthetic input generator                               */
+/******************************************************************************/
+/** @file  BenchGenerator.cpp
+  * @brief Deterministic generator for synthetic packs, solutions and SVD files
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "BenchGenerator.h"
+
+#include "RteFileWriter.h"
+#include "RteFsUtils.h"
+#include "RteUtils.h"
+
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+static constexpr const char* PACK_VENDOR  = "ARM";
+static constexpr const char* PACK_VERSION = "1.0.0";
+static constexpr unsigned    SVD_DIM      = 4;     // elements of peripheral and cluster arrays
+static constexpr unsigned    SVD_FIELDS   = 4;     // fields per register
+
+// svdconv expects the device name to match the file name
+static string GetSvdDeviceName(const BenchSvdParams& params)
+{
+  return "BenchP" + to_string(params.peripherals) + "R" + to_string(params.registers);
+}
+
+BenchGenerator::BenchGenerator(const string& rootDir) :
+  m_rootDir(RteFsUtils::AbsolutePath(rootDir).generic_string())
+{
+}
+
+string BenchGenerator::GetPackRoot() const
+{
+  return m_rootDir + "/packs";
+}
+
+string BenchGenerator::GetPackName(const BenchPackParams& params)
+{
+  return "BenchD" + to_string(params.devices) + "C" + to_string(params.components) +
+    "K" + to_string(params.conditions) + "F" + to_string(params.files);
+}
+
+string BenchGenerator::GetDeviceName(unsigned index)
+{
+  return "BenchDevice_" + to_string(index);
+}
+
+string BenchGenerator::GetGroupName(const BenchPackParams& params, unsigned index)
+{
+  const unsigned groups = params.components > 4 ? params.components / 4 : 1;
+  return "G" + to_string(index % groups);
+}
+
+string BenchGenerator::GetComponentId(const BenchPackParams& params, unsigned index)
+{
+  return string(PACK_VENDOR) + "::Bench:" + GetGroupName(params, index) + ":S" + to_string(index);
+}
+
+bool BenchGenerator::WriteFile(const string& fileName, const string& content)
+{
+  // unchanged files are not touched: repeated runs only compare content
+  return RteFileWriter::WriteFile(fileName, content);
+}
+
+string BenchGenerator::CreatePdsc(const BenchPackParams& params)
+{
+  const unsigned groups = params.components > 4 ? params.components / 4 : 1;
+  ostringstream pdsc;
+  pdsc << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+  pdsc << "<package schemaVersion=\"1.7.7\" xmlns:xs=\"http://www.w3.org/2001/XMLSchema-instance\" xs:noNamespaceSchemaLocation=\"PACK.xsd\">\n";
+  pdsc << "  <name>" << GetPackName(params) << "</name>\n";
+  pdsc << "  <description>Synthetic pack for benchmarks</description>\n";
+  pdsc << "  <vendor>" << PACK_VENDOR << "</vendor>\n";
+  pdsc << "  <url>http://www.keil.com/pack/</url>\n";
+  pdsc << "  <license>LICENSE.txt</license>\n";
+  pdsc << "  <releases>\n";
+  pdsc << "    <release version=\"" << PACK_VERSION << "\" date=\"2024-01-01\">Generated</release>\n";
+  pdsc << "  </releases>\n";
+
+  // conditions form a tree: each one refers to its parent, to one component and optionally to the toolchain
+  pdsc << "  <conditions>\n";
+  for (unsigned k = 0; k < params.conditions; k++) {
+    pdsc << "    <condition id=\"Cond " << k << "\">\n";
+    pdsc << "      <description>Condition " << k << "</description>\n";
+    pdsc << "      <require Dvendor=\"ARM:82\"/>\n";
+    if (k % 3 == 0) {
+      pdsc << "      <require Dname=\"BenchDevice_*\"/>\n";
+    }
+    if (k % 2 == 1) {
+      pdsc << "      <accept Tcompiler=\"GCC\"/>\n";
+      pdsc << "      <accept Tcompiler=\"ARMCC\"/>\n";
+    }
+    if (groups > 1) {
+      const unsigned required = (k + 1) % groups;
+      pdsc << "      <require Cclass=\"Bench\" Cgroup=\"G" << required << "\" Csub=\"S" << required << "\"/>\n";
+    }
+    if (k > 0) {
+      pdsc << "      <require condition=\"Cond " << (k - 1) / 2 << "\"/>\n";
+    }
+    pdsc << "    </condition>\n";
+  }
+  pdsc << "  </conditions>\n";
+
+  pdsc << "  <devices>\n";
+  pdsc << "    <family Dfamily=\"Bench Family\" Dvendor=\"ARM:82\">\n";
+  pdsc << "      <processor Dcore=\"Cortex-M4\" DcoreVersion=\"r0p1\" Dfpu=\"SP_FPU\" Dmpu=\"MPU\" Dendian=\"Little-endian\" Dclock=\"100000000\"/>\n";
+  pdsc << "      <description>Synthetic device family</description>\n";
+  for (unsigned d = 0; d < params.devices; d++) {
+    pdsc << "      <device Dname=\"" << GetDeviceName(d) << "\">\n";
+    pdsc << "        <memory name=\"IROM1\" access=\"rx\" start=\"0x00000000\" size=\"0x40000\" startup=\"1\" default=\"1\"/>\n";
+    pdsc << "        <memory name=\"IRAM1\" access=\"rw\" start=\"0x20000000\" size=\"0x20000\" default=\"1\"/>\n";
+    pdsc << "      </device>\n";
+  }
+  pdsc << "    </family>\n";
+  pdsc << "  </devices>\n";
+
+  pdsc << "  <components>\n";
+  for (unsigned c = 0; c < params.components; c++) {
+    pdsc << "    <component Cclass=\"Bench\" Cgroup=\"" << GetGroupName(params, c) << "\" Csub=\"S" << c << "\" Cversion=\"1.0.0\"";
+    if (params.conditions > 0) {
+      pdsc << " condition=\"Cond " << c % params.conditions << "\"";
+    }
+    pdsc << ">\n";
+    pdsc << "      <description>Component " << c << "</description>\n";
+    pdsc << "      <files>\n";
+    for (unsigned f = 0; f < params.files; f++) {
+      if (f == 0) {
+        pdsc << "        <file category=\"header\" name=\"Include/c" << c << ".h\"/>\n";
+      } else {
+        pdsc << "        <file category=\"sourceC\" name=\"Source/c" << c << "_" << f << ".c\"/>\n";
+      }
+    }
+    pdsc << "      </files>\n";
+    pdsc << "    </component>\n";
+  }
+  pdsc << "  </components>\n";
+  pdsc << "</package>\n";
+  return pdsc.str();
+}
+
+string BenchGenerator::GeneratePack(const BenchPackParams& params)
+{
+  const string& name = GetPackName(params);
+  const string packDir = GetPackRoot() + '/' + PACK_VENDOR + '/' + name + '/' + PACK_VERSION;
+  const string pdscFile = packDir + '/' + PACK_VENDOR + '.' + name + ".pdsc";
+
+  if (!WriteFile(pdscFile, CreatePdsc(params)) ||
+      !WriteFile(packDir + "/LICENSE.txt", "Synthetic pack for benchmarks\n")) {
+    return RteUtils::EMPTY_STRING;
+  }
+  for (unsigned c = 0; c < params.components; c++) {
+    for (unsigned f = 0; f < params.files; f++) {
+      const string& file = (f == 0) ?
+        packDir + "/Include/c" + to_string(c) + ".h" :
+        packDir + "/Source/c" + to_string(c) + "_" + to_string(f) + ".c";
+      if (!WriteFile(file, "/* component " + to_string(c) + " file " + to_string(f) + " */\n")) {
+        return RteUtils::EMPTY_STRING;
+      }
+    }
+  }
+  return pdscFile;
+}
+
+string BenchGenerator::GenerateSolution(const BenchSolutionParams& params, const BenchPackParams& pack)
+{
+  if (GeneratePack(pack).empty()) {
+    return RteUtils::EMPTY_STRING;
+  }
+  const string solutionDir = m_rootDir + "/solutions/" + GetPackName(pack) +
+    "C" + to_string(params.contexts) + "L" + to_string(params.layers);
+
+  // components are distributed round robin over the project and its layers
+  const unsigned buckets = params.layers + 1;
+  vector<ostringstream> componentLists(buckets);
+  for (unsigned c = 0; c < pack.components; c++) {
+    componentLists[c % buckets] << "    - component: " << GetComponentId(pack, c) << "\n";
+  }
+
+  ostringstream csolution;
+  csolution << "solution:\n";
+  csolution << "  compiler: GCC\n";
+  csolution << "  packs:\n";
+  csolution << "    - pack: " << PACK_VENDOR << "::" << GetPackName(pack) << "\n";
+  csolution << "  target-types:\n";
+  for (unsigned t = 0; t < params.contexts; t++) {
+    csolution << "    - type: T" << t << "\n";
+    csolution << "      device: " << PACK_VENDOR << "::" << GetDeviceName(t % (pack.devices ? pack.devices : 1)) << "\n";
+  }
+  csolution << "  projects:\n";
+  csolution << "    - project: bench.cproject.yml\n";
+
+  ostringstream cproject;
+  cproject << "project:\n";
+  cproject << "  components:\n";
+  cproject << componentLists[0].str();
+  if (params.layers > 0) {
+    cproject << "  layers:\n";
+    for (unsigned l = 0; l < params.layers; l++) {
+      cproject << "    - layer: layer" << l << ".clayer.yml\n";
+    }
+  }
+
+  for (unsigned l = 0; l < params.layers; l++) {
+    const string& clayer = "layer:\n  components:\n" + componentLists[l + 1].str();
+    if (!WriteFile(solutionDir + "/layer" + to_string(l) + ".clayer.yml", clayer)) {
+      return RteUtils::EMPTY_STRING;
+    }
+  }
+  const string csolutionFile = solutionDir + "/bench.csolution.yml";
+  if (!WriteFile(solutionDir + "/bench.cproject.yml", cproject.str()) ||
+      !WriteFile(csolutionFile, csolution.str())) {
+    return RteUtils::EMPTY_STRING;
+  }
+  return csolutionFile;
+}
+
+string BenchGenerator::CreateSvd(const BenchSvdParams& params)
+{
+  ostringstream svd;
+  svd << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+  svd << "<device schemaVersion=\"1.3\" xmlns:xs=\"http://www.w3.org/2001/XMLSchema-instance\" xs:noNamespaceSchemaLocation=\"CMSIS-SVD.xsd\">\n";
+  svd << "  <vendor>ARM Ltd.</vendor>\n";
+  svd << "  <vendorID>ARM</vendorID>\n";
+  svd << "  <name>" << GetSvdDeviceName(params) << "</name>\n";
+  svd << "  <series>Bench</series>\n";
+  svd << "  <version>1.0</version>\n";
+  svd << "  <description>Synthetic device for benchmarks</description>\n";
+  svd << "  <cpu>\n";
+  svd << "    <name>CM4</name>\n";
+  svd << "    <revision>r0p1</revision>\n";
+  svd << "    <endian>little</endian>\n";
+  svd << "    <mpuPresent>true</mpuPresent>\n";
+  svd << "    <fpuPresent>true</fpuPresent>\n";
+  svd << "    <nvicPrioBits>3</nvicPrioBits>\n";
+  svd << "    <vendorSystickConfig>false</vendorSystickConfig>\n";
+  svd << "  </cpu>\n";
+  svd << "  <addressUnitBits>8</addressUnitBits>\n";
+  svd << "  <width>32</width>\n";
+  svd << "  <size>32</size>\n";
+  svd << "  <access>read-write</access>\n";
+  svd << "  <resetValue>0x00000000</resetValue>\n";
+  svd << "  <resetMask>0xFFFFFFFF</resetMask>\n";
+  svd << "  <peripherals>\n";
+
+  for (unsigned p = 0; p < params.peripherals; p++) {
+    const bool isArray = (p % 4 == 3);
+    const string name = (isArray ? "ARR" : "PER") + to_string(p);
+    svd << "    <peripheral>\n";
+    if (isArray) {
+      svd << "      <dim>" << SVD_DIM << "</dim>\n";
+      svd << "      <dimIncrement>0x1000</dimIncrement>\n";
+      svd << "      <name>" << name << "[%s]</name>\n";
+    } else {
+      svd << "      <name>" << name << "</name>\n";
+    }
+    svd << "      <description>Peripheral " << p << "</description>\n";
+    svd << "      <groupName>" << name << "</groupName>\n";
+    svd << "      <baseAddress>0x" << hex << 0x40000000 + p * 0x10000 << dec << "</baseAddress>\n";
+    svd << "      <addressBlock>\n";
+    svd << "        <offset>0</offset>\n";
+    svd << "        <size>0x1000</size>\n";
+    svd << "        <usage>registers</usage>\n";
+    svd << "      </addressBlock>\n";
+    if (!isArray && p < 240) {
+      svd << "      <interrupt>\n";
+      svd << "        <name>" << name << "</name>\n";
+      svd << "        <description>" << name << " interrupt</description>\n";
+      svd << "        <value>" << p << "</value>\n";
+      svd << "      </interrupt>\n";
+    }
+    svd << "      <registers>\n";
+    for (unsigned r = 0; r < params.registers; r++) {
+      svd << "        <register>\n";
+      svd << "          <name>REG" << r << "</name>\n";
+      svd << "          <description>Register " << r << "</description>\n";
+      svd << "          <addressOffset>0x" << hex << r * 4 << dec << "</addressOffset>\n";
+      svd << "          <fields>\n";
+      for (unsigned f = 0; f < SVD_FIELDS; f++) {
+        svd << "            <field>\n";
+        svd << "              <name>F" << f << "</name>\n";
+        svd << "              <description>Field " << f << "</description>\n";
+        svd << "              <bitOffset>" << f * 8 << "</bitOffset>\n";
+        svd << "              <bitWidth>8</bitWidth>\n";
+        if (f == 0) {
+          svd << "              <enumeratedValues>\n";
+          svd << "                <enumeratedValue><name>OFF</name><description>Off</description><value>0</value></enumeratedValue>\n";
+          svd << "                <enumeratedValue><name>ON</name><description>On</description><value>1</value></enumeratedValue>\n";
+          svd << "              </enumeratedValues>\n";
+        }
+        svd << "            </field>\n";
+      }
+      svd << "          </fields>\n";
+      svd << "        </register>\n";
+    }
+    svd << "        <cluster>\n";
+    svd << "          <dim>" << SVD_DIM << "</dim>\n";
+    svd << "          <dimIncrement>0x10</dimIncrement>\n";
+    svd << "          <name>CH[%s]</name>\n";
+    svd << "          <description>Channel</description>\n";
+    svd << "          <addressOffset>0x" << hex << (params.registers * 4 + 0xF) / 0x10 * 0x10 << dec << "</addressOffset>\n";
+    svd << "          <register>\n";
+    svd << "            <name>CFG</name>\n";
+    svd << "            <description>Channel configuration</description>\n";
+    svd << "            <addressOffset>0</addressOffset>\n";
+    svd << "          </register>\n";
+    svd << "          <register>\n";
+    svd << "            <name>DATA</name>\n";
+    svd << "            <description>Channel data</description>\n";
+    svd << "            <addressOffset>4</addressOffset>\n";
+    svd << "          </register>\n";
+    svd << "        </cluster>\n";
+    svd << "      </registers>\n";
+    svd << "    </peripheral>\n";
+  }
+
+  svd << "  </peripherals>\n";
+  svd << "</device>\n";
+  return svd.str();
+}
+
+string BenchGenerator::GenerateSvd(const BenchSvdParams& params)
+{
+  const string svdFile = m_rootDir + "/svd/" + GetSvdDeviceName(params) + ".svd";
+  if (!WriteFile(svdFile, CreateSvd(params))) {
+    return RteUtils::EMPTY_STRING;
+  }
+  return svdFile;
+}
@@ -0,0 +1,72 @@
+/******************************************************************************/
+/* devtools-bench  -  benchmark environment                                   */
+/******************************************************************************/
+/** @file  BenchMain.cpp
+  * @brief Benchmark entry point
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "BenchEnv.h"
+
+#include "CrossPlatformUtils.h"
+#include "RteUtils.h"
+
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#endif
+
+using namespace std;
+
+BenchGenerator& BenchEnv::GetGenerator()
+{
+  static BenchGenerator generator(BENCH_DATA_DIR);
+  return generator;
+}
+
+string BenchEnv::Quote(const string& path)
+{
+  return '"' + path + '"';
+}
+
+bool BenchEnv::RunTool(benchmark::State& state, const string& cmd, int maxExitCode)
+{
+  const auto& [output, status] = CrossPlatformUtils::ExecCommand(cmd);
+#if defined(_WIN32)
+  const int exitCode = status;
+#else
+  // pclose() returns the wait status
+  const int exitCode = (status >= 0 && WIFEXITED(status)) ? WEXITSTATUS(status) : -1;
+#endif
+  if (exitCode < 0 || exitCode > maxExitCode) {
+    // report the last line, it usually holds the summary or the fatal error
+    const string& text = RteUtils::Trim(output);
+    const string& lastLine = text.substr(text.find_last_of('\n') + 1);
+    state.SkipWithError(("exit code " + to_string(exitCode) + ": " + lastLine).c_str());
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  // stored in the JSON context: reports of different commits can be told apart
+  benchmark::AddCustomContext("git_revision", DEVTOOLS_GIT_REVISION);
+  benchmark::AddCustomContext("bench_data", BenchEnv::GetGenerator().GetRootDir());
+
+  // tool executables started by end-to-end benchmarks find the generated packs
+  CrossPlatformUtils::SetEnv("CMSIS_PACK_ROOT", BenchEnv::GetGenerator().GetPackRoot());
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
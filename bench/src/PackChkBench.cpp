@@ -0,0 +1,45 @@
+/******************************************************************************/
+/* devtools-bench  -  packchk benchmarks                                      */
+/******************************************************************************/
+/** @file  PackChkBench.cpp
+  * @brief packchk end-to-end
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "BenchEnv.h"
+
+using namespace std;
+
+#ifdef PACKCHK_BIN
+// benchmark arguments: devices, components; conditions and files scale with components
+static void BM_PackChk_EndToEnd(benchmark::State& state)
+{
+  BenchPackParams params;
+  params.devices = static_cast<unsigned>(state.range(0));
+  params.components = static_cast<unsigned>(state.range(1));
+  params.conditions = params.components / 4;
+  params.files = 4;
+  const string& pdscFile = BenchEnv::GetGenerator().GeneratePack(params);
+  if (pdscFile.empty()) {
+    state.SkipWithError("cannot generate pack");
+    return;
+  }
+  // schema validation depends on the installed PACK.xsd, not on the code under test
+  const string cmd = BenchEnv::Quote(PACKCHK_BIN) + ' ' + BenchEnv::Quote(pdscFile) + " --disable-validation";
+  for (auto _ : state) {
+    if (!BenchEnv::RunTool(state, cmd, 1)) {
+      break;
+    }
+  }
+  state.counters["devices"] = params.devices;
+  state.counters["components"] = params.components;
+  state.counters["conditions"] = params.conditions;
+}
+BENCHMARK(BM_PackChk_EndToEnd)->Args({ 8, 64 })->Args({ 64, 512 })->Args({ 256, 2048 })->Unit(benchmark::kMillisecond)->UseRealTime();
+#endif
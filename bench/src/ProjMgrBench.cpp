@@ -0,0 +1,87 @@
+/******************************************************************************/
+/* devtools-bench  -  csolution benchmarks                                    */
+/******************************************************************************/
+/** @file  ProjMgrBench.cpp
+  * @brief csolution YAML parsing and convert end-to-end
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "BenchEnv.h"
+
+#include "ProjMgrParser.h"
+
+#include <filesystem>
+
+using namespace std;
+
+namespace {
+
+// benchmark arguments: contexts, layers; the pack has 8 devices and 64 components
+BenchSolutionParams GetSolutionParams(const benchmark::State& state)
+{
+  BenchSolutionParams params;
+  params.contexts = static_cast<unsigned>(state.range(0));
+  params.layers = static_cast<unsigned>(state.range(1));
+  return params;
+}
+
+void SetSolutionCounters(benchmark::State& state, const BenchSolutionParams& params)
+{
+  state.counters["contexts"] = params.contexts;
+  state.counters["layers"] = params.layers;
+}
+
+} // namespace
+
+static void BM_ProjMgr_Parse(benchmark::State& state)
+{
+  const BenchSolutionParams params = GetSolutionParams(state);
+  const string& csolutionFile = BenchEnv::GetGenerator().GenerateSolution(params, BenchPackParams());
+  if (csolutionFile.empty()) {
+    state.SkipWithError("cannot generate solution");
+    return;
+  }
+  const string solutionDir = filesystem::path(csolutionFile).parent_path().generic_string();
+  for (auto _ : state) {
+    ProjMgrParser parser;
+    bool success = parser.ParseCsolution(csolutionFile, false, false) &&
+      parser.ParseCproject(solutionDir + "/bench.cproject.yml", false);
+    for (unsigned l = 0; success && l < params.layers; l++) {
+      success = parser.ParseClayer(solutionDir + "/layer" + to_string(l) + ".clayer.yml", false);
+    }
+    if (!success) {
+      state.SkipWithError("cannot parse solution");
+      break;
+    }
+  }
+  SetSolutionCounters(state, params);
+}
+BENCHMARK(BM_ProjMgr_Parse)->Args({ 4, 2 })->Args({ 16, 8 })->Args({ 64, 32 })->Unit(benchmark::kMillisecond);
+
+#ifdef CSOLUTION_BIN
+static void BM_ProjMgr_Convert(benchmark::State& state)
+{
+  const BenchSolutionParams params = GetSolutionParams(state);
+  const string& csolutionFile = BenchEnv::GetGenerator().GenerateSolution(params, BenchPackParams());
+  if (csolutionFile.empty()) {
+    state.SkipWithError("cannot generate solution");
+    return;
+  }
+  const string outDir = filesystem::path(csolutionFile).parent_path().generic_string() + "/out";
+  const string cmd = BenchEnv::Quote(CSOLUTION_BIN) + " convert " + BenchEnv::Quote(csolutionFile) +
+    " --no-check-schema --quiet -o " + BenchEnv::Quote(outDir);
+  for (auto _ : state) {
+    if (!BenchEnv::RunTool(state, cmd)) {
+      break;
+    }
+  }
+  SetSolutionCounters(state, params);
+}
+BENCHMARK(BM_ProjMgr_Convert)->Args({ 4, 2 })->Args({ 16, 8 })->Args({ 64, 32 })->Unit(benchmark::kMillisecond)->UseRealTime();
+#endif
@@ -0,0 +1,165 @@
+/******************************************************************************/
+/* devtools-bench  -  RTE model benchmarks                                    */
+/******************************************************************************/
+/** @file  RteModelBench.cpp
+  * @brief Pack loading, component filtering and dependency resolution
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "BenchEnv.h"
+
+#include "RteCondition.h"
+#include "RteKernelSlim.h"
+#include "RteModel.h"
+#include "RteProject.h"
+#include "RteTarget.h"
+#include "RteUtils.h"
+
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+// benchmark arguments: devices, components; conditions and files scale with components
+BenchPackParams GetPackParams(const benchmark::State& state)
+{
+  BenchPackParams params;
+  params.devices = static_cast<unsigned>(state.range(0));
+  params.components = static_cast<unsigned>(state.range(1));
+  params.conditions = params.components / 4;
+  params.files = 4;
+  return params;
+}
+
+void SetPackCounters(benchmark::State& state, const BenchPackParams& params)
+{
+  state.counters["devices"] = params.devices;
+  state.counters["components"] = params.components;
+  state.counters["conditions"] = params.conditions;
+}
+
+/**
+ * @brief kernel with a loaded pack and an active target, as csolution sets it up for a context
+*/
+class BenchModel
+{
+public:
+  BenchModel(const string& pdscFile)
+  {
+    list<string> files = { pdscFile };
+    list<RtePackage*> packs;
+    m_kernel.LoadPacks(files, packs);
+    m_kernel.GetGlobalModel()->InsertPacks(packs);
+
+    // RteGlobalModel takes the RteProject ownership
+    RteProject* project = make_unique<RteProject>().release();
+    m_kernel.GetGlobalModel()->AddProject(0, project);
+    m_kernel.GetGlobalModel()->SetActiveProjectId(project->GetProjectId());
+    project->AddTarget("Bench", GetTargetAttributes(0), true, true);
+    project->SetActiveTarget("Bench");
+    m_target = project->GetActiveTarget();
+  }
+
+  RteTarget* GetTarget() const { return m_target; }
+
+  static map<string, string> GetTargetAttributes(unsigned device)
+  {
+    return {
+      { "Dname",     BenchGenerator::GetDeviceName(device) },
+      { "Dvendor",   "ARM:82" },
+      { "Dcore",     "Cortex-M4" },
+      { "Dfpu",      "SP_FPU" },
+      { "Dmpu",      "MPU" },
+      { "Dendian",   "Little-endian" },
+      { "Tcompiler", "GCC" },
+    };
+  }
+
+private:
+  RteKernelSlim m_kernel;
+  RteTarget*    m_target = nullptr;
+};
+
+} // namespace
+
+static void BM_RteModel_LoadPacks(benchmark::State& state)
+{
+  const BenchPackParams params = GetPackParams(state);
+  const string& pdscFile = BenchEnv::GetGenerator().GeneratePack(params);
+  if (pdscFile.empty()) {
+    state.SkipWithError("cannot generate pack");
+    return;
+  }
+  for (auto _ : state) {
+    RteKernelSlim kernel;
+    list<string> files = { pdscFile };
+    list<RtePackage*> packs;
+    if (!kernel.LoadPacks(files, packs)) {
+      state.SkipWithError("cannot load pack");
+      break;
+    }
+    kernel.GetGlobalModel()->InsertPacks(packs);
+  }
+  SetPackCounters(state, params);
+}
+BENCHMARK(BM_RteModel_LoadPacks)->Args({ 8, 64 })->Args({ 64, 512 })->Args({ 256, 2048 })->Unit(benchmark::kMillisecond);
+
+static void BM_RteModel_FilterModel(benchmark::State& state)
+{
+  const BenchPackParams params = GetPackParams(state);
+  const string& pdscFile = BenchEnv::GetGenerator().GeneratePack(params);
+  if (pdscFile.empty()) {
+    state.SkipWithError("cannot generate pack");
+    return;
+  }
+  BenchModel model(pdscFile);
+  RteTarget* target = model.GetTarget();
+  unsigned device = 0;
+  for (auto _ : state) {
+    // switching the device invalidates the filtered model like a new context does
+    device = (device + 1) % params.devices;
+    target->SetAttributes(BenchModel::GetTargetAttributes(device));
+    target->UpdateFilterModel();
+  }
+  state.counters["filtered"] = static_cast<double>(target->GetFilteredComponents().size());
+  SetPackCounters(state, params);
+}
+BENCHMARK(BM_RteModel_FilterModel)->Args({ 8, 64 })->Args({ 64, 512 })->Args({ 256, 2048 })->Unit(benchmark::kMillisecond);
+
+static void BM_RteModel_ResolveDependencies(benchmark::State& state)
+{
+  const BenchPackParams params = GetPackParams(state);
+  const string& pdscFile = BenchEnv::GetGenerator().GeneratePack(params);
+  if (pdscFile.empty()) {
+    state.SkipWithError("cannot generate pack");
+    return;
+  }
+  BenchModel model(pdscFile);
+  RteTarget* target = model.GetTarget();
+  RteDependencySolver* solver = target->GetDependencySolver();
+  RteItem::ConditionResult result = RteItem::UNDEFINED;
+  for (auto _ : state) {
+    state.PauseTiming();
+    // select components of even groups: the solver has to add the components required from odd groups
+    target->ClearSelectedComponents();
+    for (const auto& [_, c] : target->GetFilteredComponents()) {
+      if (RteUtils::GetSuffixAsInt(c->GetCgroupName(), 'G') % 2 == 0) {
+        target->SelectComponent(c, 1, false);
+      }
+    }
+    state.ResumeTiming();
+    solver->EvaluateDependencies();
+    result = solver->ResolveDependencies();
+  }
+  state.counters["selected"] = static_cast<double>(target->CollectSelectedComponentAggregates().size());
+  state.SetLabel(RteItem::ConditionResultToString(result));
+  SetPackCounters(state, params);
+}
+BENCHMARK(BM_RteModel_ResolveDependencies)->Args({ 8, 64 })->Args({ 32, 256 })->Args({ 64, 512 })->Unit(benchmark::kMillisecond);
@@ -0,0 +1,94 @@
+/******************************************************************************/
+/* devtools-bench  -  svdconv benchmarks                                      */
+/******************************************************************************/
+/** @file  SvdConvBench.cpp
+  * @brief SVD model construction and svdconv end-to-end
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "BenchEnv.h"
+
+#include "ErrLog.h"
+#include "RteFsUtils.h"
+#include "SvdModel.h"
+#include "SvdModelBuilder.h"
+#include "XMLTreeSlim.h"
+
+#include <memory>
+
+using namespace std;
+
+namespace {
+
+// benchmark arguments: peripherals, construction jobs
+BenchSvdParams GetSvdParams(const benchmark::State& state)
+{
+  BenchSvdParams params;
+  params.peripherals = static_cast<unsigned>(state.range(0));
+  return params;
+}
+
+void SetSvdCounters(benchmark::State& state, const BenchSvdParams& params)
+{
+  state.counters["peripherals"] = params.peripherals;
+  state.counters["registers"] = params.registers;
+}
+
+unique_ptr<SvdModel> ReadSvd(const string& svdFile, uint32_t jobs)
+{
+  auto model = make_unique<SvdModel>(nullptr);
+  model->SetInputFileName(svdFile);
+  SvdModelBuilder builder(model.get());
+  builder.SetJobs(jobs);
+  XMLTreeSlim xmlTree(&builder);
+  xmlTree.AddFileName(svdFile);
+  if (!xmlTree.ParseAll() || !builder.Finish()) {
+    return nullptr;
+  }
+  return model;
+}
+
+} // namespace
+
+// the model builder calculates and checks items while reading, this covers all stages before generation
+static void BM_SvdConv_Read(benchmark::State& state)
+{
+  const BenchSvdParams params = GetSvdParams(state);
+  const string& svdFile = BenchEnv::GetGenerator().GenerateSvd(params);
+  const auto jobs = static_cast<uint32_t>(state.range(1));
+  for (auto _ : state) {
+    if (!ReadSvd(svdFile, jobs)) {
+      state.SkipWithError("cannot read SVD file");
+      break;
+    }
+    ErrLog::Get()->ClearLogMessages();
+  }
+  state.counters["jobs"] = jobs;
+  SetSvdCounters(state, params);
+}
+BENCHMARK(BM_SvdConv_Read)->ArgsProduct({ { 16, 128, 512 }, { 1, 4 } })->Unit(benchmark::kMillisecond)->UseRealTime();
+
+#ifdef SVDCONV_BIN
+static void BM_SvdConv_EndToEnd(benchmark::State& state)
+{
+  const BenchSvdParams params = GetSvdParams(state);
+  const string& svdFile = BenchEnv::GetGenerator().GenerateSvd(params);
+  const string outDir = BenchEnv::GetGenerator().GetRootDir() + "/out/svdconv";
+  RteFsUtils::CreateDirectories(outDir);
+  const string cmd = BenchEnv::Quote(SVDCONV_BIN) + ' ' + BenchEnv::Quote(svdFile) +
+    " --generate=header --fields=struct -o " + BenchEnv::Quote(outDir);
+  for (auto _ : state) {
+    if (!BenchEnv::RunTool(state, cmd, 1)) {
+      break;
+    }
+  }
+  SetSvdCounters(state, params);
+}
+BENCHMARK(BM_SvdConv_EndToEnd)->Arg(16)->Arg(128)->Arg(512)->Unit(benchmark::kMillisecond)->UseRealTime();
+#endif
@@ -0,0 +1,117 @@
+/******************************************************************************/
+/* devtools-bench  -  version comparison benchmarks                           */
+/******************************************************************************/
+/** @file  VersionCmpBench.cpp
+  * @brief Sorting pack versions and checking version ranges
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "BenchEnv.h"
+
+#include "RteFsUtils.h"
+#include "VersionCmp.h"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+// versions as found in a pack root: MAJOR.MINOR.PATCH, every eighth one a pre-release
+vector<string> GetVersions(unsigned count)
+{
+  vector<string> versions;
+  for (unsigned i = 0; i < count; i++) {
+    string version = to_string(i % 7) + '.' + to_string((i / 7) % 13) + '.' + to_string(i / 91);
+    if (i % 8 == 0) {
+      version += "-rc" + to_string(i % 3);
+    }
+    versions.push_back(version);
+  }
+  return versions;
+}
+
+const string VERSION_RANGE = "2.4.0:5.0.0";
+
+} // namespace
+
+static void BM_VersionCmp_SortStrings(benchmark::State& state)
+{
+  const vector<string> versions = GetVersions(static_cast<unsigned>(state.range(0)));
+  for (auto _ : state) {
+    set<string, VersionCmp::Greater> sorted(versions.begin(), versions.end());
+    benchmark::DoNotOptimize(sorted.begin());
+  }
+  state.counters["versions"] = static_cast<double>(versions.size());
+}
+BENCHMARK(BM_VersionCmp_SortStrings)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_VersionCmp_SortKeys(benchmark::State& state)
+{
+  const vector<string> versions = GetVersions(static_cast<unsigned>(state.range(0)));
+  for (auto _ : state) {
+    vector<VersionCmp::Key> sorted(versions.begin(), versions.end());
+    sort(sorted.begin(), sorted.end(), greater<VersionCmp::Key>());
+    benchmark::DoNotOptimize(sorted.data());
+  }
+  state.counters["versions"] = static_cast<double>(versions.size());
+}
+BENCHMARK(BM_VersionCmp_SortKeys)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_VersionCmp_RangeCompare(benchmark::State& state)
+{
+  const vector<string> versions = GetVersions(static_cast<unsigned>(state.range(0)));
+  size_t matched = 0;
+  for (auto _ : state) {
+    matched = 0;
+    for (const auto& version : versions) {
+      matched += VersionCmp::RangeCompare(version, VERSION_RANGE) == 0 ? 1 : 0;
+    }
+  }
+  state.counters["matched"] = static_cast<double>(matched);
+}
+BENCHMARK(BM_VersionCmp_RangeCompare)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_VersionCmp_RangeKeys(benchmark::State& state)
+{
+  const vector<string> versions = GetVersions(static_cast<unsigned>(state.range(0)));
+  const vector<VersionCmp::Key> keys(versions.begin(), versions.end());
+  size_t matched = 0;
+  for (auto _ : state) {
+    const VersionCmp::Range range(VERSION_RANGE);
+    matched = 0;
+    for (const auto& key : keys) {
+      matched += range.Compare(key) == 0 ? 1 : 0;
+    }
+  }
+  state.counters["matched"] = static_cast<double>(matched);
+}
+BENCHMARK(BM_VersionCmp_RangeKeys)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// pack root directory with one version directory per installed pack version
+static void BM_RteFsUtils_GetInstalledPackVersion(benchmark::State& state)
+{
+  const vector<string> versions = GetVersions(static_cast<unsigned>(state.range(0)));
+  const string packDir = BenchEnv::GetGenerator().GetRootDir() + "/versions/" + to_string(versions.size());
+  for (const auto& version : versions) {
+    if (!RteFsUtils::CreateDirectories(packDir + '/' + version)) {
+      state.SkipWithError("cannot create version directories");
+      return;
+    }
+  }
+  string installed;
+  for (auto _ : state) {
+    installed = RteFsUtils::GetInstalledPackVersion(packDir, VERSION_RANGE);
+  }
+  state.SetLabel(installed);
+  state.counters["versions"] = static_cast<double>(versions.size());
+}
+BENCHMARK(BM_RteFsUtils_GetInstalledPackVersion)->Arg(100)->Arg(2000)->Unit(benchmark::kMillisecond);
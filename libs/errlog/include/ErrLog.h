@@ -10,6 +10,7 @@
 #include "ErrOutputter.h"
 
 #include <stdint.h>
+#include <functional>
 #include <string>
 #include <map>
 #include <list>
@@ -180,6 +181,12 @@ public:
    ErrLog ();
 
 protected:
+  /**
+   * @brief constructor for job contexts, takes over the message settings of another logger
+   * @param settings logger to take quiet/strict mode, levels and suppressed messages from
+  */
+  explicit ErrLog (const ErrLog* settings);
+
   /**
    * @brief protected destructor to prevent heap objects
   */
@@ -187,16 +194,26 @@ protected:
 
 public:
   /**
-   * @brief singleton operation: global application object
+   * @brief singleton operation: global application object, or the job context active on the calling thread
    * @return pointer to class
   */
   static ErrLog* Get() {
+    if (theJobErrLog) {
+      return theJobErrLog;
+    }
     if (!theErrLog) {
       theErrLog = new ErrLog();
     }
     return theErrLog;
   }
 
+  /**
+   * @brief redirect ErrLog::Get() of the calling thread
+   * @param errLog job context to use, nullptr to use the application-wide object
+   * @return previous job context of the calling thread
+  */
+  static ErrLog* SetJobContext(ErrLog* errLog);
+
 public:
   /**
    * @brief empty messages buffer
@@ -375,11 +392,17 @@ public:
   */
   void          SetFileName           (const std::string &fileName)     { m_fileName = fileName;                    }
 
+  /**
+   * @brief gets the name of the currently processed file
+   * @return the name of the currently processed file
+  */
+  const std::string& GetFileName      () const                          { return m_fileName;                        }
+
   /**
    * @brief build and print whole message
    * @param msg message object
   */
-  void          PDSC_PrintMessage     (const PdscMsg &msg);
+  virtual void  PDSC_PrintMessage     (const PdscMsg &msg);
 
   /**
    * @brief Check if message will print according to current level
@@ -511,6 +534,9 @@ protected:
   bool                  m_bSuppressAllError;
   bool                  m_allowSuppressError;
 
+  bool                  m_prevWasMsg;          // last printed message was a warning or error
+  bool                  m_prevSuppressed;      // last message has been suppressed
+
 private:
   class ErrLogDestroyer {
   public:
@@ -520,11 +546,81 @@ private:
   static void  Destroy() { delete theErrLog; theErrLog = nullptr; }
   static ErrLogDestroyer theErrLogDestroyer;
   static ErrLog* theErrLog;  // the application-wide ErrLog Object
+  static thread_local ErrLog* theJobErrLog;  // job context of the calling thread
 
   static const MsgTable msgTable;
   static const MsgTableStrict msgStrictTable;
 };
 
+/**
+ * @brief message logger for one job of a multi-threaded application.
+ *        Starts with the settings of the ErrLog active on the creating thread, counts and outputs
+ *        its messages separately and is returned by ErrLog::Get() while activated.
+ *        Message tables must be initialized before jobs are started.
+*/
+class ErrLogContext : public ErrLog {
+public:
+  /**
+   * @brief constructor
+   * @param errOutputter message sink of the job, gets deleted in destructor
+  */
+  ErrLogContext(ErrOutputter* errOutputter = nullptr);
+  ~ErrLogContext() override;
+
+  /**
+   * @brief make this context the logger of the calling thread
+  */
+  void Activate();
+
+  /**
+   * @brief restore the logger that was active on the calling thread before Activate()
+  */
+  void Deactivate();
+
+  /**
+   * @brief context messages do not extend the message tables shared by all jobs
+  */
+  void InitMessageTable() override {}
+
+private:
+  ErrLog* m_prevJobErrLog;
+  bool    m_active;
+};
+
+/**
+ * @brief job context recording its messages instead of counting and printing them.
+ *        The recorded messages are passed to another logger by Replay(), which allows
+ *        jobs running in parallel to report in a deterministic order.
+*/
+class ErrLogRecorder : public ErrLogContext {
+public:
+  ErrLogRecorder() {}
+  ~ErrLogRecorder() override {}
+
+  /**
+   * @brief record message together with the file name it refers to
+   * @param msg message object
+  */
+  void PDSC_PrintMessage(const PdscMsg& msg) override;
+
+  /**
+   * @brief pass recorded messages to a logger and clear them
+   * @param errLog logger processing the messages
+   * @param filter optional function returning false for messages to drop
+   * @param keep true to keep the messages for replaying them to further loggers
+  */
+  void Replay(ErrLog* errLog, const std::function<bool(const PdscMsg&)>& filter = nullptr, bool keep = false);
+
+  /**
+   * @brief get number of recorded messages
+   * @return number of messages
+  */
+  size_t GetMessageCount() const { return m_messages.size(); }
+
+private:
+  std::list<std::pair<PdscMsg, std::string> > m_messages;
+};
+
 
 #define LogMsg            ErrLog::Get()->Message
 
@@ -16,9 +16,10 @@ const string ErrLog::NEW_LINE_STRING = "\n";
 
 ErrLog::ErrLogDestroyer ErrLog::theErrLogDestroyer;
 ErrLog* ErrLog::theErrLog = nullptr;  // the application-wide ErrLog Object
+thread_local ErrLog* ErrLog::theJobErrLog = nullptr;
 MsgTable PdscMsg::m_messageTable;
 MsgTableStrict PdscMsg::m_messageTableStrict;
-MsgLevel g_msgLevel;
+thread_local MsgLevel g_msgLevel;
 
 
 const string& PdscMsg::GetSubstitute(const string &key) const
@@ -28,7 +29,7 @@ const string& PdscMsg::GetSubstitute(const string &key) const
     return it->second;
   }
 
-  static string errStr;
+  static thread_local string errStr;
   errStr = "<";
   errStr += key;
   errStr += ">";
@@ -67,8 +68,9 @@ MsgLevel PdscMsg::GetMsgLevel() const
   level = mgsEntry? mgsEntry->level : GetMessageEntry("M000")->level;
 
   if(ErrLog::Get()->IsStrictMode()) {
-    if(m_messageTableStrict.find(m_num) != m_messageTableStrict.end()) {
-      level = m_messageTableStrict[m_num];
+    auto it = m_messageTableStrict.find(m_num);
+    if(it != m_messageTableStrict.end()) {
+      level = it->second;
     }
   }
 
@@ -149,7 +151,9 @@ m_warnCnt(0),
 m_bSuppressAllInfo (false),
 m_bSuppressAllWarning (false),
 m_bSuppressAllError (false),
-m_allowSuppressError (false)
+m_allowSuppressError (false),
+m_prevWasMsg(false),
+m_prevSuppressed(false)
 {
   m_outBuf = new char[OUTBUF_SIZE];
 
@@ -161,6 +165,29 @@ m_allowSuppressError (false)
   InitMessageTable();
 }
 
+ErrLog::ErrLog (const ErrLog* settings):
+m_outBuf(0),
+m_ErrConsumer(nullptr),
+m_ErrOutputter(nullptr),
+m_quietMode(settings->m_quietMode),
+m_strictMode(settings->m_strictMode),
+m_msgOutLevel(settings->m_msgOutLevel),
+m_tmpLevelVerbose(settings->m_tmpLevelVerbose),
+m_fileName(settings->m_fileName),
+m_errCnt(0),
+m_warnCnt(0),
+m_diagSuppressMsg(settings->m_diagSuppressMsg),
+m_diagShowOnlyMsg(settings->m_diagShowOnlyMsg),
+m_bSuppressAllInfo (settings->m_bSuppressAllInfo),
+m_bSuppressAllWarning (settings->m_bSuppressAllWarning),
+m_bSuppressAllError (settings->m_bSuppressAllError),
+m_allowSuppressError (settings->m_allowSuppressError),
+m_prevWasMsg(false),
+m_prevSuppressed(false)
+{
+  InitLevelStrTable();      // output buffer is allocated on first use, many contexts may exist
+}
+
 
 ErrLog::~ErrLog ()
 {
@@ -180,6 +207,14 @@ ErrLog::~ErrLog ()
   delete[] m_outBuf;
 }
 
+ErrLog* ErrLog::SetJobContext(ErrLog* errLog)
+{
+  ErrLog* prev = theJobErrLog;
+  theJobErrLog = errLog;
+
+  return prev;
+}
+
 void ErrLog::InitMessageTable()
 {
   PdscMsg::AddMessages(msgTable);
@@ -242,6 +277,9 @@ void ErrLog::TxtOut(const char *text, ...)
   if (text == NULL || *text == '\0') {
     return;
   }
+  if(!m_outBuf) {
+    m_outBuf = new char[OUTBUF_SIZE];
+  }
   va_list   marker;
   va_start (marker, text);
   vsnprintf(m_outBuf, OUTBUF_SIZE, text, marker);
@@ -506,29 +544,27 @@ bool ErrLog::SuppressMessage (const std::string &msgNum)
 
 void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
 {
-  static int prevWasMsg = 0, prevSuppressed = 0;
-
   MsgLevel msgLevel = msg.GetMsgLevel ();
   g_msgLevel = msgLevel;
 
   if(m_bSuppressAllInfo) {
     if(msgLevel == MsgLevel::LEVEL_WARNING3 || msgLevel == MsgLevel::LEVEL_INFO || msgLevel == MsgLevel::LEVEL_INFO2) {
-      prevSuppressed = 1;
+      m_prevSuppressed = true;
       return;
     }
   }
   if(m_bSuppressAllWarning) {
     if(msgLevel == MsgLevel::LEVEL_WARNING || msgLevel == MsgLevel::LEVEL_WARNING2) {
-      prevSuppressed = 1;
+      m_prevSuppressed = true;
       return;
     }
   }
 
   if(SuppressMessage(msg.GetMsgNum())) {
-    prevSuppressed = 1;
+    m_prevSuppressed = true;
     return;
   }
-  if(prevSuppressed && msg.GetMsgNum() == "M010") {   // also suppress " OK"
+  if(m_prevSuppressed && msg.GetMsgNum() == "M010") {   // also suppress " OK"
     return;
   }
 
@@ -547,7 +583,7 @@ void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
     return;
   }
 
-  prevSuppressed = 0;
+  m_prevSuppressed = false;
   int lineNo = msg.GetLineNo();
   unsigned doCRLF = msg.GetCrLf();
 
@@ -560,10 +596,10 @@ void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
 
     if(msgLevel <= MsgLevel::LEVEL_INFO || msgLevel == MsgLevel::LEVEL_TEXT) {
       // Text only
-      if(prevWasMsg) {
+      if(m_prevWasMsg) {
         NewLine();    // print newline
       }
-      prevWasMsg = 0;
+      m_prevWasMsg = false;
       string numStr = msg.GetMsgNum();
       int num = atoi(&numStr.c_str()[1]);
 
@@ -576,7 +612,7 @@ void ErrLog::PDSC_PrintMessage(const PdscMsg &msg)
       }
     }
     else {
-      prevWasMsg = 1;
+      m_prevWasMsg = true;
       // Line1: *** ERROR M001 : (Line 42) InputFile.pdsc
       // Line1: *** WARNING M002 : (Line 42) InputFile.pdsc
       NewLine();
@@ -611,6 +647,67 @@ int ErrLog::WillMsgPrint(const string &num) const
   return 0;
 }
 
+// Job context
+ErrLogContext::ErrLogContext(ErrOutputter* errOutputter) :
+  ErrLog(ErrLog::Get()),
+  m_prevJobErrLog(nullptr),
+  m_active(false)
+{
+  m_ErrOutputter = errOutputter;
+}
+
+ErrLogContext::~ErrLogContext()
+{
+  Deactivate();
+}
+
+void ErrLogContext::Activate()
+{
+  if(m_active) {
+    return;
+  }
+
+  m_prevJobErrLog = SetJobContext(this);
+  m_active = true;
+}
+
+void ErrLogContext::Deactivate()
+{
+  if(!m_active) {
+    return;
+  }
+
+  SetJobContext(m_prevJobErrLog);
+  m_prevJobErrLog = nullptr;
+  m_active = false;
+}
+
+void ErrLogRecorder::PDSC_PrintMessage(const PdscMsg& msg)
+{
+  m_messages.push_back(make_pair(msg, m_fileName));
+}
+
+void ErrLogRecorder::Replay(ErrLog* errLog, const function<bool(const PdscMsg&)>& filter, bool keep)
+{
+  if(!errLog) {
+    return;
+  }
+
+  const string fileName = errLog->GetFileName();
+  for(const auto& [msg, msgFileName] : m_messages) {
+    if(filter && !filter(msg)) {
+      continue;
+    }
+    errLog->SetFileName(msgFileName);
+    errLog->Message(msg);
+  }
+  errLog->SetFileName(fileName);
+
+  if(!keep) {
+    m_messages.clear();
+  }
+}
+
 // Utils
 string ErrLog::CreateDecNum(unsigned int num)
 {
@@ -10,6 +10,8 @@
 
 #include "RteFsUtils.h"
 
+#include <algorithm>
+#include <thread>
 #include <vector>
 #include <list>
 #include <string>
@@ -110,3 +112,120 @@ TEST_F(ErrLogTest, PdscMessage) {
   ErrLog::Get()->Save();
   ErrLog::Get()->ClearLogMessages();
 }
+
+TEST_F(ErrLogTest, JobContext) {
+  ErrLog::Get()->ClearLogMessages();
+  ErrLog::Get()->AddDiagSuppress("M041");
+  ErrLog* globalErrLog = ErrLog::Get();
+
+  vector<ErrLogContext*> contexts;
+  vector<thread> jobs;
+  for(unsigned i = 0; i < 4; i++) {
+    contexts.push_back(new ErrLogContext(new ErrOutputter()));
+  }
+  for(unsigned i = 0; i < contexts.size(); i++) {
+    jobs.emplace_back([&contexts, i]() {
+      ErrLogContext* context = contexts[i];
+      context->Activate();
+      context->SetFileName("Job" + to_string(i) + ".test");
+      for(unsigned n = 0; n <= i; n++) {
+        LogMsg("M017", MSG(to_string(n)), n, 0);
+      }
+      LogMsg("M041");
+      context->Deactivate();
+    });
+  }
+  for(auto& job : jobs) {
+    job.join();
+  }
+
+  // each job counted and collected its own messages, suppressed messages are taken over
+  for(unsigned i = 0; i < contexts.size(); i++) {
+    ErrLogContext* context = contexts[i];
+    EXPECT_EQ((int)i + 1, context->GetErrCnt());
+    const list<string>& messages = context->GetLogMessages();
+    EXPECT_EQ((long)i + 1, count(messages.begin(), messages.end(), " Job" + to_string(i) + ".test"));
+    delete context;
+  }
+
+  EXPECT_EQ(globalErrLog, ErrLog::Get());
+  EXPECT_EQ(0, ErrLog::Get()->GetErrCnt());
+  EXPECT_TRUE(ErrLog::Get()->GetLogMessages().empty());
+
+  // contexts can be nested on the same thread
+  ErrLogContext outer, inner;
+  outer.Activate();
+  inner.Activate();
+  EXPECT_EQ(&inner, ErrLog::Get());
+  inner.Deactivate();
+  EXPECT_EQ(&outer, ErrLog::Get());
+  outer.Deactivate();
+  EXPECT_EQ(globalErrLog, ErrLog::Get());
+}
+
+TEST_F(ErrLogTest, Recorder) {
+  ErrLog::Get()->ClearLogMessages();
+  ErrLog::Get()->SetFileName("Main.test");
+
+  // record on job threads, replay in job order
+  vector<ErrLogRecorder*> recorders;
+  vector<thread> jobs;
+  for(unsigned i = 0; i < 3; i++) {
+    recorders.push_back(new ErrLogRecorder());
+  }
+  for(unsigned i = 0; i < recorders.size(); i++) {
+    jobs.emplace_back([&recorders, i]() {
+      ErrLogRecorder* recorder = recorders[i];
+      recorder->Activate();
+      recorder->SetFileName("Job" + to_string(i) + ".test");
+      LogMsg("M017", MSG(to_string(i)), i, 0);
+      LogMsg("M016");
+      recorder->Deactivate();
+    });
+  }
+  for(auto& job : jobs) {
+    job.join();
+  }
+
+  for(unsigned i = recorders.size(); i > 0; i--) {
+    EXPECT_EQ(2, recorders[i - 1]->GetMessageCount());
+    EXPECT_EQ(0, recorders[i - 1]->GetErrCnt());
+  }
+  EXPECT_EQ(0, ErrLog::Get()->GetErrCnt());
+
+  for(const auto recorder : recorders) {
+    recorder->Replay(ErrLog::Get(), [](const PdscMsg& msg) { return msg.GetMsgNum() != "M016"; });
+    EXPECT_EQ(0, recorder->GetMessageCount());
+    delete recorder;
+  }
+
+  // messages are counted and printed with the recorded file name, in replay order
+  EXPECT_EQ(3, ErrLog::Get()->GetErrCnt());
+  EXPECT_EQ("Main.test", ErrLog::Get()->GetFileName());
+  const list<string>& messages = ErrLog::Get()->GetLogMessages();
+  vector<string> fileNames;
+  for(const auto& message : messages) {
+    if(message.find(".test") != string::npos) {
+      fileNames.push_back(message);
+    }
+  }
+  EXPECT_EQ(vector<string>({ " Job0.test", " Job1.test", " Job2.test" }), fileNames);
+  ErrLog::Get()->SetFileName("");
+}
+
+TEST_F(ErrLogTest, RecorderKeep) {
+  ErrLogRecorder recorder;
+  recorder.Activate();
+  LogMsg("M017", MSG("shared"), 1, 0);
+  recorder.Deactivate();
+
+  // recorded messages can be passed to several job contexts
+  for(unsigned i = 0; i < 2; i++) {
+    ErrLogContext context(new ErrOutputter());
+    recorder.Replay(&context, nullptr, true);
+    EXPECT_EQ(1, recorder.GetMessageCount());
+    EXPECT_EQ(1, context.GetErrCnt());
+  }
+  recorder.Replay(ErrLog::Get(), [](const PdscMsg&) { return false; });
+  EXPECT_EQ(0, recorder.GetMessageCount());
+}
@@ -0,0 +1,127 @@
+#ifndef RteFileWriter_H
+#define RteFileWriter_H
+/******************************************************************************/
+/* RTE  -  CMSIS Run-Time Environment                                          */
+/******************************************************************************/
+/** @file  RteFileWriter.h
+  * @brief Buffered output file with atomic replace
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/**
+ * @brief Output file written through a large buffer into a temporary file next to the destination.
+ *        Commit() moves the temporary file into place in a single rename, so readers and interrupted
+ *        runs never see a partial file. If the content equals the existing file, the existing file
+ *        is left untouched (including its timestamp). Content that fits into the buffer is compared
+ *        in memory and never written; larger content is compared by size and hash.
+ *        As with a file written in place, a read-only destination is not replaced, the permissions
+ *        of the destination are kept and a symbolic link is written through to its target.
+*/
+class RteFileWriter
+{
+public:
+  static constexpr size_t DEFAULT_BUFFER_SIZE = 1024 * 1024;
+
+  /**
+   * @brief constructor
+   * @param bufferSize size of the write buffer
+  */
+  RteFileWriter(size_t bufferSize = DEFAULT_BUFFER_SIZE);
+  /**
+   * @brief destructor, discards an uncommitted file
+  */
+  ~RteFileWriter();
+
+  RteFileWriter(const RteFileWriter&) = delete;
+  RteFileWriter& operator=(const RteFileWriter&) = delete;
+
+  /**
+   * @brief start writing a file, create directories if necessary
+   * @param fileName destination file
+   * @param textMode true to write '\n' as platform line end (CRLF on Windows)
+   * @return true if the destination directory is available
+  */
+  bool Open(const std::string& fileName, bool textMode = false);
+  /**
+   * @brief append data
+   * @param data pointer to data
+   * @param size number of bytes
+   * @return false if a previous write to the temporary file failed
+  */
+  bool Write(const char* data, size_t size);
+  /**
+   * @brief append string
+   * @param text string to append
+   * @return false if a previous write to the temporary file failed
+  */
+  bool Write(const std::string& text) { return Write(text.data(), text.size()); }
+  /**
+   * @brief append single character
+   * @param c character to append
+   * @return false if a previous write to the temporary file failed
+  */
+  bool Put(char c);
+  /**
+   * @brief complete the file: move it into place unless the content is unchanged
+   * @return true if the destination file holds the written content
+  */
+  bool Commit();
+  /**
+   * @brief drop written content and remove the temporary file
+  */
+  void Discard();
+  /**
+   * @brief check if a file is open for writing
+   * @return true between Open() and Commit() or Discard()
+  */
+  bool IsOpen() const { return m_open; }
+  /**
+   * @brief check if last Commit() replaced or created the destination file
+   * @return false if the content was unchanged
+  */
+  bool IsChanged() const { return m_changed; }
+  /**
+   * @brief get destination file name
+   * @return destination file name, symbolic link resolved
+  */
+  const std::string& GetFileName() const { return m_fileName; }
+
+  /**
+   * @brief write a complete file
+   * @param fileName destination file
+   * @param content file content
+   * @param textMode true to write '\n' as platform line end (CRLF on Windows)
+   * @return true if the destination file holds the content
+  */
+  static bool WriteFile(const std::string& fileName, const std::string& content, bool textMode = false);
+
+protected:
+  bool Append(const char* data, size_t size);
+  bool FlushBuffer();
+  bool IsUnchanged();
+
+private:
+  std::string   m_fileName;
+  std::string   m_tmpFileName;
+  std::string   m_buffer;
+  std::ofstream m_tmpFile;
+  size_t        m_bufferSize;
+  uint64_t      m_size;
+  uint64_t      m_hash;
+  bool          m_open;
+  bool          m_textMode;
+  bool          m_failed;
+  bool          m_changed;
+};
+
+#endif // RteFileWriter_H
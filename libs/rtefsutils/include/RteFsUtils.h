@@ -76,7 +76,8 @@ public:
   */
   static bool CopyBufferToFile(const std::string& fileName, const std::string& fileBuffer, bool backup);
   /**
-   * @brief replace occurrences of "%Instance%" in content of file 'src' with 'nInstance' and copy content to destination file 'dst'
+   * @brief replace occurrences of "%Instance%" in content of file 'src' with 'nInstance' and copy content to destination file 'dst',
+   *        an existing destination file with equal content is left untouched
    * @param src source file
    * @param dst destination file
    * @param nInstance number to replace occurrences of "%Instance%"
@@ -85,7 +86,7 @@ public:
   */
   static bool CopyMergeFile(const std::string& src, const std::string& dst, int nInstance, bool backup);
   /**
-   * @brief compare file content with given string 'buffer'
+   * @brief compare file content with given string 'buffer', reading stops at the first difference
    * @param fileName name of file to be compared
    * @param buffer contain string to be compared
    * @return true if file content is equal to given string
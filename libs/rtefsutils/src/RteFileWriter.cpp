@@ -0,0 +1,264 @@
+/******************************************************************************/
+/* RTE  -  CMSIS Run-Time Environment                                          */
+/******************************************************************************/
+/** @file  RteFileWriter.cpp
+  * @brief Buffered output file with atomic replace
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "RteFileWriter.h"
+#include "RteFsUtils.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#if defined(_WIN32)
+#include <process.h>
+#define GETPID _getpid
+#else
+#include <unistd.h>
+#define GETPID getpid
+#endif
+
+using namespace std;
+
+static constexpr size_t   READ_CHUNK = 64 * 1024;
+static constexpr unsigned RENAME_RETRIES = 5;       // destination may be opened by another process (Windows)
+
+RteFileWriter::RteFileWriter(size_t bufferSize) :
+  m_bufferSize(bufferSize ? bufferSize : DEFAULT_BUFFER_SIZE),
+  m_size(0),
+  m_hash(RteUtils::FNV_OFFSET),
+  m_open(false),
+  m_textMode(false),
+  m_failed(false),
+  m_changed(false)
+{
+}
+
+RteFileWriter::~RteFileWriter()
+{
+  Discard();
+}
+
+bool RteFileWriter::Open(const string& fileName, bool textMode)
+{
+  Discard();
+  m_changed = false;
+  if (fileName.empty() || RteFsUtils::IsDirectory(fileName)) {
+    return false;
+  }
+  // a symbolic link is kept: its target is replaced
+  string file = fileName;
+  error_code ec;
+  if (fs::is_symlink(fs::symlink_status(fileName, ec))) {
+    fs::path target = fs::canonical(fileName, ec);
+    if (ec) {
+      // dangling link: create the file it points to
+      target = fs::path(fileName).parent_path() / fs::read_symlink(fileName, ec);
+    }
+    if (ec || RteFsUtils::IsDirectory(target.generic_string())) {
+      return false;
+    }
+    file = target.generic_string();
+  }
+  const string dir = fs::path(file).parent_path().generic_string();
+  if (!dir.empty() && !RteFsUtils::CreateDirectories(dir)) {
+    return false;
+  }
+  m_fileName = file;
+  m_textMode = textMode;
+  m_size = 0;
+  m_hash = RteUtils::FNV_OFFSET;
+  m_open = true;
+  return true;
+}
+
+bool RteFileWriter::Append(const char* data, size_t size)
+{
+  if (!m_open || m_failed) {
+    return false;
+  }
+  m_hash = RteUtils::HashFnv1a(m_hash, data, size);
+  m_size += size;
+
+  if (m_buffer.size() + size > m_bufferSize) {
+    if (!FlushBuffer()) {
+      return false;
+    }
+    if (size >= m_bufferSize) {
+      // large block: bypass the buffer
+      m_tmpFile.write(data, size);
+      m_failed = m_tmpFile.fail();
+      return !m_failed;
+    }
+  }
+  m_buffer.append(data, size);
+  return true;
+}
+
+bool RteFileWriter::Write(const char* data, size_t size)
+{
+#if defined(_WIN32)
+  if (m_textMode) {
+    const char* end = data + size;
+    for (const char* pos = data; pos < end;) {
+      const char* eol = static_cast<const char*>(memchr(pos, '\n', end - pos));
+      if (!eol) {
+        return Append(pos, end - pos);
+      }
+      if (!Append(pos, eol - pos) || !Append("\r\n", 2)) {
+        return false;
+      }
+      pos = eol + 1;
+    }
+    return !m_failed;
+  }
+#endif
+  return Append(data, size);
+}
+
+bool RteFileWriter::Put(char c)
+{
+  return Write(&c, 1);
+}
+
+bool RteFileWriter::FlushBuffer()
+{
+  if (!m_tmpFile.is_open()) {
+    // temporary file next to the destination: rename stays within the file system
+    static atomic<uint32_t> counter(0);
+    m_tmpFileName = m_fileName + ".tmp" + to_string(GETPID()) + "_" + to_string(counter++);
+    m_tmpFile.open(m_tmpFileName, ios::binary | ios::trunc);
+    if (!m_tmpFile.is_open()) {
+      m_failed = true;
+      return false;
+    }
+  }
+  if (!m_buffer.empty()) {
+    m_tmpFile.write(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+  }
+  m_failed = m_tmpFile.fail();
+  return !m_failed;
+}
+
+bool RteFileWriter::IsUnchanged()
+{
+  error_code ec;
+  const auto size = fs::file_size(m_fileName, ec);
+  if (ec || size != m_size) {
+    return false;
+  }
+  ifstream file(m_fileName, ios::binary);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  string chunk(READ_CHUNK, '\0');
+  if (!m_tmpFile.is_open()) {
+    // complete content is buffered: compare bytes
+    for (size_t pos = 0; pos < m_buffer.size();) {
+      file.read(&chunk[0], min(READ_CHUNK, m_buffer.size() - pos));
+      const size_t n = static_cast<size_t>(file.gcount());
+      if (n == 0 || memcmp(chunk.data(), m_buffer.data() + pos, n) != 0) {
+        return false;
+      }
+      pos += n;
+    }
+    return true;
+  }
+
+  uint64_t hash = RteUtils::FNV_OFFSET;
+  while (file.read(&chunk[0], READ_CHUNK), file.gcount() > 0) {
+    hash = RteUtils::HashFnv1a(hash, chunk.data(), static_cast<size_t>(file.gcount()));
+  }
+  return hash == m_hash;
+}
+
+bool RteFileWriter::Commit()
+{
+  if (!m_open) {
+    return false;
+  }
+  if (m_failed) {
+    Discard();
+    return false;
+  }
+
+  // an existing destination must be writable like a file written in place, its permissions are kept
+  error_code ec;
+  const fs::file_status status = fs::status(m_fileName, ec);
+  const bool exists = fs::exists(status);
+  if (exists && !ofstream(m_fileName, ios::binary | ios::app).is_open()) {
+    Discard();
+    return false;
+  }
+
+  if (IsUnchanged()) {
+    Discard();
+    return true;
+  }
+
+  if (!FlushBuffer()) {
+    Discard();
+    return false;
+  }
+  m_tmpFile.close();
+  if (m_tmpFile.fail()) {
+    Discard();
+    return false;
+  }
+  if (exists) {
+    fs::permissions(m_tmpFileName, status.permissions(), ec);
+    if (ec) {
+      Discard();
+      return false;
+    }
+  }
+  for (unsigned r = 0; r < RENAME_RETRIES; r++) {
+    fs::rename(m_tmpFileName, m_fileName, ec);
+    if (!ec) {
+      break;
+    }
+    this_thread::sleep_for(chrono::milliseconds(1));
+  }
+  if (ec) {
+    Discard();
+    return false;
+  }
+
+  m_tmpFileName.clear();
+  Discard();
+  m_changed = true;
+  return true;
+}
+
+void RteFileWriter::Discard()
+{
+  if (m_tmpFile.is_open()) {
+    m_tmpFile.close();
+  }
+  m_tmpFile.clear();
+  if (!m_tmpFileName.empty()) {
+    RteFsUtils::RemoveFile(m_tmpFileName);
+    m_tmpFileName.clear();
+  }
+  m_buffer.clear();
+  m_open = false;
+  m_failed = false;
+}
+
+bool RteFileWriter::WriteFile(const string& fileName, const string& content, bool textMode)
+{
+  RteFileWriter writer(content.size() + 1);     // content is compared in memory
+  return writer.Open(fileName, textMode) && writer.Write(content) && writer.Commit();
+}
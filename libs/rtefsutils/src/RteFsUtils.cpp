@@ -13,6 +13,7 @@
 /******************************************************************************/
 
 #include "RteFsUtils.h"
+#include "RteFileWriter.h"
 
 #include "CrossPlatformUtils.h"
 #include "RteUtils.h"
@@ -28,6 +29,8 @@
 
 using namespace std;
 
+static constexpr size_t CMP_CHUNK = 64 * 1024;
+
 string RteFsUtils::MakePathCanonical(const string& path)
 {
   error_code ec;
@@ -105,14 +108,52 @@ bool RteFsUtils::ReadFile(const string& fileName, string& buffer) {
 
 
 bool RteFsUtils::CmpFileMem(const string& fileName, const string& buffer) {
+  // Different sizes need no read
+  error_code ec;
+  const auto size = fs::file_size(fileName, ec);
+  if (ec || size != buffer.size()) {
+    return false;
+  }
+  ifstream file(fileName, std::ios::binary);
+  if (!file.is_open()) {
+    return false;
+  }
+  // Compare chunk by chunk, stop at first difference
+  string chunk(min(CMP_CHUNK, buffer.size()), '\0');
+  for (size_t pos = 0; pos < buffer.size();) {
+    file.read(&chunk[0], min(CMP_CHUNK, buffer.size() - pos));
+    const size_t n = static_cast<size_t>(file.gcount());
+    if (n == 0 || buffer.compare(pos, n, chunk, 0, n) != 0) {
+      return false;
+    }
+    pos += n;
+  }
+  return true;
+}
 
-  // Open file and read content
-  string fileBuffer;
-  if(!ReadFile(fileName, fileBuffer)) {
+static bool ExpandInstance(const string& content, int nInst, string& buffer) {
+  // Collect %Instance% occurrences
+  static const string INSTANCE = "%Instance%";
+  vector<size_t> positions;
+  for (size_t pos = content.find(INSTANCE); pos != string::npos; pos = content.find(INSTANCE, pos + INSTANCE.size())) {
+    positions.push_back(pos);
+  }
+  if (positions.empty()) {
     return false;
   }
-  // Compare file and buffer contents
-  return buffer == fileBuffer;
+
+  // Single pass into preallocated output
+  const string instanceString = std::to_string(nInst);
+  buffer.clear();
+  buffer.reserve(content.size() - positions.size() * (INSTANCE.size() - instanceString.size()));
+  size_t start = 0;
+  for (const auto pos : positions) {
+    buffer.append(content, start, pos - start);
+    buffer.append(instanceString);
+    start = pos + INSTANCE.size();
+  }
+  buffer.append(content, start, string::npos);
+  return true;
 }
 
 bool RteFsUtils::ExpandFile(const string& fileName, int nInst, string& buffer) {
@@ -123,22 +164,7 @@ bool RteFsUtils::ExpandFile(const string& fileName, int nInst, string& buffer) {
   }
 
   // Expand template by replacing %Instance% occurrences
-  string instanceString = std::to_string(nInst);
-  size_t position = 0;
-  bool expanded = false;
-  while ((position = fileBuffer.find("%Instance%", position)) != string::npos) {
-    fileBuffer.replace(position, 10, instanceString);
-    expanded = true;
-  }
-
-  // No expansion
-  if (!expanded) {
-    return false;
-  }
-
-  // Set output buffer
-  buffer = fileBuffer;
-  return true;
+  return ExpandInstance(fileBuffer, nInst, buffer);
 }
 
 /*
@@ -204,20 +230,8 @@ string RteFsUtils::BackupFile(const string& fileName, bool bDeleteExisting) {
 }
 
 bool RteFsUtils::CreateTextFile(const string& file, const string& content) {
-  // Create file and directories
-  error_code ec;
-  fs::create_directories(fs::path(file).parent_path(), ec);
-  if (ec) {
-    return false;
-  }
-  ofstream fileStream(file, std::ios::binary);
-  if (!fileStream.is_open()) {
-    return false;
-  }
-  fileStream << content;
-  fileStream.flush();
-  fileStream.close();
-  return true;
+  // Create file and directories, the file is replaced atomically
+  return RteFileWriter::WriteFile(file, content);
 }
 
 bool RteFsUtils::CopyBufferToFile(const string& fileName, const string& buffer, bool backup) {
@@ -233,20 +247,25 @@ bool RteFsUtils::CopyBufferToFile(const string& fileName, const string& buffer,
     }
   }
 
-  return CreateTextFile(fileName, buffer);
+  return RteFileWriter::WriteFile(fileName, buffer);
 }
 
 bool RteFsUtils::CopyMergeFile(const string& src, const string& dst, int nInstance, bool backup) {
   if (nInstance < 0) {
     nInstance = 0;
   }
-  string buffer;
-  if (ExpandFile(src, nInstance, buffer)) {
+  string content, buffer;
+  if (!ReadFile(src, content)) {
+    return CopyCheckFile(src, dst, backup);
+  }
+  if (ExpandInstance(content, nInstance, buffer)) {
     return CopyBufferToFile(dst, buffer, backup);
   }
-  else {
-    return CopyCheckFile(src, dst, backup);
+  // Plain copy, not needed if destination is identical
+  if (CmpFileMem(dst, content)) {
+    return true;
   }
+  return CopyCheckFile(src, dst, backup);
 }
 
 bool RteFsUtils::SetFileReadOnly(const string& path, bool bReadOnly) {
@@ -659,8 +678,9 @@ string RteFsUtils::GetInstalledPackVersion(const string &path, const string &ver
   if ((versionRange.empty()) && (!files.empty()))
     return *files.begin();
 
+  const VersionCmp::Range range(versionRange);
   for (auto version : files) {
-    if (VersionCmp::RangeCompare(version, versionRange) == 0)
+    if (range.Compare(version) == 0)
       return version;
   }
 
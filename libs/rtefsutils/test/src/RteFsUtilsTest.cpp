@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 #include "RteUtils.h"
 #include "RteFsUtils.h"
+#include "RteFileWriter.h"
 #include <fstream>
 
 using namespace std;
@@ -256,6 +257,77 @@ TEST_F(RteFsUtilsTest, CopyBufferToFile) {
   RteFsUtils::RemoveFile(filenameBackup0);
 }
 
+TEST_F(RteFsUtilsTest, FileWriter) {
+  // small buffer: content goes through the temporary file
+  RteFileWriter writer(4);
+  EXPECT_TRUE(writer.Open(filenameRegular));
+  EXPECT_TRUE(writer.Write(bufferFoo));
+  EXPECT_TRUE(writer.Put('!'));
+  EXPECT_FALSE(RteFsUtils::Exists(filenameRegular));
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(dirnameSubdir), 1); // temporary file only
+  EXPECT_TRUE(writer.Commit());
+  EXPECT_TRUE(writer.IsChanged());
+  EXPECT_FALSE(writer.IsOpen());
+  EXPECT_TRUE(RteFsUtils::CmpFileMem(filenameRegular, bufferFoo + "!"));
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(dirnameSubdir), 1);
+
+  // same content: existing file is kept
+  EXPECT_TRUE(writer.Open(filenameRegular));
+  EXPECT_TRUE(writer.Write(bufferFoo + "!"));
+  EXPECT_TRUE(writer.Commit());
+  EXPECT_FALSE(writer.IsChanged());
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(dirnameSubdir), 1);
+
+  // discarded content leaves neither destination nor temporary file
+  EXPECT_TRUE(writer.Open(filenameRegularCopy));
+  EXPECT_TRUE(writer.Write(bufferBar));
+  writer.Discard();
+  EXPECT_FALSE(RteFsUtils::Exists(filenameRegularCopy));
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(dirnameSubdir), 1);
+
+  // complete file, buffered in memory
+  EXPECT_TRUE(RteFileWriter::WriteFile(filenameRegular, bufferBar));
+  EXPECT_TRUE(RteFsUtils::CmpFileMem(filenameRegular, bufferBar));
+  EXPECT_FALSE(RteFileWriter::WriteFile("", bufferBar));
+  EXPECT_FALSE(RteFileWriter::WriteFile(dirnameSubdir, bufferBar));
+  RteFsUtils::RemoveFile(filenameRegular);
+}
+
+TEST_F(RteFsUtilsTest, FileWriterKeepsDestination) {
+  error_code ec;
+  constexpr fs::perms write_mask = fs::perms::owner_write | fs::perms::group_write | fs::perms::others_write;
+
+  // permissions of a replaced file are kept
+  EXPECT_TRUE(RteFsUtils::CreateTextFile(filenameRegular, bufferFoo));
+  fs::permissions(filenameRegular, fs::perms::owner_all | fs::perms::group_read | fs::perms::group_exec, ec);
+  const fs::perms perms = fs::status(filenameRegular, ec).permissions();
+  EXPECT_TRUE(RteFsUtils::CreateTextFile(filenameRegular, bufferBar));
+  EXPECT_TRUE(RteFsUtils::CmpFileMem(filenameRegular, bufferBar));
+  EXPECT_EQ(fs::status(filenameRegular, ec).permissions(), perms);
+
+  // read-only file is kept unless it can be written in place
+  EXPECT_TRUE(RteFsUtils::SetFileReadOnly(filenameRegular, true));
+  const fs::perms readOnlyPerms = fs::status(filenameRegular, ec).permissions();
+  const bool writable = ofstream(filenameRegular, ios::binary | ios::app).is_open();
+  EXPECT_EQ(RteFsUtils::CreateTextFile(filenameRegular, bufferFoo), writable);
+  EXPECT_TRUE(RteFsUtils::CmpFileMem(filenameRegular, writable ? bufferFoo : bufferBar));
+  EXPECT_EQ(fs::status(filenameRegular, ec).permissions(), readOnlyPerms);
+  EXPECT_EQ(readOnlyPerms & write_mask, fs::perms::none);
+  EXPECT_EQ(RteFsUtils::CountFilesInFolder(dirnameSubdir), 1);
+  RteFsUtils::SetFileReadOnly(filenameRegular, false);
+
+  // symbolic link is kept, its target is written
+  const string filenameLink = dirnameDir + "/link.txt";
+  fs::create_symlink(fs::absolute(filenameRegular), filenameLink, ec);
+  if (!ec) {
+    EXPECT_TRUE(RteFsUtils::CreateTextFile(filenameLink, bufferBar));
+    EXPECT_TRUE(fs::is_symlink(filenameLink));
+    EXPECT_TRUE(RteFsUtils::CmpFileMem(filenameRegular, bufferBar));
+    RteFsUtils::RemoveFile(filenameLink);
+  }
+  RteFsUtils::RemoveFile(filenameRegular);
+}
+
 TEST_F(RteFsUtilsTest, CopyCheckFile) {
   bool ret;
   error_code ec;
@@ -307,6 +379,42 @@ TEST_F(RteFsUtilsTest, CopyCheckFile) {
   RteFsUtils::RemoveFile(filenameBackup0);
 }
 
+TEST_F(RteFsUtilsTest, CopyMergeFileUnchanged) {
+  string buffer;
+  const string templ = "#define A%Instance% %Instance%\n%Instance%%Instance\n%Instance%";
+  RteFsUtils::CreateTextFile(filenameRegular, templ);
+
+  // Expand template
+  EXPECT_TRUE(RteFsUtils::ExpandFile(filenameRegular, 12, buffer));
+  EXPECT_EQ("#define A12 12\n12%Instance\n12", buffer);
+  RteFsUtils::CreateTextFile(filenameRegularCopy, bufferFoo);
+  EXPECT_FALSE(RteFsUtils::ExpandFile(filenameRegularCopy, 12, buffer));
+  EXPECT_EQ("#define A12 12\n12%Instance\n12", buffer);
+  RteFsUtils::RemoveFile(filenameRegularCopy);
+
+  // Copy expanded template, unchanged destination is neither rewritten nor backed up
+  const string dst = dirnameSubdir + "/dst.h";
+  EXPECT_TRUE(RteFsUtils::CopyMergeFile(filenameRegular, dst, 3, true));
+  EXPECT_TRUE(RteFsUtils::CmpFileMem(dst, "#define A3 3\n3%Instance\n3"));
+  error_code ec;
+  const auto time = fs::last_write_time(dst, ec);
+  EXPECT_TRUE(RteFsUtils::CopyMergeFile(filenameRegular, dst, 3, true));
+  EXPECT_EQ(time, fs::last_write_time(dst, ec));
+  EXPECT_FALSE(RteFsUtils::Exists(dst + ".0000"));
+  EXPECT_TRUE(RteFsUtils::CopyMergeFile(filenameRegular, dst, 4, true));
+  EXPECT_TRUE(RteFsUtils::CmpFileMem(dst, "#define A4 4\n4%Instance\n4"));
+  EXPECT_TRUE(RteFsUtils::Exists(dst + ".0000"));
+
+  // Plain copy of a file without placeholders
+  RteFsUtils::CreateTextFile(filenameRegular, bufferFoo);
+  EXPECT_TRUE(RteFsUtils::CopyMergeFile(filenameRegular, dst, 0, false));
+  EXPECT_TRUE(RteFsUtils::CmpFileMem(dst, bufferFoo));
+  EXPECT_FALSE(RteFsUtils::CopyMergeFile(pathInvalid, dst, 0, false));
+  RteFsUtils::RemoveFile(dst);
+  RteFsUtils::RemoveFile(dst + ".0000");
+  RteFsUtils::RemoveFile(filenameRegular);
+}
+
 TEST_F(RteFsUtilsTest, ExpandFile) {
   bool ret;
   string buffer;
@@ -20,6 +20,10 @@
 class RteDeviceItem;
 class RteDeviceProperty;
 typedef std::map<std::string, std::list<RteDeviceProperty*> > RteDevicePropertyMap;
+/**
+ * @brief flattened property table: contiguous arrays of properties grouped by tag, sorted by tag
+*/
+typedef std::vector<std::pair<std::string, std::vector<RteDeviceProperty*> > > RteEffectivePropertyTable;
 
 /**
  * @brief Base class to describe device-related data: device declaration and their properties
@@ -882,16 +886,22 @@ protected:
 struct RteEffectiveProperties
 {
   /**
-   * @brief return list of properties for given tag
+   * @brief return properties for given tag
    * @param tag property tag
-   * @return list of RteDeviceProperty pointers
+   * @return vector of RteDeviceProperty pointers
+  */
+  const std::vector<RteDeviceProperty*>& GetProperties(const std::string& tag) const;
+
+  /**
+   * @brief fill the flattened table from collected properties
+   * @param propertyMap map of tag to list of RteDeviceProperty pointers
   */
-  const std::list<RteDeviceProperty*>& GetProperties(const std::string& tag) const;
+  void Assign(const RteDevicePropertyMap& propertyMap);
 
   /**
-   * @brief full property collection: map of tag to list of RteDeviceProperty pointers
+   * @brief full property collection: tag to vector of RteDeviceProperty pointers, sorted by tag
   */
-  RteDevicePropertyMap m_propertyMap;
+  RteEffectivePropertyTable m_propertyTable;
 };
 
 
@@ -1019,17 +1029,27 @@ public:
   /**
    * @brief get all effective properties (inherited and overwritten) for given processor name
    * @param pName processor name
-   * @return map of device properties: property tag to list of RteDeviceProperty pointers pairs
+   * @return table of device properties: property tag to vector of RteDeviceProperty pointers pairs
   */
-  const RteDevicePropertyMap& GetEffectiveProperties(const std::string& pName);
+  const RteEffectivePropertyTable& GetEffectiveProperties(const std::string& pName);
 
   /**
-   * @brief get list of all effective properties for given tag and processor name
+   * @brief get all effective properties for given tag and processor name
    * @param tag property tag
    * @param pName processor name
-   * @return list of RteDeviceProperty pointers
+   * @return vector of RteDeviceProperty pointers
+  */
+  const std::vector<RteDeviceProperty*>& GetEffectiveProperties(const std::string& tag, const std::string& pName);
+
+  /**
+   * @brief collect effective properties for all processors if not done yet
+  */
+  void EnsureEffectiveProperties();
+
+  /**
+   * @brief collect effective properties for all end-leaf devices of this item, the item itself included
   */
-  const std::list<RteDeviceProperty*>& GetEffectiveProperties(const std::string& tag, const std::string& pName);
+  void EnsureEffectivePropertiesForLeaves();
 
   /**
    * @brief search for the first effective property for given tag and processor
@@ -1079,7 +1099,7 @@ protected:
    * @param parent pointer to parent XMLTreeElement for created items
    * @param properties list of properties to convert
   */
-  void CreateEffectiveXmlTreeElements(XMLTreeElement* parent, const std::list<RteDeviceProperty*>& properties);
+  void CreateEffectiveXmlTreeElements(XMLTreeElement* parent, const std::vector<RteDeviceProperty*>& properties);
 
   /**
    * @brief create a device item derived from RteDeviceItem class for given tag
@@ -25,6 +25,9 @@
 #include "RteBoard.h"
 #include "RteGenerator.h"
 
+#include <mutex>
+#include <unordered_map>
+
 class RteComponentGroup;
 class RteProject;
 
@@ -95,6 +98,18 @@ public:
   */
   void SetUseDeviceTree(bool bUse) { m_bUseDeviceTree = bUse; }
 
+  /**
+   * @brief check if effective device properties are collected eagerly when filling device tree
+   * @return true if effective properties of all devices are collected upfront
+  */
+  bool IsPrecomputeEffectiveProperties() const { return m_bPrecomputeEffectiveProperties; }
+
+  /**
+   * @brief setter for eager collection of effective device properties, useful for tools that visit all devices
+   * @param bPrecompute true to collect effective properties of all devices after filling device tree
+  */
+  void SetPrecomputeEffectiveProperties(bool bPrecompute) { m_bPrecomputeEffectiveProperties = bPrecompute; }
+
 public:
   /**
    * @brief getter for package given by the full package ID
@@ -174,6 +189,23 @@ public:
    */
   void GetCompatibleBoards(std::vector<RteBoard*>& boards, RteDeviceItem* device, bool bOnlyMounted = false) const;
 
+  /**
+   * @brief getter for devices compatible with given board
+   * @param devices collection of devices to fill
+   * @param board given RteBoard pointer
+   * @param bOnlyMounted flag to check only mounted devices
+  */
+  void GetCompatibleDevices(std::vector<RteDeviceItem*>& devices, RteBoard* board, bool bOnlyMounted = false) const;
+
+  /**
+   * @brief check if given board is compatible with given device
+   * @param board given RteBoard pointer
+   * @param device given RteDeviceItem pointer
+   * @param bOnlyMounted flag to check only mounted devices
+   * @return true if board has the device mounted or listed as compatible
+  */
+  bool IsBoardCompatible(RteBoard* board, RteDeviceItem* device, bool bOnlyMounted = false) const;
+
   /**
    * @brief find board given by the display name
    * @param displayName given display name
@@ -181,6 +213,19 @@ public:
   */
   RteBoard* FindBoard(const std::string& displayName) const;
 
+  /**
+   * @brief find boards given by the board name (revision is not considered)
+   * @param name given board name
+   * @param boards list of RteBoard pointers to fill, sorted as in board collection
+  */
+  void FindBoards(const std::string& name, std::list<RteBoard*>& boards) const;
+
+  /**
+   * @brief getter for boards grouped by board name
+   * @return reference to map of board name to list of RteBoard pointers
+  */
+  const std::unordered_map<std::string, std::list<RteBoard*> >& GetBoardNameIndex() const { return m_boardNameIndex; }
+
   /**
    * @brief find compatible board given by display name and device
    * @param displayName given display name
@@ -398,6 +443,19 @@ public:
   */
   RteDevice* GetDevice(const std::string& deviceName, const std::string& vendor) const;
 
+  /**
+   * @brief find devices and variants of all vendors given by the full device name
+   * @param fullDeviceName given device or variant name without processor
+   * @param devices list of RteDevice pointers to fill, sorted as returned by GetDevices()
+  */
+  void FindDevices(const std::string& fullDeviceName, std::list<RteDevice*>& devices) const;
+
+  /**
+   * @brief getter for devices and variants of all vendors grouped by full device name
+   * @return reference to map of full device name to list of RteDevice pointers
+  */
+  const std::unordered_map<std::string, std::list<RteDevice*> >& GetDeviceNameIndex() const { return m_deviceNameIndex; }
+
   /**
    * @brief getter for number devices
    * @return number of devices as integer
@@ -544,6 +602,19 @@ public:
 protected:
 
   void ClearDevices();
+  void FillDeviceIndexes();
+  void PrecomputeEffectiveProperties();
+
+  struct RteBoardCompatibility {
+    std::vector<RteBoard*> m_mounted; // boards with the device mounted
+    std::vector<RteBoard*> m_compatible; // boards with the device mounted or compatible
+  };
+  struct RteDeviceCompatibility {
+    std::vector<RteDeviceItem*> m_mounted; // devices mounted on the board
+    std::vector<RteDeviceItem*> m_compatible; // devices mounted on or compatible with the board
+  };
+  const RteBoardCompatibility& GetBoardCompatibility(RteDeviceItem* device) const;
+  const RteBoardCompatibility& FillBoardCompatibility(RteDeviceItem* device) const; // caller must lock m_compatibilityMutex
 
   virtual void FillComponentList(RtePackage* devicePackage);
   virtual void AddItemsFromPack(RtePackage* pack); // adds taxonomy, components, csolution related items
@@ -571,10 +642,23 @@ protected:
   std::map<std::string, RteDeviceVendor*> m_deviceVendors;
   RteDeviceItemAggregate* m_deviceTree;// vendor/family/subfamily/device/variant/processor
   bool m_bUseDeviceTree; // flag is set to true by Pack Installer, uVision does not use RteDeviceItemAggregate items any more
+  bool m_bPrecomputeEffectiveProperties; // collect effective properties of all devices in FillDeviceTree()
 
   // boards
   RteBoardMap m_boards;
 
+  // lookup indexes, rebuilt by FillDeviceTree()
+  std::unordered_map<std::string, std::pair<RteDeviceVendor*, RteDevice*> > m_deviceIndex; // device/variant name to first device
+  std::unordered_map<std::string, std::list<RteDevice*> > m_deviceNameIndex; // full device name to devices of all vendors
+  std::unordered_map<std::string, RteBoard*> m_boardDisplayNameIndex;
+  std::unordered_map<std::string, std::list<RteBoard*> > m_boardNameIndex;
+
+  // board <-> device compatibility, filled on demand and cleared together with devices
+  mutable std::mutex m_compatibilityMutex; // the model can be queried from several threads
+  mutable std::unordered_map<RteDeviceItem*, RteBoardCompatibility> m_boardCompatibility;
+  mutable std::unordered_map<RteBoard*, RteDeviceCompatibility> m_deviceCompatibility;
+  mutable bool m_bDeviceCompatibilityComplete;
+
   // packs
   RtePackageMap m_packages; // sorted package map (full id to package, latest versions first)
   RtePackageMap m_latestPackages; // latests packages (common id to package)
@@ -317,13 +317,21 @@ public:
   const std::map<std::string, RteFileInstance*>& GetFileInstances() const { return m_files; }
 
   /**
-   * @brief get collection of file instances for a given component instance and target
+   * @brief get collection of file instances for a given component instance and target,
+   *        only files indexed for the component aggregate of the instance are checked
    * @param ci given RteComponentInstance object
    * @param targetName given target name
    * @param configFiles collection to fill: the original file path to RteFileInstance (one entry per multi-instance component),
   */
   void GetFileInstancesForComponent(RteComponentInstance* ci, const std::string& targetName, std::map<std::string, RteFileInstance*>& configFiles) const;
 
+  /**
+   * @brief get file instances indexed for a given component aggregate
+   * @param componentAggregateId given component aggregate ID
+   * @return pointer to collection of instance pathname to RteFileInstance, nullptr if no file belongs to the aggregate
+  */
+  const std::map<std::string, RteFileInstance*>* GetComponentAggregateFileInstances(const std::string& componentAggregateId) const;
+
   /**
    * @brief get RteComponentInstanceGroup object
    * @return RteComponentInstanceGroup pointer
@@ -907,6 +915,9 @@ protected:
   RteFileInstance* AddFileInstance(RteComponentInstance* ci, RteFile* f, int index, RteTarget* target);
   bool RemoveFileInstance(const std::string& id);
   void DeleteFileInstance(RteFileInstance* fi);
+  // (re)inserts file instance into component file index using its current component aggregate ID
+  void IndexFileInstance(RteFileInstance* fi);
+  void UnindexFileInstance(RteFileInstance* fi);
   // initializes or updates (newer version is used) existing file instance
   void InitFileInstance(RteFileInstance* fi, RteFile* f, int index, RteTarget* target, const std::string& savedVersion, const std::string& rteFolder);
   bool UpdateFileInstance(RteFileInstance* fi, RteFile* f, bool bMerge, bool bUpdateComponent);
@@ -928,6 +939,8 @@ protected:
 
   std::map<std::string, RteComponentInstance*> m_components; // project components: we can only have unique ones
   std::map<std::string, RteFileInstance*> m_files; // flat std::list of copied and referenced (e.g. DOC) files. Key: instance pathname (to project path for copied ones)
+  std::map<std::string, std::map<std::string, RteFileInstance*>> m_componentFiles; // file instances indexed by component aggregate ID and instance pathname
+  std::map<RteFileInstance*, std::string> m_fileComponentKeys; // file instance to its key in m_componentFiles
 
   RteItemInstance* m_packFilterInfos;
   std::map<std::string, RtePackageInstanceInfo*> m_filteredPackages; // packs filters saved in project
@@ -20,6 +20,8 @@
 #include "RteBoard.h"
 #include "RtePackage.h"
 
+#include <functional>
+
 class RteComponentInstance;
 class RteFileInstance;
 class RteBoardInfo;
@@ -584,6 +586,7 @@ public:
 
   /**
    * @brief generate header files specific to selected components, e.g. Pre_Include_Global.h, RTE_Components.h
+   *        headers whose inputs are unchanged since the last generation and which are not modified on disk are skipped
    * @return true if generation of header files is successful
   */
   bool GenerateRteHeaders();
@@ -600,6 +603,8 @@ protected:
   bool GenerateRTEComponentsH();
   bool GenerateRteHeaderFile(const std::string& headerName, const std::string& content,
                               bool bRegionsHeader = false, const std::string& directory = EMPTY_STRING);
+  // generates RTE header unless its digest matches the last generated one, content is only constructed if needed
+  bool GenerateRteHeader(const std::string& headerName, uint64_t inputsDigest, const std::function<std::string()>& getContent);
 
   // instance operations
 public:
@@ -1086,6 +1091,7 @@ protected:
   std::set<std::string> m_RTE_Component_h; // defines put into the file
   std::set<std::string> m_PreIncludeGlobal; // defines put into the global pre-include file
   std::map<RteComponent*, std::string> m_PreIncludeLocal; // defines put into the local pre-include file component->pre-include content
+  std::map<std::string, std::pair<uint64_t, int64_t> > m_rteHeaderDigests; // generated header file -> digest of its inputs and file modification time
 
   std::set<std::string> m_gpdscFileNames;
 
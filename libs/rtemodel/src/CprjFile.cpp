@@ -156,11 +156,8 @@ void CprjTargetElement::CollectEffectiveProperties(const string& procName)
   }
 
   // merge properties and attributes from the device
-  const RteDevicePropertyMap& propMap = m_device->GetEffectiveProperties(procName);
-  RteDevicePropertyMap::const_iterator itpm; // iterate through properties:
-  for (itpm = propMap.begin(); itpm != propMap.end(); ++itpm) {
-    const string& propType = itpm->first; // processor, feature, memory, etc.
-    const list<RteDeviceProperty*>& props = itpm->second;
+  const RteEffectivePropertyTable& propTable = m_device->GetEffectiveProperties(procName);
+  for (auto& [propType, props] : propTable) { // processor, feature, memory, etc.
     if (m_effectiveProperties.find(propType) == m_effectiveProperties.end()) {
       m_effectiveProperties[propType] = list<RteDeviceProperty*>();
     }
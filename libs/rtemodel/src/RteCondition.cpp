@@ -16,6 +16,7 @@
 #include "RtePackage.h"
 #include "RteModel.h"
 
+#include "Tracer.h"
 #include "XMLTree.h"
 
 #include <sstream>
@@ -1034,6 +1035,7 @@ const set<RteComponentAggregate*>& RteDependencySolver::GetComponentAggregates(R
 
 RteItem::ConditionResult RteDependencySolver::EvaluateDependencies()
 {
+  TraceSpan span("RteDependencySolver::EvaluateDependencies", "rte");
   Clear();
   const map<RteComponentAggregate*, int>& selectedComponents = m_target->GetSelectedComponentAggregates();
   for (auto [a, n] : selectedComponents) {
@@ -1046,6 +1048,7 @@ RteItem::ConditionResult RteDependencySolver::EvaluateDependencies()
 
 RteItem::ConditionResult RteDependencySolver::ResolveDependencies()
 {
+  TraceSpan span("RteDependencySolver::ResolveDependencies", "rte");
   for (RteItem::ConditionResult res = GetConditionResult(); res < RteItem::FULFILLED; res = GetConditionResult()) {
     if (ResolveIteration() == false)
       break;
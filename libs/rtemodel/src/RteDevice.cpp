@@ -22,6 +22,7 @@
 using namespace std;
 
 static const list<RteDeviceProperty*> EMPTY_PROPERTY_LIST;
+static const vector<RteDeviceProperty*> EMPTY_PROPERTY_VECTOR;
 
 const string& RteDeviceElement::GetEffectiveAttribute(const string& name) const
 {
@@ -737,62 +738,84 @@ void RteDeviceItem::CollectEffectiveProperties(RteDevicePropertyMap& properties,
 
 void RteDeviceItem::CollectEffectiveProperties(const string& pName)
 {
-  m_effectiveProperties[pName] = RteEffectiveProperties();
-  auto it = m_effectiveProperties.find(pName);
-  RteDevicePropertyMap& pmap = it->second.m_propertyMap;
+  RteDevicePropertyMap pmap;
   CollectEffectiveProperties(pmap, pName);
-  for (auto [_, l] : pmap) {
+  for (auto& [_, l] : pmap) {
     for (auto p : l) {
       p->CalculateCachedValues();
     }
   }
+  m_effectiveProperties[pName].Assign(pmap);
 }
 
 
-const list<RteDeviceProperty*>& RteEffectiveProperties::GetProperties(const string& tag) const {
-  auto it = m_propertyMap.find(tag);
-  if (it != m_propertyMap.end()) {
+void RteEffectiveProperties::Assign(const RteDevicePropertyMap& propertyMap)
+{
+  // map is already sorted by tag: table preserves the order
+  m_propertyTable.clear();
+  m_propertyTable.reserve(propertyMap.size());
+  for (auto& [tag, l] : propertyMap) {
+    m_propertyTable.emplace_back(tag, vector<RteDeviceProperty*>(l.begin(), l.end()));
+  }
+}
+
+const vector<RteDeviceProperty*>& RteEffectiveProperties::GetProperties(const string& tag) const {
+  auto it = lower_bound(m_propertyTable.begin(), m_propertyTable.end(), tag,
+    [](const RteEffectivePropertyTable::value_type& entry, const string& t) { return entry.first < t; });
+  if (it != m_propertyTable.end() && it->first == tag) {
     return it->second;
   }
-  return EMPTY_PROPERTY_LIST;
+  return EMPTY_PROPERTY_VECTOR;
 }
 
 
-const RteDevicePropertyMap& RteDeviceItem::GetEffectiveProperties(const string& pName)
+void RteDeviceItem::EnsureEffectiveProperties()
 {
   if (m_effectiveProperties.empty()) {
     for (auto [pn, p] : m_processors) {
       CollectEffectiveProperties(pn);
     }
   }
+}
+
+void RteDeviceItem::EnsureEffectivePropertiesForLeaves()
+{
+  list<RteDeviceItem*> devices;
+  GetEffectiveDeviceItems(devices);
+  for (auto d : devices) {
+    d->EnsureEffectiveProperties();
+  }
+}
+
+const RteEffectivePropertyTable& RteDeviceItem::GetEffectiveProperties(const string& pName)
+{
+  EnsureEffectiveProperties();
 
   auto itp = m_effectiveProperties.find(pName);
   if (itp != m_effectiveProperties.end()) {
-    return itp->second.m_propertyMap;
+    return itp->second.m_propertyTable;
   }
 
-  static const RteDevicePropertyMap EMPTY_PROPERTY_MAP;
-  return EMPTY_PROPERTY_MAP;
+  static const RteEffectivePropertyTable EMPTY_PROPERTY_TABLE;
+  return EMPTY_PROPERTY_TABLE;
 }
 
-const list<RteDeviceProperty*>& RteDeviceItem::GetEffectiveProperties(const string& tag, const string& pName)
+const vector<RteDeviceProperty*>& RteDeviceItem::GetEffectiveProperties(const string& tag, const string& pName)
 {
-  if (m_effectiveProperties.empty()) {
-    GetEffectiveProperties(pName);
-  }
+  EnsureEffectiveProperties();
   auto itp = m_effectiveProperties.find(pName);
   if (itp != m_effectiveProperties.end()) {
     const RteEffectiveProperties& effectiveProps = itp->second;
     return effectiveProps.GetProperties(tag);
   }
-  return EMPTY_PROPERTY_LIST;
+  return EMPTY_PROPERTY_VECTOR;
 }
 
 RteDeviceProperty* RteDeviceItem::GetSingleEffectiveProperty(const string& tag, const string& pName)
 {
-  const list<RteDeviceProperty*>& props = GetEffectiveProperties(tag, pName);
+  const vector<RteDeviceProperty*>& props = GetEffectiveProperties(tag, pName);
   if (!props.empty())
-    return *props.begin();
+    return props.front();
   return nullptr;
 }
 
@@ -835,20 +858,13 @@ XMLTreeElement* RteDeviceItem::CreateEffectiveXmlTree(const string& pname, XMLTr
     device->AddAttribute("Dname", GetName());
   }
 
-  const RteDevicePropertyMap& effectivePropMap = GetEffectiveProperties(pname);
+  const RteEffectivePropertyTable& effectiveProps = GetEffectiveProperties(pname);
   // first insert "processor" element to be conformant with PACK.xsd
-  auto it = effectivePropMap.find("processor");
-  if(it != effectivePropMap.end()) {
-    CreateEffectiveXmlTreeElements(device, it->second);
-  }
+  CreateEffectiveXmlTreeElements(device, GetEffectiveProperties("processor", pname));
   // second insert "debugconfig" element to be conformant with PACK.xsd
-  it = effectivePropMap.find("debugconfig");
-  if(it != effectivePropMap.end()) {
-    CreateEffectiveXmlTreeElements(device, it->second);
-  }
+  CreateEffectiveXmlTreeElements(device, GetEffectiveProperties("debugconfig", pname));
   // all remaining properties
-  for(it = effectivePropMap.begin(); it != effectivePropMap.end() ; ++it) {
-    const auto& propGroupName = it->first;
+  for(auto& [propGroupName, props] : effectiveProps) {
     if(propGroupName == "processor" || propGroupName == "debugconfig"){
       continue; // already inserted
     }
@@ -857,12 +873,12 @@ XMLTreeElement* RteDeviceItem::CreateEffectiveXmlTree(const string& pname, XMLTr
       // all "sequence" elements  must be enclosed into a "sequences" tag
        groupParent = device->CreateElement("sequences");
     }
-    CreateEffectiveXmlTreeElements(groupParent, it->second);
+    CreateEffectiveXmlTreeElements(groupParent, props);
   }
   return packElement;
 }
 
-void RteDeviceItem::CreateEffectiveXmlTreeElements(XMLTreeElement* parent, const list<RteDeviceProperty*>& properties)
+void RteDeviceItem::CreateEffectiveXmlTreeElements(XMLTreeElement* parent, const vector<RteDeviceProperty*>& properties)
 {
   for (auto p : properties) {
     p->CreateXmlTreeElement(parent);
@@ -1159,7 +1175,8 @@ string RteDeviceItemAggregate::GetSummaryString() const
   item->GetEffectiveProcessors(processors);
 
   // Make a copy, simpler to merge with potential processor specific memories
-  list<RteDeviceProperty*> mems = item->GetEffectiveProperties("memory", RteUtils::EMPTY_STRING);
+  const vector<RteDeviceProperty*>& effectiveMems = item->GetEffectiveProperties("memory", RteUtils::EMPTY_STRING);
+  list<RteDeviceProperty*> mems(effectiveMems.begin(), effectiveMems.end());
 
   // Iterate over processors
   for (auto it = processors.begin(); it != processors.end(); ++it) {
@@ -1190,7 +1207,7 @@ string RteDeviceItemAggregate::GetSummaryString() const
     }
 
     // Collect unique memory attributes
-    const list<RteDeviceProperty*>& procMems = item->GetEffectiveProperties("memory", procProperties->GetAttribute("Pname"));
+    const vector<RteDeviceProperty*>& procMems = item->GetEffectiveProperties("memory", procProperties->GetAttribute("Pname"));
     list<RteDeviceProperty*> addMems;
     for (auto procMemIt = procMems.begin(); procMemIt != procMems.end(); ++procMemIt) {
       auto memsIt = mems.begin();
@@ -20,6 +20,7 @@
 
 #include "RteUtils.h"
 #include "RteFsUtils.h"
+#include "Tracer.h"
 #include "RteConstants.h"
 
 #include "XmlFormatter.h"
@@ -321,6 +322,7 @@ bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<Rte
   if(pdscFiles.empty()) {
     return success;
   }
+  TraceSpan span("RteKernel::LoadPacks", "rte");
   if(!model) {
     model = GetGlobalModel();
   }
@@ -336,6 +338,7 @@ bool RteKernel::LoadPacks(const std::list<std::string>& pdscFiles, std::list<Rte
       packs.push_back(pack);
       continue;
     }
+    TraceSpan pdscSpan("LoadPdsc", "rte", pdscFile);
     bool result = xmlTree->AddFileName(pdscFile, true);
     pack = rteItemBuilder->GetPack();
     if(!result || !pack) {
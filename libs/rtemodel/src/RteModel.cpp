@@ -18,11 +18,13 @@
 #include "RteProject.h"
 #include "CprjFile.h"
 
+#include "JobPool.h"
 #include "RteFsUtils.h"
 #include "RteConstants.h"
 
 #include "XMLTree.h"
 
+
 using namespace std;
 
 //////////////////////////////////////////////////////////
@@ -32,6 +34,8 @@ RteModel::RteModel(RteItem* parent, PackageState packageState) :
   m_callback(NULL),
   m_apiList(VersionCmp::Greater(RteConstants::PREFIX_CVERSION_CHAR)),
   m_bUseDeviceTree(true),
+  m_bPrecomputeEffectiveProperties(false),
+  m_bDeviceCompatibilityComplete(false),
   m_filterContext(NULL)
 {
   m_deviceTree = new RteDeviceItemAggregate("DeviceList", RteDeviceItem::VENDOR_LIST, NULL);
@@ -44,6 +48,8 @@ RteModel::RteModel(PackageState packageState) :
   m_packageState(packageState),
   m_callback(NULL),
   m_bUseDeviceTree(false),
+  m_bPrecomputeEffectiveProperties(false),
+  m_bDeviceCompatibilityComplete(false),
   m_filterContext(NULL)
 {
   m_deviceTree = new RteDeviceItemAggregate("DeviceList", RteDeviceItem::VENDOR_LIST, NULL);
@@ -90,6 +96,14 @@ void RteModel::ClearDevices()
   m_deviceVendors.clear();
   m_deviceTree->Clear();
   m_boards.clear();
+
+  m_deviceIndex.clear();
+  m_deviceNameIndex.clear();
+  m_boardDisplayNameIndex.clear();
+  m_boardNameIndex.clear();
+  m_boardCompatibility.clear();
+  m_deviceCompatibility.clear();
+  m_bDeviceCompatibilityComplete = false;
 }
 
 
@@ -146,14 +160,15 @@ RtePackage* RteModel::GetPackage(const XmlItem& attr) const
   if (versionRange.empty()) {
     return pack; // version is not provided => the latest
   }
-  if (VersionCmp::RangeCompare(pack->GetVersionString(), versionRange) == 0)
+  const VersionCmp::Range range(versionRange);
+  if (range.Compare(pack->GetVersionString()) == 0)
     return pack; // the latest matches the range
 
   for (auto itp = m_packages.begin(); itp != m_packages.end(); ++itp) {
     pack = itp->second;
     if (pack->GetPackageID(false) != commonId)
       continue;
-    if (VersionCmp::RangeCompare(pack->GetVersionString(), versionRange) == 0)
+    if (range.Compare(pack->GetVersionString()) == 0)
       return pack; // the latest matches the range
   }
   return NULL;
@@ -161,12 +176,51 @@ RtePackage* RteModel::GetPackage(const XmlItem& attr) const
 
 RteBoard* RteModel::FindBoard(const string& displayName) const
 {
+  auto it = m_boardDisplayNameIndex.find(displayName);
+  if (it != m_boardDisplayNameIndex.end()) {
+    return it->second;
+  }
+  return nullptr;
+}
+
+void RteModel::FindBoards(const string& name, list<RteBoard*>& boards) const
+{
+  auto it = m_boardNameIndex.find(name);
+  if (it != m_boardNameIndex.end()) {
+    boards.insert(boards.end(), it->second.begin(), it->second.end());
+  }
+}
+
+const RteModel::RteBoardCompatibility& RteModel::GetBoardCompatibility(RteDeviceItem* device) const
+{
+  // entries are never modified once filled: the reference stays valid after unlocking
+  lock_guard<mutex> lock(m_compatibilityMutex);
+  return FillBoardCompatibility(device);
+}
+
+const RteModel::RteBoardCompatibility& RteModel::FillBoardCompatibility(RteDeviceItem* device) const
+{
+  auto it = m_boardCompatibility.find(device);
+  if (it != m_boardCompatibility.end()) {
+    return it->second;
+  }
+  RteBoardCompatibility& entry = m_boardCompatibility[device];
+  XmlItem ea;
+  device->GetEffectiveAttributes(ea);
   for (auto [_, b] : GetBoards()) {
-    if (b->GetDisplayName() == displayName) {
-      return b;
+    bool bMounted = b->HasCompatibleDevice(ea, true);
+    if (!bMounted && !b->HasCompatibleDevice(ea, false)) {
+      continue;
+    }
+    RteDeviceCompatibility& reverse = m_deviceCompatibility[b];
+    if (bMounted) {
+      entry.m_mounted.push_back(b);
+      reverse.m_mounted.push_back(device);
     }
+    entry.m_compatible.push_back(b);
+    reverse.m_compatible.push_back(device);
   }
-  return nullptr;
+  return entry;
 }
 
 void RteModel::GetCompatibleBoards(vector<RteBoard*>& boards, RteDeviceItem* device, bool bOnlyMounted) const
@@ -174,23 +228,52 @@ void RteModel::GetCompatibleBoards(vector<RteBoard*>& boards, RteDeviceItem* dev
   if (!device) {
     return;
   }
-  XmlItem ea;
-  device->GetEffectiveAttributes(ea);
-  for (auto [_, b] : GetBoards()) {
-    if (b->HasCompatibleDevice(ea, bOnlyMounted)) {
-      boards.push_back(b);
+  const RteBoardCompatibility& entry = GetBoardCompatibility(device);
+  const vector<RteBoard*>& compatibleBoards = bOnlyMounted ? entry.m_mounted : entry.m_compatible;
+  boards.insert(boards.end(), compatibleBoards.begin(), compatibleBoards.end());
+}
+
+void RteModel::GetCompatibleDevices(vector<RteDeviceItem*>& devices, RteBoard* board, bool bOnlyMounted) const
+{
+  if (!board) {
+    return;
+  }
+  // reverse entries grow while devices are evaluated: copy them under the lock
+  lock_guard<mutex> lock(m_compatibilityMutex);
+  if (!m_bDeviceCompatibilityComplete) {
+    // the reverse table is only complete when all devices have been evaluated
+    set<RteDevice*> processed;
+    for (auto [_, dv] : m_deviceVendors) {
+      for (auto [_, d] : dv->GetDevices()) {
+        if (processed.insert(d).second) {
+          FillBoardCompatibility(d);
+        }
+      }
     }
+    m_bDeviceCompatibilityComplete = true;
+  }
+  auto it = m_deviceCompatibility.find(board);
+  if (it != m_deviceCompatibility.end()) {
+    const vector<RteDeviceItem*>& compatibleDevices = bOnlyMounted ? it->second.m_mounted : it->second.m_compatible;
+    devices.insert(devices.end(), compatibleDevices.begin(), compatibleDevices.end());
+  }
+}
+
+bool RteModel::IsBoardCompatible(RteBoard* board, RteDeviceItem* device, bool bOnlyMounted) const
+{
+  if (!board || !device) {
+    return false;
   }
+  const RteBoardCompatibility& entry = GetBoardCompatibility(device);
+  const vector<RteBoard*>& compatibleBoards = bOnlyMounted ? entry.m_mounted : entry.m_compatible;
+  return find(compatibleBoards.begin(), compatibleBoards.end(), board) != compatibleBoards.end();
 }
 
 RteBoard* RteModel::FindCompatibleBoard(const string& displayName, RteDeviceItem* device, bool bOnlyMounted) const
 {
-  vector<RteBoard*> boards;
-  GetCompatibleBoards(boards, device, bOnlyMounted);
-  for (auto b : boards) {
-    if (b->GetDisplayName() == displayName) {
-      return b;
-    }
+  RteBoard* b = FindBoard(displayName);
+  if (b && IsBoardCompatible(b, device, bOnlyMounted)) {
+    return b;
   }
   return nullptr;
 }
@@ -691,17 +774,33 @@ RteDevice* RteModel::GetDevice(const string& deviceName, const string& vendor) c
 
     }
   } else {
-    for (auto [_, dv] : m_deviceVendors) {
-      RteDevice* d = dv->GetDevice(deviceName);
-      if (d)
-        return d;
+    // use the index instead of asking each vendor, the first vendor in sorted order wins
+    auto it = m_deviceIndex.find(deviceName);
+    const pair<RteDeviceVendor*, RteDevice*>* entry = it != m_deviceIndex.end() ? &(it->second) : nullptr;
+    // try without processor name if specified
+    string name = RteUtils::GetPrefix(deviceName);
+    if (name != deviceName) {
+      auto itp = m_deviceIndex.find(name);
+      if (itp != m_deviceIndex.end() && (!entry || itp->second.first->GetName() < entry->first->GetName())) {
+        entry = &(itp->second);
+      }
     }
+    if (entry)
+      return entry->second;
   }
   if (IsUseDeviceTree())
     return dynamic_cast<RteDevice*>(m_deviceTree->GetDeviceItem(deviceName, vendor));
   return NULL;
 }
 
+void RteModel::FindDevices(const string& fullDeviceName, list<RteDevice*>& devices) const
+{
+  auto it = m_deviceNameIndex.find(fullDeviceName);
+  if (it != m_deviceNameIndex.end()) {
+    devices.insert(devices.end(), it->second.begin(), it->second.end());
+  }
+}
+
 int RteModel::GetDeviceCount() const
 {
   int count = 0;
@@ -745,15 +844,59 @@ void RteModel::FillDeviceTree()
     FillDeviceTree(package);
   }
 
-  if (!bHasDeprecated)
-    return;
-  for (auto [id, package] :  m_latestPackages) {
-    if (!package)
-      continue;
-    if (!package->IsDeprecated()) {
+  if (bHasDeprecated) {
+    for (auto [id, package] : m_latestPackages) {
+      if (!package)
+        continue;
+      if (!package->IsDeprecated()) {
+        continue;
+      }
+      FillDeviceTree(package);
+    }
+  }
+  FillDeviceIndexes();
+  if (IsPrecomputeEffectiveProperties()) {
+    PrecomputeEffectiveProperties();
+  }
+}
+
+void RteModel::PrecomputeEffectiveProperties()
+{
+  vector<RteDeviceItem*> families;
+  for (auto [id, package] : m_latestPackages) {
+    RteDeviceFamilyContainer* container = package ? package->GetDeviceFamiles() : nullptr;
+    if (!container)
       continue;
+    for (auto child : container->GetChildren()) {
+      RteDeviceFamily* fam = dynamic_cast<RteDeviceFamily*>(child);
+      if (fam) {
+        families.push_back(fam);
+      }
     }
-    FillDeviceTree(package);
+  }
+  // collecting effective properties merges attributes of parent items into properties of child items,
+  // families do not share any items: process them concurrently, but each family in a single thread
+  JobPool::Run(families.size(), [&families](size_t i) {
+    families[i]->EnsureEffectivePropertiesForLeaves();
+  });
+}
+
+void RteModel::FillDeviceIndexes()
+{
+  // keep the order of sorted collections: the first entry wins like in a sequential search
+  for (auto [_, dv] : m_deviceVendors) {
+    for (auto [name, d] : dv->GetDevices()) {
+      m_deviceIndex.emplace(name, make_pair(dv, d));
+    }
+  }
+  list<RteDevice*> devices;
+  GetDevices(devices, "", "", RteDeviceItem::VARIANT);
+  for (auto d : devices) {
+    m_deviceNameIndex[d->GetFullDeviceName()].push_back(d);
+  }
+  for (auto [_, b] : m_boards) {
+    m_boardDisplayNameIndex.emplace(b->GetDisplayName(), b);
+    m_boardNameIndex[b->GetName()].push_back(b);
   }
 }
 
@@ -795,9 +938,9 @@ void RteModel::GetBoardBooks(map<string, string>& books, const string& device, c
   RteDevice* d = GetDevice(device, vendor);
   if (!d)
     return;
-  XmlItem ea;
-  d->GetEffectiveAttributes(ea);
-  GetBoardBooks(books, ea.GetAttributes());
+  for (auto b : GetBoardCompatibility(d).m_compatible) {
+    b->GetBooks(books);
+  }
 }
 
 void RteModel::GetBoardBooks(map<string, string>& books, const map<string, string>& deviceAttributes) const
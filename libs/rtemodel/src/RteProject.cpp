@@ -188,6 +188,8 @@ void RteProject::Clear()
   m_components.clear();
   m_projectPath.clear();
   m_files.clear();
+  m_componentFiles.clear();
+  m_fileComponentKeys.clear();
   m_forcedFiles.clear();
   ClearFilteredPackages();
 
@@ -342,7 +344,15 @@ RteFileInstance* RteProject::GetFileInstance(const string& id) const
 
 void RteProject::GetFileInstancesForComponent(RteComponentInstance* ci, const string& targetName, map<string, RteFileInstance*>& configFiles) const
 {
-  for (auto [id, fi] : m_files) {
+  if (!ci) {
+    return;
+  }
+  // a file instance belongs to a component instance of the same aggregate
+  const map<string, RteFileInstance*>* files = GetComponentAggregateFileInstances(ci->GetComponentAggregateID());
+  if (!files) {
+    return;
+  }
+  for (auto [id, fi] : *files) {
     if (!fi->IsUsedByTarget(targetName))
       continue;
     if (fi->GetComponentInstance(targetName) != ci)
@@ -352,6 +362,12 @@ void RteProject::GetFileInstancesForComponent(RteComponentInstance* ci, const st
   }
 }
 
+const map<string, RteFileInstance*>* RteProject::GetComponentAggregateFileInstances(const string& componentAggregateId) const
+{
+  auto it = m_componentFiles.find(componentAggregateId);
+  return it != m_componentFiles.end() ? &(it->second) : nullptr;
+}
+
 
 RteComponentInstance* RteProject::AddComponent(RteComponent* c, int instanceCount, RteTarget* target, RteComponentInstance* oldInstance)
 {
@@ -597,6 +613,7 @@ void RteProject::InitFileInstance(RteFileInstance* fi, RteFile* f, int index, Rt
   fi->Update(f, false);
   fi->AddTargetInfo(targetName); // set/update supported targets
   fi->SetRemoved(false);
+  IndexFileInstance(fi);
   string absPath = fi->GetAbsolutePath();
   bool bExists = RteFsUtils::Exists(absPath);
   if (bExists) {
@@ -638,6 +655,9 @@ bool RteProject::UpdateFileInstance(RteFileInstance* fi, RteFile* f, bool bMerge
     }
   }
   fi->Update(f, bUpdateComponent); // for an existing file, update its origin
+  if (bUpdateComponent) {
+    IndexFileInstance(fi);
+  }
 
   return true;
 }
@@ -740,6 +760,7 @@ bool RteProject::RemoveFileInstance(const string& id)
     } else {
       RemoveItem(fi);
       m_files.erase(it);
+      UnindexFileInstance(fi);
       delete fi;
       return true;
     }
@@ -755,9 +776,40 @@ void RteProject::DeleteFileInstance(RteFileInstance* fi) {
   if (it != m_files.end()) {
     m_files.erase(it);
   }
+  UnindexFileInstance(fi);
   RemoveChild(fi, true);
 }
 
+void RteProject::IndexFileInstance(RteFileInstance* fi)
+{
+  const string key = fi->GetComponentAggregateID();
+  auto it = m_fileComponentKeys.find(fi);
+  if (it != m_fileComponentKeys.end()) {
+    if (it->second == key) {
+      return;
+    }
+    UnindexFileInstance(fi);
+  }
+  m_componentFiles[key][fi->GetID()] = fi;
+  m_fileComponentKeys[fi] = key;
+}
+
+void RteProject::UnindexFileInstance(RteFileInstance* fi)
+{
+  auto it = m_fileComponentKeys.find(fi);
+  if (it == m_fileComponentKeys.end()) {
+    return;
+  }
+  auto itc = m_componentFiles.find(it->second);
+  if (itc != m_componentFiles.end()) {
+    itc->second.erase(fi->GetID());
+    if (itc->second.empty()) {
+      m_componentFiles.erase(itc);
+    }
+  }
+  m_fileComponentKeys.erase(it);
+}
+
 
 void RteProject::AddGeneratedComponents()
 {
@@ -2273,6 +2325,7 @@ void RteProject::Construct()
     RteFileInstance* fi = dynamic_cast<RteFileInstance*>(child);
     if (fi) {
       m_files[fi->GetID()] = fi;
+      IndexFileInstance(fi);
     }
   }
   UpdateClasses();
@@ -19,6 +19,7 @@
 #include "RteModel.h"
 #include "RteFsUtils.h"
 #include "RteConstants.h"
+#include "Tracer.h"
 
 #include <fstream>
 #include <sstream>
@@ -37,6 +38,15 @@ static const string szDefaultRteCh = "\n"                   \
 " *      *** Do not modify ! ***\n"  \
 " *\n";
 
+static constexpr int64_t NO_FILE_STAMP = -1;
+
+static int64_t GetFileStamp(const string& fileName)
+{
+  error_code ec;
+  const auto time = fs::last_write_time(fileName, ec);
+  return ec ? NO_FILE_STAMP : static_cast<int64_t>(time.time_since_epoch().count());
+}
+
 
 static map<string, RteFileInfo> EMPTY_STRING_TO_INSTANCE_MAP;
 
@@ -638,13 +648,10 @@ void RteTarget::AddDeviceProperties(RteDeviceItem* d, const string& processorNam
 
   string packagePath = RteUtils::ExtractFilePath(package->GetPackageFileName(), true);
   // get properties for given processor:
-  const RteDevicePropertyMap& propMap = d->GetEffectiveProperties(processorName);
+  const RteEffectivePropertyTable& propTable = d->GetEffectiveProperties(processorName);
 
-  for (auto itpm = propMap.begin(); itpm != propMap.end(); ++itpm) {
-    const string& propType = itpm->first; // processor, feature, mamory, etc.
-    const list<RteDeviceProperty*>& props = itpm->second;
-    for (auto itp = props.begin(); itp != props.end(); ++itp) {
-      RteDeviceProperty *p = *itp;
+  for (auto& [propType, props] : propTable) { // processor, feature, mamory, etc.
+    for (auto p : props) {
       if (propType == "compile") { // get any attributes, for example compile
         const string& header = p->GetAttribute("header");
         if (!header.empty()) {
@@ -1321,6 +1328,7 @@ void RteTarget::UpdateFilterModel()
 {
   if (!IsTargetSupported())
     return;
+  TraceSpan span("RteTarget::UpdateFilterModel", "rte", GetName());
 
   ClearFilteredComponents();
   m_filteredModel->SetFilterContext(GetFilterContext());
@@ -1333,6 +1341,7 @@ void RteTarget::UpdateFilterModel()
 
 void RteTarget::FilterComponents()
 {
+  TraceSpan span("RteTarget::FilterComponents", "rte", GetName());
   RteComponent* deviceStartup = 0;
 
   RteProject* p = GetProject();
@@ -1788,7 +1797,8 @@ std::string RteTarget::GenerateRegionsHeaderContent() const
   // get memory collections from device and board
   Collection<RteDeviceProperty*> deviceMemCollection;
   Collection<RteItem*> boardMemCollection;
-  deviceMemCollection = device->GetEffectiveProperties("memory", GetProcessorName());
+  const vector<RteDeviceProperty*>& deviceMems = device->GetEffectiveProperties("memory", GetProcessorName());
+  deviceMemCollection.assign(deviceMems.begin(), deviceMems.end());
   RteBoard* board = GetBoard();
   if (board) {
     board->GetMemories(boardMemCollection);
@@ -1923,24 +1933,31 @@ bool RteTarget::GenerateRteHeaders() {
     return false;
   }
 
-  string content;
   const set<string>& strings = GetGlobalPreIncludeStrings();
-  for (auto s : strings) {
-    content += s + RteUtils::LF_STRING;
-  }
-
-  if (!content.empty()) {
-    GenerateRteHeaderFile("Pre_Include_Global.h", content);
+  if (!strings.empty()) {
+    uint64_t digest = RteUtils::FNV_OFFSET;
+    for (auto& s : strings) {
+      RteUtils::HashString(digest, s);
+    }
+    GenerateRteHeader("Pre_Include_Global.h", digest, [&strings]() {
+      string content;
+      for (auto& s : strings) {
+        content += s + RteUtils::LF_STRING;
+      }
+      return content;
+    });
   }
 
   const map<RteComponent*, string>& locals = GetLocalPreIncludeStrings();
-  for (auto entry : locals) {
+  for (auto& entry : locals) {
     RteComponent* c = entry.first;
     if (!c || entry.second.empty()) {
       continue;
     }
     string fileName = c->ConstructComponentPreIncludeFileName();
-    GenerateRteHeaderFile(fileName, entry.second);
+    uint64_t digest = RteUtils::FNV_OFFSET;
+    RteUtils::HashString(digest, entry.second);
+    GenerateRteHeader(fileName, digest, [&entry]() { return entry.second; });
   }
   return true;
 }
@@ -1950,20 +1967,60 @@ bool RteTarget::GenerateRTEComponentsH() {
   if(GetSelectedComponentAggregates().empty()) {
     return true;  // no components selected
   }
-  string content;
   const string& devheader = GetDeviceHeader();
-  if (!devheader.empty()) {            // found device header file.
-    content += szDevHdr;
-    content += "\"" + devheader + "\"" + RteUtils::LF_STRING + RteUtils::LF_STRING;
+  const set<string>& strings = GetRteComponentHstrings();
+  uint64_t digest = RteUtils::FNV_OFFSET;
+  RteUtils::HashString(digest, devheader);
+  for (auto& s : strings) {
+    RteUtils::HashString(digest, s);
+  }
+  return GenerateRteHeader("RTE_Components.h", digest, [&devheader, &strings]() {
+    string content;
+    if (!devheader.empty()) {            // found device header file.
+      content += szDevHdr;
+      content += "\"" + devheader + "\"" + RteUtils::LF_STRING + RteUtils::LF_STRING;
+    }
+
+    //---------------------------------------------------
+    for (auto& s : strings) {
+      content += RteUtils::RemoveLeadingSpaces(s) + RteUtils::LF_STRING;
+    }
+    return content;
+  });
+}
+
+bool RteTarget::GenerateRteHeader(const string& headerName, uint64_t inputsDigest, const function<string()>& getContent) {
+  RteProject* project = GetProject();
+  if (!project) {
+    return false;
   }
+  const string headerFile = project->GetRteHeader(headerName, GetName(), project->GetProjectPath());
 
-  //---------------------------------------------------
-  const set<string>& strings = GetRteComponentHstrings();
-  for (auto s : strings) {
-    s = RteUtils::RemoveLeadingSpaces(s);
-    content += s + RteUtils::LF_STRING;
+  // everything else written into the header
+  uint64_t digest = inputsDigest;
+  RteUtils::HashString(digest, headerFile);
+  RteUtils::HashString(digest, project->GetName());
+  RteUtils::HashString(digest, GetName());
+  RteCallback* callback = GetCallback();
+  const RteKernel* kernel = callback ? callback->GetRteKernel() : nullptr;
+  if (kernel) {
+    RteUtils::HashString(digest, kernel->GetToolInfo().GetAttribute("name"));
+    RteUtils::HashString(digest, kernel->GetToolInfo().GetAttribute("version"));
   }
-  return GenerateRteHeaderFile("RTE_Components.h", content);
+
+  auto it = m_rteHeaderDigests.find(headerFile);
+  if (it != m_rteHeaderDigests.end() && it->second.first == digest && it->second.second == GetFileStamp(headerFile)) {
+    return true; // generated from the same inputs and not touched since
+  }
+  m_rteHeaderDigests.erase(headerFile);
+  if (!GenerateRteHeaderFile(headerName, getContent())) {
+    return false;
+  }
+  const int64_t stamp = GetFileStamp(headerFile);
+  if (stamp != NO_FILE_STAMP) {
+    m_rteHeaderDigests[headerFile] = make_pair(digest, stamp);
+  }
+  return true;
 }
 
 bool RteTarget::GenerateRteHeaderFile(const string& headerName, const string& content, bool bRegionsHeader, const std::string& directory) {
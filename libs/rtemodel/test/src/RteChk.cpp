@@ -332,16 +332,16 @@ void RteChk::DumpEffectiveProperties(RteDeviceItem* d, const string& processorNa
 {
   PrintText("Properties");
   m_indent++;
-  RteDevicePropertyMap props;
+  RteEffectiveProperties ownProps;
   if (!endLeaf) {
+    RteDevicePropertyMap props;
     d->GetProperties(props);
+    ownProps.Assign(props);
   }
-  const RteDevicePropertyMap& propMap = endLeaf ? d->GetEffectiveProperties(processorName) : props;
+  const RteEffectivePropertyTable& propTable = endLeaf ? d->GetEffectiveProperties(processorName) : ownProps.m_propertyTable;
 
-  for (auto it = propMap.begin(); it != propMap.end(); it++) {
-    const list<RteDeviceProperty*>& props = it->second;
-    for (auto itp = props.begin(); itp != props.end(); itp++) {
-      RteDeviceProperty* p = *itp;
+  for (auto& [_, props] : propTable) {
+    for (auto p : props) {
       DumpDeviceElement(p);
       if (p->GetTag() != "sequence")
         DumpEffectiveContent(p);
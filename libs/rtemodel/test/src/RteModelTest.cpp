@@ -20,6 +20,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <thread>
 
 using namespace std;
 
@@ -108,6 +109,38 @@ TEST(RteModelTest, PackRegistryLoadPacks) {
   packs.clear();
 }
 
+TEST(RteModelTest, PrecomputeEffectiveProperties) {
+
+  auto collectProperties = [](bool bPrecompute) {
+    RteKernelSlim rteKernel;
+    rteKernel.SetCmsisPackRoot(RteModelTestConfig::CMSIS_PACK_ROOT);
+    list<string> files;
+    rteKernel.GetEffectivePdscFiles(files, true);
+    RteModel* rteModel = rteKernel.GetGlobalModel();
+    rteModel->SetPrecomputeEffectiveProperties(bPrecompute);
+    list<RtePackage*> packs;
+    rteKernel.LoadPacks(files, packs);
+    rteModel->InsertPacks(packs);
+    vector<string> result;
+    for (auto [_, dv] : rteModel->GetDeviceVendors()) {
+      for (auto [name, d] : dv->GetDevices()) {
+        for (auto [pname, _] : d->GetProcessors()) {
+          for (auto& [tag, props] : d->GetEffectiveProperties(pname)) {
+            for (auto p : props) {
+              result.push_back(name + ":" + pname + ":" + tag + ":" + p->GetID() + ":" + p->GetAttributesString());
+            }
+          }
+        }
+      }
+    }
+    return result;
+  };
+  vector<string> lazy = collectProperties(false);
+  vector<string> precomputed = collectProperties(true);
+  EXPECT_FALSE(lazy.empty());
+  EXPECT_EQ(lazy, precomputed);
+}
+
 TEST(RteModelTest, LoadPacks) {
 
   RteKernelSlim rteKernel;  // here just to instantiate XMLTree parser
@@ -173,6 +206,54 @@ TEST(RteModelTest, LoadPacks) {
   EXPECT_EQ(pi.GetDescription(), pack->GetDescription());
   EXPECT_EQ(pi.GetID(), "ARM::RteTestBoard@0.1.0");
 
+  list<RteBoard*> boards;
+  rteModel->FindBoards("RteTest board listing", boards);
+  ASSERT_EQ(boards.size(), 1);
+  EXPECT_EQ(boards.front(), board);
+
+  RteDevice* device = rteModel->GetDevice("RteTest_ARMCM0", "");
+  ASSERT_NE(device, nullptr);
+  EXPECT_EQ(device, rteModel->GetDevice("RteTest_ARMCM0", "ARM"));
+  EXPECT_EQ(rteModel->FindCompatibleBoard("RteTest board listing (Rev.C)", device, true), board);
+  device = rteModel->GetDevice("RteTest_ARMCM3", "");
+  ASSERT_NE(device, nullptr);
+  EXPECT_EQ(rteModel->FindCompatibleBoard("RteTest board listing (Rev.C)", device, false), board);
+  EXPECT_EQ(rteModel->FindCompatibleBoard("RteTest board listing (Rev.C)", device, true), nullptr);
+  vector<RteDeviceItem*> compatibleDevices;
+  rteModel->GetCompatibleDevices(compatibleDevices, board, true);
+  ASSERT_EQ(compatibleDevices.size(), 1);
+  EXPECT_EQ(compatibleDevices.front()->GetName(), "RteTest_ARMCM0");
+  compatibleDevices.clear();
+  rteModel->GetCompatibleDevices(compatibleDevices, board);
+  EXPECT_TRUE(find(compatibleDevices.begin(), compatibleDevices.end(), device) != compatibleDevices.end());
+
+  list<RteDevice*> devices;
+  rteModel->FindDevices("RteTest_ARMCM3", devices);
+  ASSERT_EQ(devices.size(), 1);
+  EXPECT_EQ(devices.front(), device);
+  EXPECT_EQ(rteModel->GetDeviceNameIndex().count("RteTest_ARMCM3"), 1);
+  devices.clear();
+  rteModel->FindDevices("Unknown_Device", devices);
+  EXPECT_TRUE(devices.empty());
+
+  // compatibility cache is filled concurrently
+  list<RteDevice*> allDevices;
+  rteModel->GetDevices(allDevices, "", "", RteDeviceItem::VARIANT);
+  vector<thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([rteModel, &allDevices, board]() {
+      for (auto d : allDevices) {
+        vector<RteBoard*> compatibleBoards;
+        rteModel->GetCompatibleBoards(compatibleBoards, d);
+        rteModel->IsBoardCompatible(board, d);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  EXPECT_EQ(rteModel->FindCompatibleBoard("RteTest board listing (Rev.C)", device, false), board);
+
   board = rteModel->FindBoard("RteTest NoMCU board");
   ASSERT_NE(board, nullptr);
   EXPECT_FALSE(board->HasMCU());
@@ -361,6 +442,16 @@ void RteModelPrjTest::GenerateHeadersTest(const string& project, const string& r
   EXPECT_EQ(expectHeaderUpdate, HeaderContainsToolInfo(preIncGlob));
   EXPECT_EQ(expectHeaderUpdate, HeaderContainsToolInfo(rteComp));
 
+  // headers modified or removed since the last generation are restored
+  string rteCompContent, restoredContent;
+  RteFsUtils::ReadFile(rteComp, rteCompContent);
+  RteFsUtils::CreateTextFile(rteComp, "modified");
+  RteFsUtils::DeleteFileAutoRetry(preIncGlob);
+  loadedCprjProject->GenerateRteHeaders();
+  RteFsUtils::ReadFile(rteComp, restoredContent);
+  EXPECT_EQ(rteCompContent.substr(rteCompContent.find("#ifndef")), restoredContent.substr(restoredContent.find("#ifndef")));
+  EXPECT_TRUE(fs::exists(preIncGlob, ec));
+
   // reload project and check if timestamps are preserved
   auto timestampPreIncComp = fs::last_write_time(preIncComp, ec);
   auto timestamppreIncGlob = fs::last_write_time(preIncGlob, ec);
@@ -453,6 +544,15 @@ TEST_F(RteModelPrjTest, LoadCprj) {
   fi = activeCprjProject->GetFileInstance("RTE/RteTest/ComponentLevelConfig_1.h");
   EXPECT_EQ(fi->GetInfoString(activeTarget->GetName()),
     "RTE/RteTest/ComponentLevelConfig_1.h@0.0.1 (up to date) from ARM::RteTest:ComponentLevel@0.0.1");
+
+  // config files are looked up per component
+  map<string, RteFileInstance*> configFiles;
+  activeCprjProject->GetFileInstancesForComponent(fi->GetComponentInstance(activeTarget->GetName()), activeTarget->GetName(), configFiles);
+  EXPECT_EQ(configFiles.size(), 2);
+  EXPECT_EQ(configFiles["ComponentLevel/ComponentLevelConfig.h"], fi);
+  configFiles.clear();
+  activeCprjProject->GetFileInstancesForComponent(ci, activeTarget->GetName(), configFiles);
+  EXPECT_TRUE(configFiles.empty());
   error_code ec;
   const fs::perms write_mask = fs::perms::owner_write | fs::perms::group_write | fs::perms::others_write;
   // check config file PLM: existence and permissions
@@ -0,0 +1,75 @@
+#ifndef JobPool_H
+#define JobPool_H
+/******************************************************************************/
+/* RTE  -  CMSIS Run-Time Environment                                         */
+/******************************************************************************/
+/** @file  JobPool.h
+  * @brief Run indexed jobs concurrently on a pool of threads
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief pool of threads running the jobs with indices 0..count-1, each job exactly once.
+ *        Jobs are taken in index order but may complete in any order.
+*/
+class JobPool
+{
+public:
+  /**
+   * @brief start background threads that take jobs immediately
+   * @param count number of jobs
+   * @param job function called with the job index
+   * @param threads number of background threads, 0 to run all jobs in Wait()
+  */
+  JobPool(size_t count, const std::function<void(size_t)>& job, size_t threads);
+
+  /**
+   * @brief destructor, waits for all jobs
+  */
+  ~JobPool();
+
+  /**
+   * @brief run jobs not yet taken in the calling thread and wait until all jobs are done
+  */
+  void Wait();
+
+  /**
+   * @brief get number of threads to use
+   * @param jobs requested number of threads, 0 for the hardware concurrency
+   * @param count number of jobs, no more threads than jobs are used
+   * @return number of threads, at least 1
+  */
+  static size_t GetThreadCount(unsigned jobs, size_t count = SIZE_MAX);
+
+  /**
+   * @brief run jobs concurrently, the calling thread included, and wait until all jobs are done
+   * @param count number of jobs
+   * @param job function called with the job index
+   * @param jobs requested number of threads, 0 for the hardware concurrency
+   * @return number of threads used
+  */
+  static size_t Run(size_t count, const std::function<void(size_t)>& job, unsigned jobs = 0);
+
+private:
+  void Work();
+
+  const size_t m_count;
+  const std::function<void(size_t)> m_job;
+  std::atomic<size_t> m_next;
+  std::vector<std::thread> m_threads;
+};
+
+#endif // JobPool_H
@@ -20,6 +20,8 @@
 #include "VersionCmp.h"
 #include "WildCards.h"
 
+#include <cstdint>
+
 class RteUtils
 {
 private:
@@ -381,6 +383,23 @@ public:
    * @return trimmed string without whitespace characters after newline character
   */
   static std::string RemoveLeadingSpaces(const std::string& input);
+
+  /**
+   * @brief update 64-bit FNV-1a hash with data
+   * @param hash hash of preceding data, FNV_OFFSET for the first chunk
+   * @param data pointer to data
+   * @param size data size in bytes
+   * @return updated hash
+  */
+  static uint64_t HashFnv1a(uint64_t hash, const char* data, size_t size);
+
+  /**
+   * @brief update 64-bit FNV-1a hash with a string followed by a terminator byte,
+   *        consecutive strings are hashed differently from their concatenation
+   * @param hash hash to be updated
+   * @param text string
+  */
+  static void HashString(uint64_t& hash, const std::string& text);
 // static constants
 public:
   static const std::string EMPTY_STRING;
@@ -398,6 +417,9 @@ public:
   static const std::set<std::string> EMPTY_STRING_SET;
   static const std::list<std::string> EMPTY_STRING_LIST;
   static const std::vector<std::string> EMPTY_STRING_VECTOR;
+
+  static constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+  static constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
 };
 
 #endif // RteUtils_H
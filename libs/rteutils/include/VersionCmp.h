@@ -14,6 +14,7 @@
  */
 /******************************************************************************/
 
+#include <cstdint>
 #include <string>
 #include <set>
 
@@ -23,6 +24,9 @@ class VersionCmp
 private:
   VersionCmp() {}; // protection
 
+  static bool ParseNumeric(const std::string& v, uint32_t segments[3], size_t& releasePos, size_t& releaseLen);
+  static int CompareNumeric(const uint32_t segments1[3], const uint32_t segments2[3]);
+
 public:
 
   enum MatchMode {
@@ -118,6 +122,69 @@ public:
   static const std::string GetMatchingVersion(const std::string& filter,
     const std::set<std::string>& availableVersions, bool bCompatible = false);
 
+  /**
+   * @brief version string parsed once for repeated comparisons,
+   *        MAJOR.MINOR.PATCH with numeric segments is compared as packed integers without allocations
+  */
+  class Key
+  {
+  public:
+    /**
+     * @brief constructor
+     * @param version version string
+    */
+    Key(const std::string& version = std::string());
+    /**
+     * @brief get version string
+     * @return version string the key is created for
+    */
+    const std::string& GetVersion() const { return m_version; }
+    /**
+     * @brief compare with another key, equivalent to VersionCmp::Compare()
+     * @param that key to compare with
+     * @param cs true in case of case sensitive comparison
+     * @return 0 if both versions are equal, > 0 if this is greater, < 0 if that is greater
+    */
+    int Compare(const Key& that, bool cs = true) const;
+
+    bool operator<(const Key& that) const { return Compare(that) < 0; }
+    bool operator>(const Key& that) const { return Compare(that) > 0; }
+
+  protected:
+    std::string m_version;
+    std::string m_release;  // release without build metadata
+    uint64_t m_majorMinor;  // (MAJOR << 32) | MINOR
+    uint32_t m_patch;
+    bool m_numeric;         // false: segments are not numeric, compared as strings
+    bool m_hasRelease;
+  };
+
+  /**
+   * @brief version range parsed once for checking many versions
+  */
+  class Range
+  {
+  public:
+    /**
+     * @brief constructor
+     * @param versionRange range in the form min:max, min or :max
+    */
+    Range(const std::string& versionRange);
+    /**
+     * @brief compare version with the range, equivalent to VersionCmp::RangeCompare()
+     * @param version version key to be compared
+     * @param bCompatible if upper range is not given, limit upper range by next major version
+     * @return 0 if version is between range version, > 0 if greater, < 0 if smaller
+    */
+    int Compare(const Key& version, bool bCompatible = false) const;
+
+  protected:
+    std::string m_range;
+    Key m_min;
+    Key m_max;
+    bool m_exact;           // min and max are the same
+  };
+
   class ComparatorBase
   {
   public:
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef WORD_FILTER_H
+#define WORD_FILTER_H
+
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * @brief compiled multi-word substring filter, a string matches if it contains all filter words,
+ *        all words are searched in a single pass over the string (Aho-Corasick automaton)
+*/
+class WordFilter
+{
+public:
+  /**
+   * @brief class constructor
+   * @param words set of substrings to match (all must match), empty words are ignored
+  */
+  WordFilter(const std::set<std::string>& words);
+
+  /**
+   * @brief check if filter has no words
+   * @return true if filter has no words and therefore matches any string
+  */
+  bool IsEmpty() const { return m_wordCount == 0; }
+
+  /**
+   * @brief match string against the filter
+   * @param s string to match
+   * @return true if the string contains all filter words
+  */
+  bool Match(const std::string& s) const;
+
+protected:
+  static constexpr size_t ALPHABET = 256;
+  size_t m_wordCount;
+  std::vector<int> m_next; // transition table: state * ALPHABET + character -> state
+  std::vector<std::vector<size_t>> m_outputs; // indices of words ending in state, including suffixes
+};
+
+#endif // WORD_FILTER_H
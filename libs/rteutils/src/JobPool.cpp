@@ -0,0 +1,65 @@
+/******************************************************************************/
+/* RTE - CMSIS Run-Time Environment */
+/******************************************************************************/
+/** @file JobPool.cpp
+* @brief Run indexed jobs concurrently on a pool of threads
+*/
+/******************************************************************************/
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+/******************************************************************************/
+
+#include "JobPool.h"
+
+#include <algorithm>
+
+using namespace std;
+
+JobPool::JobPool(size_t count, const function<void(size_t)>& job, size_t threads) :
+  m_count(count),
+  m_job(job),
+  m_next(0)
+{
+  for (size_t i = 0; i < min(threads, count); i++) {
+    m_threads.emplace_back(&JobPool::Work, this);
+  }
+}
+
+JobPool::~JobPool()
+{
+  Wait();
+}
+
+void JobPool::Work()
+{
+  for (size_t i = m_next++; i < m_count; i = m_next++) {
+    m_job(i);
+  }
+}
+
+void JobPool::Wait()
+{
+  Work();
+  for (auto& t : m_threads) {
+    t.join();
+  }
+  m_threads.clear();
+}
+
+size_t JobPool::GetThreadCount(unsigned jobs, size_t count)
+{
+  const size_t threads = jobs ? jobs : thread::hardware_concurrency();
+  return max<size_t>(1, min(threads, count));
+}
+
+size_t JobPool::Run(size_t count, const function<void(size_t)>& job, unsigned jobs)
+{
+  const size_t threads = GetThreadCount(jobs, count);
+  JobPool(count, job, threads - 1).Wait();
+  return threads;
+}
+
+// End of JobPool.cpp
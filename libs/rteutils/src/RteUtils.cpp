@@ -14,10 +14,12 @@
 
 #include "RteUtils.h"
 #include "RteConstants.h"
+#include "WordFilter.h"
 
 #include <cstring>
 #include <sstream>
 #include <regex>
+#include <unordered_set>
 
 using namespace std;
 
@@ -587,31 +589,46 @@ bool RteUtils::GetAccessSequence(size_t& offset, const string& src, string& sequ
 
 void RteUtils::ApplyFilter(const vector<string>& origin, const set<string>& filter, vector<string>& result) {
   result.clear();
+  const WordFilter wordFilter(filter);
+  unordered_set<string> added;
   for (const auto& item : origin) {
-    bool match = true;
-    for (const auto& word : filter) {
-      if (word.empty()) {
-        continue;
-      }
-      if (item.find(word) == string::npos) {
-        match = false;
-        break;
-      }
-    }
-    if (match) {
-      CollectionUtils::PushBackUniquely(result, item);
+    if (wordFilter.Match(item) && added.insert(item).second) {
+      result.push_back(item);
     }
   }
 }
 
 string RteUtils::RemoveLeadingSpaces(const string& input) {
-  // the regex pattern to match leading spaces after a newline character
-  static std::regex pattern(R"((\n)\s+)");
-
-  // Replace leading spaces after newline characters
-  // with a single newline character
-  std::string result = std::regex_replace(input, pattern, "$1");
+  if (input.find('\n') == string::npos) {
+    return input;
+  }
+  // copy input skipping whitespace characters (including further newlines) after each newline character
+  string result;
+  result.reserve(input.size());
+  for (size_t pos = 0; pos < input.size();) {
+    const char ch = input[pos++];
+    result += ch;
+    if (ch == '\n') {
+      while (pos < input.size() && isspace(static_cast<unsigned char>(input[pos]))) {
+        pos++;
+      }
+    }
+  }
   return result;
 }
 
+uint64_t RteUtils::HashFnv1a(uint64_t hash, const char* data, size_t size) {
+  for (size_t i = 0; i < size; i++) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+void RteUtils::HashString(uint64_t& hash, const string& text) {
+  hash = HashFnv1a(hash, text.data(), text.size());
+  hash ^= 0xff;
+  hash *= FNV_PRIME;
+}
+
 // End of RteUtils.cpp
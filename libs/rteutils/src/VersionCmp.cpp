@@ -150,10 +150,90 @@ public:
 };
 
 
+bool VersionCmp::ParseNumeric(const string& v, uint32_t segments[3], size_t& releasePos, size_t& releaseLen)
+{
+  // fast path for MAJOR[.MINOR[.PATCH]][-RELEASE][+META] with up to 9 digits per segment,
+  // any other version is left to the Version class
+  if (v.length() >= MAX_BUF - 1) {
+    return false;
+  }
+  size_t len = v.find('+');
+  if (len == string::npos) {
+    len = v.length();
+  }
+  segments[0] = segments[1] = segments[2] = 0;
+  releasePos = string::npos;
+  releaseLen = 0;
+  size_t pos = 0;
+  for (int i = 0; i < 3; i++) {
+    const size_t start = pos;
+    uint32_t value = 0;
+    for (; pos < len && v[pos] >= '0' && v[pos] <= '9'; pos++) {
+      if (pos - start >= 9) {
+        return false;
+      }
+      value = value * 10 + (v[pos] - '0');
+    }
+    if (pos == start) {
+      return false;
+    }
+    segments[i] = value;
+    if (pos == len) {
+      return true;
+    }
+    if (v[pos] == '-') {
+      releasePos = pos + 1;
+      releaseLen = len - releasePos;
+      return true;
+    }
+    if (v[pos] != '.') {
+      return false;
+    }
+    pos++;
+  }
+  return false;
+}
+
+int VersionCmp::CompareNumeric(const uint32_t segments1[3], const uint32_t segments2[3])
+{
+  // 3 : major, 2 : minor, 1 : patch difference
+  for (int i = 0; i < 3; i++) {
+    if (segments1[i] != segments2[i]) {
+      return segments1[i] > segments2[i] ? 3 - i : i - 3;
+    }
+  }
+  return 0;
+}
+
+static int CompareReleases(bool hasRelease1, const string& release1, bool hasRelease2, const string& release2)
+{
+  if (!hasRelease1 && !hasRelease2)
+    return 0;
+  else if (!hasRelease1)
+    return 1;
+  else if (!hasRelease2)
+    return -1;
+  // the release is case - insensitive
+  const int result = VersionCmp::Compare(release1, release2, false);
+  return result < 0 ? -1 : result > 0 ? 1 : 0;
+}
+
 int VersionCmp::Compare(const string& v1, const string& v2, bool cs) {
   if (v1 == v2) {
     return 0;
   }
+  uint32_t segments1[3], segments2[3];
+  size_t releasePos1, releaseLen1, releasePos2, releaseLen2;
+  if (ParseNumeric(v1, segments1, releasePos1, releaseLen1) && ParseNumeric(v2, segments2, releasePos2, releaseLen2)) {
+    const int res = CompareNumeric(segments1, segments2);
+    if (res != 0) {
+      return res;
+    }
+    const bool hasRelease1 = releasePos1 != string::npos;
+    const bool hasRelease2 = releasePos2 != string::npos;
+    return CompareReleases(hasRelease1, hasRelease1 ? v1.substr(releasePos1, releaseLen1) : RteUtils::EMPTY_STRING,
+                           hasRelease2, hasRelease2 ? v2.substr(releasePos2, releaseLen2) : RteUtils::EMPTY_STRING);
+  }
   // Split v1 and v2 according to http://semver.org/ and compare individually
   Version ver1(v1);
   Version ver2(v2);
@@ -166,17 +246,64 @@ int VersionCmp::RangeCompare(const string& version, const string& versionRange,
   if (version == versionRange) {
     return 0;
   }
+  return Range(versionRange).Compare(Key(version), bCompatible);
+}
 
-  string verMin = RteUtils::GetPrefix(versionRange);
-  string verMax = RteUtils::GetSuffix(versionRange);
+VersionCmp::Key::Key(const string& version) :
+  m_version(version),
+  m_majorMinor(0),
+  m_patch(0),
+  m_hasRelease(false)
+{
+  uint32_t segments[3];
+  size_t releasePos, releaseLen;
+  m_numeric = ParseNumeric(version, segments, releasePos, releaseLen);
+  if (m_numeric) {
+    m_majorMinor = (static_cast<uint64_t>(segments[0]) << 32) | segments[1];
+    m_patch = segments[2];
+    m_hasRelease = releasePos != string::npos;
+    if (m_hasRelease) {
+      m_release = version.substr(releasePos, releaseLen);
+    }
+  }
+}
+
+int VersionCmp::Key::Compare(const Key& that, bool cs) const
+{
+  if (!m_numeric || !that.m_numeric) {
+    return VersionCmp::Compare(m_version, that.m_version, cs);
+  }
+  if (m_majorMinor != that.m_majorMinor) {
+    const int res = (m_majorMinor >> 32) != (that.m_majorMinor >> 32) ? 3 : 2;
+    return m_majorMinor > that.m_majorMinor ? res : -res;
+  }
+  if (m_patch != that.m_patch) {
+    return m_patch > that.m_patch ? 1 : -1;
+  }
+  return CompareReleases(m_hasRelease, m_release, that.m_hasRelease, that.m_release);
+}
+
+VersionCmp::Range::Range(const string& versionRange) :
+  m_range(versionRange),
+  m_min(RteUtils::GetPrefix(versionRange)),
+  m_max(RteUtils::GetSuffix(versionRange)),
+  m_exact(m_min.GetVersion() == m_max.GetVersion())
+{
+}
+
+int VersionCmp::Range::Compare(const Key& version, bool bCompatible) const
+{
+  if (version.GetVersion() == m_range) {
+    return 0;
+  }
   int resMin = 0;
-  if (!verMin.empty()) {
-    resMin = Compare(version, verMin);
-    if (resMin < 0 || verMin == verMax) // lower than min or exact match is required?
+  if (!m_min.GetVersion().empty()) {
+    resMin = version.Compare(m_min);
+    if (resMin < 0 || m_exact) // lower than min or exact match is required?
       return resMin;
   }
-  if (!verMax.empty()) {
-    int resMax = Compare(version, verMax);
+  if (!m_max.GetVersion().empty()) {
+    int resMax = version.Compare(m_max);
     if (resMax > 0)
       return resMax;
   }else if(bCompatible && resMin > 2) {
@@ -274,18 +401,17 @@ const std::string VersionCmp::GetMatchingVersion(const std::string& filter,
   string matchedVersion;
   if (std::string::npos == filter.find('@')) {
     // version range
-    vector<std::string> matchedVersions;
+    const Range range(filter);
+    vector<Key> matchedVersions;
     for (auto& version : availableVersions) {
-      if (0 == RangeCompare(version, filter, bCompatible)) {
-        matchedVersions.push_back(version);
+      Key key(version);
+      if (0 == range.Compare(key, bCompatible)) {
+        matchedVersions.push_back(std::move(key));
       }
     }
-    auto itr = std::max_element(matchedVersions.begin(), matchedVersions.end(),
-      [](const auto& a, const auto& b) {
-        return (VersionCmp::Compare(a, b) < 0);
-      });
+    auto itr = std::max_element(matchedVersions.begin(), matchedVersions.end());
     if (itr != matchedVersions.end()) {
-      matchedVersion = *itr;
+      matchedVersion = itr->GetVersion();
     }
   }
   else {
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "WordFilter.h"
+
+#include <queue>
+
+using namespace std;
+
+WordFilter::WordFilter(const set<string>& words) :
+  m_wordCount(0),
+  m_next(ALPHABET, -1),
+  m_outputs(1)
+{
+  // trie of all words, state 0 is the root
+  for (const auto& word : words) {
+    if (word.empty()) {
+      continue;
+    }
+    size_t state = 0;
+    for (const unsigned char c : word) {
+      const size_t index = state * ALPHABET + c;
+      if (m_next[index] < 0) {
+        m_next[index] = static_cast<int>(m_outputs.size());
+        m_outputs.emplace_back();
+        m_next.resize(m_next.size() + ALPHABET, -1);
+      }
+      state = m_next[index];
+    }
+    m_outputs[state].push_back(m_wordCount++);
+  }
+
+  // breadth-first: compute failure links, complete transitions and merge outputs of suffixes
+  vector<int> fail(m_outputs.size(), 0);
+  queue<int> states;
+  for (size_t c = 0; c < ALPHABET; c++) {
+    if (m_next[c] < 0) {
+      m_next[c] = 0;
+    } else {
+      states.push(m_next[c]);
+    }
+  }
+  while (!states.empty()) {
+    const int state = states.front();
+    states.pop();
+    const auto& suffixOutputs = m_outputs[fail[state]];
+    m_outputs[state].insert(m_outputs[state].end(), suffixOutputs.begin(), suffixOutputs.end());
+    for (size_t c = 0; c < ALPHABET; c++) {
+      const size_t index = state * ALPHABET + c;
+      const int fallback = m_next[fail[state] * ALPHABET + c];
+      if (m_next[index] < 0) {
+        m_next[index] = fallback;
+      } else {
+        fail[m_next[index]] = fallback;
+        states.push(m_next[index]);
+      }
+    }
+  }
+}
+
+bool WordFilter::Match(const string& s) const
+{
+  if (IsEmpty()) {
+    return true;
+  }
+  vector<bool> found(m_wordCount, false);
+  size_t foundCount = 0;
+  size_t state = 0;
+  for (const unsigned char c : s) {
+    state = m_next[state * ALPHABET + c];
+    for (const size_t word : m_outputs[state]) {
+      if (!found[word]) {
+        found[word] = true;
+        if (++foundCount == m_wordCount) {
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+// End of WordFilter.cpp
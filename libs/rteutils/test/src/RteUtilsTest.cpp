@@ -6,9 +6,15 @@
 #include "RteUtils.h"
 #include "RteError.h"
 #include "RteConstants.h"
+#include "WordFilter.h"
+#include "JobPool.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 using namespace std;
 
 
@@ -543,6 +549,34 @@ TEST(RteUtils, ApplyFilter) {
   std::vector<std::string> result;
   RteUtils::ApplyFilter(input, filter, result);
   EXPECT_EQ(expected, result);
+
+  // duplicates are removed, order is kept
+  input = { "b_String", "a_String", "b_String", "Other" };
+  expected = { "b_String", "a_String" };
+  RteUtils::ApplyFilter(input, { "String" }, result);
+  EXPECT_EQ(expected, result);
+  RteUtils::ApplyFilter(input, {}, result);
+  EXPECT_EQ(3, result.size());
+}
+
+TEST(RteUtils, WordFilter) {
+  EXPECT_TRUE(WordFilter({}).IsEmpty());
+  EXPECT_TRUE(WordFilter({ "" }).Match("any"));
+
+  // overlapping words and words being suffixes of others
+  WordFilter filter({ "ARM", "RMC", "CM", "M3" });
+  EXPECT_FALSE(filter.IsEmpty());
+  EXPECT_TRUE(filter.Match("ARMCM3"));
+  EXPECT_TRUE(filter.Match("M3 ARMCM"));
+  EXPECT_FALSE(filter.Match("ARMCM4"));
+  EXPECT_FALSE(filter.Match("ARM CM3"));
+  EXPECT_FALSE(filter.Match(""));
+
+  // repeated prefixes need failure transitions
+  WordFilter repeated({ "aab", "ab" });
+  EXPECT_TRUE(repeated.Match("aaab"));
+  EXPECT_FALSE(repeated.Match("abab"));
+  EXPECT_TRUE(WordFilter({ "\xE4::" }).Match("Vendor\xE4::Name"));
 }
 
 TEST(RteUtils, GetDeviceAttribute) {
@@ -567,5 +601,46 @@ TEST(RteUtilsTest, RemoveLeadingSpaces) {
   EXPECT_EQ(RteUtils::RemoveLeadingSpaces("Start\r\n Mid with\t space \r\n nextline"), "Start\r\nMid with\t space \r\nnextline");
   EXPECT_EQ(RteUtils::RemoveLeadingSpaces("Start\n"), "Start\n");
   EXPECT_EQ(RteUtils::RemoveLeadingSpaces("Full"), "Full");
+  EXPECT_EQ(RteUtils::RemoveLeadingSpaces("Start\n\n \t\n  End  "), "Start\nEnd  ");
+}
+
+TEST(RteUtilsTest, HashFnv1a) {
+  // reference values of 64-bit FNV-1a
+  EXPECT_EQ(RteUtils::HashFnv1a(RteUtils::FNV_OFFSET, "", 0), 0xcbf29ce484222325ULL);
+  EXPECT_EQ(RteUtils::HashFnv1a(RteUtils::FNV_OFFSET, "a", 1), 0xaf63dc4c8601ec8cULL);
+  EXPECT_EQ(RteUtils::HashFnv1a(RteUtils::FNV_OFFSET, "foobar", 6), 0x85944171f73967e8ULL);
+  EXPECT_EQ(RteUtils::HashFnv1a(RteUtils::HashFnv1a(RteUtils::FNV_OFFSET, "foo", 3), "bar", 3), 0x85944171f73967e8ULL);
+
+  // terminated strings do not run into each other
+  uint64_t hash1 = RteUtils::FNV_OFFSET;
+  uint64_t hash2 = RteUtils::FNV_OFFSET;
+  RteUtils::HashString(hash1, "ab");
+  RteUtils::HashString(hash1, "c");
+  RteUtils::HashString(hash2, "a");
+  RteUtils::HashString(hash2, "bc");
+  EXPECT_NE(hash1, hash2);
+  uint64_t hash3 = RteUtils::FNV_OFFSET;
+  RteUtils::HashString(hash3, "ab");
+  RteUtils::HashString(hash3, "c");
+  EXPECT_EQ(hash1, hash3);
+}
+
+TEST(RteUtilsTest, JobPool) {
+  EXPECT_EQ(JobPool::GetThreadCount(8, 3), 3u);
+  EXPECT_EQ(JobPool::GetThreadCount(2), 2u);
+  EXPECT_EQ(JobPool::GetThreadCount(4, 0), 1u);
+  EXPECT_GE(JobPool::GetThreadCount(0), 1u);
+
+  // every job runs exactly once
+  vector<atomic<int>> runs(1000);
+  EXPECT_EQ(JobPool::Run(runs.size(), [&runs](size_t i) { runs[i]++; }, 4), 4u);
+  EXPECT_TRUE(all_of(runs.begin(), runs.end(), [](const atomic<int>& r) { return r == 1; }));
+
+  // without background threads all jobs run in Wait() on the calling thread
+  const thread::id caller = this_thread::get_id();
+  bool sameThread = true;
+  JobPool pool(10, [&](size_t) { sameThread = sameThread && this_thread::get_id() == caller; }, 0);
+  pool.Wait();
+  EXPECT_TRUE(sameThread);
 }
 // end of RteUtilsTest.cpp
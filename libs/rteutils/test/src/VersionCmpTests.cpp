@@ -152,4 +152,63 @@ TEST(VersionCmpTest, ComparatorBase) {
   EXPECT_EQ(-2, comparator1.Compare("Test@1.1.0", "Test@1.2.0"));
   EXPECT_EQ(1, comparator1.Compare("Foo@1.1.0", "Bar@1.2.0"));
 }
+
+TEST(VersionCmpTest, KeyCompare) {
+  // numeric fast path and string fallback give the same results as Compare()
+  const vector<string> versions = { "", "0", "1", "1.0", "1.0.0", "01.0.0", "1.0.0-a", "1.0.0-A", "1.0.0-b", "1.0.0-rc.1",
+    "1.0.0-rc.10", "1.0.0+meta", "1.0.0-a+meta", "1.0.1", "1.1.0", "2.0.0", "10.0.0", "1.2.3b", "1.2.3.4", "1.x.0",
+    "1..2", "1.2.", "1234567890.0.0", "999999999.0.0" };
+  for (const auto& v1 : versions) {
+    for (const auto& v2 : versions) {
+      for (bool cs : { true, false }) {
+        EXPECT_EQ(VersionCmp::Compare(v1, v2, cs), VersionCmp::Key(v1).Compare(VersionCmp::Key(v2), cs)) <<
+          "error: comparing \"" << v1 << "\" with \"" << v2 << "\"" << endl;
+      }
+    }
+  }
+  EXPECT_EQ(-3, VersionCmp::Key("2.5.0").Compare(VersionCmp::Key("6.5.0")));
+  EXPECT_EQ(2, VersionCmp::Key("6.6.0").Compare(VersionCmp::Key("6.5.0")));
+  EXPECT_EQ(-1, VersionCmp::Key("6.5.0-a").Compare(VersionCmp::Key("6.5.0")));
+  EXPECT_EQ(0, VersionCmp::Key("6.5.0-a").Compare(VersionCmp::Key("6.5.0-A")));
+  EXPECT_TRUE(VersionCmp::Key("1.10.0") > VersionCmp::Key("1.9.0"));
+
+  // fast path edge cases with expected values
+  auto keyCompare = [](const string& v1, const string& v2) {
+    return VersionCmp::Key(v1).Compare(VersionCmp::Key(v2));
+  };
+  // leading zeros
+  EXPECT_EQ(0, keyCompare("01.0.0", "1.0.0"));
+  EXPECT_EQ(0, keyCompare("1.01.0", "1.1.0"));
+  EXPECT_EQ(0, keyCompare("1.0.01", "1.0.1"));
+  EXPECT_EQ(-1, keyCompare("01.0.0", "1.0.1"));
+  EXPECT_EQ(3, keyCompare("2.0.0", "01.0.0"));
+  // 9- and 10-digit segments
+  EXPECT_EQ(-3, keyCompare("999999999.0.0", "1000000000.0.0"));
+  EXPECT_EQ(3, keyCompare("1234567890.0.0", "999999999.0.0"));
+  EXPECT_EQ(-3, keyCompare("999999999.0.0", "1234567890.0.0"));
+  EXPECT_EQ(0, keyCompare("1234567890.0.0", "1234567890.0.0"));
+  EXPECT_EQ(-3, keyCompare("1234567890.0.0", "1234567891.0.0"));
+  EXPECT_EQ(3, keyCompare("9999999999.0.0", "1234567890.0.0"));
+  EXPECT_EQ(2, keyCompare("1.1234567890.0", "1.999999999.0"));
+  // numeric releases compare by value
+  EXPECT_EQ(-1, keyCompare("1.0.0-2", "1.0.0-10"));
+  EXPECT_EQ(1, keyCompare("1.0.0-10", "1.0.0-2"));
+  EXPECT_EQ(1, keyCompare("1.0.0-10", "1.0.0-9"));
+  EXPECT_EQ(-1, keyCompare("1.0.0-2", "1.0.0"));
+  // release without '-'
+  EXPECT_EQ(0, keyCompare("1.2.3b", "1.2.3-b"));
+  EXPECT_EQ(-1, keyCompare("1.2.3b", "1.2.3"));
+  EXPECT_EQ(1, keyCompare("1.2.3", "1.2.3b"));
+  EXPECT_EQ(1, keyCompare("1.2.3b", "1.2.3a"));
+  EXPECT_EQ(-1, keyCompare("1.2.3b", "1.2.4"));
+
+  // range parsed once
+  const VersionCmp::Range range("1.2.0:3.2.0");
+  EXPECT_EQ(-2, range.Compare(VersionCmp::Key("1.1.0")));
+  EXPECT_EQ(0, range.Compare(VersionCmp::Key("1.2.0")));
+  EXPECT_EQ(0, range.Compare(VersionCmp::Key("3.2.0+meta")));
+  EXPECT_EQ(1, range.Compare(VersionCmp::Key("3.2.1")));
+  EXPECT_EQ(3, VersionCmp::Range("3.6.0").Compare(VersionCmp::Key("4.0.1"), true));
+  EXPECT_EQ(0, VersionCmp::Range("3.6.0").Compare(VersionCmp::Key("4.0.1")));
+}
 // end of VersionCmpTest.cpp
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * @brief collects timed spans of all threads and writes them in Chrome trace event format,
+ *        readable by chrome://tracing and https://ui.perfetto.dev
+ *        Recording is disabled by default; a disabled TraceSpan costs one atomic load.
+*/
+class Tracer {
+public:
+  /**
+   * @brief enable or disable recording
+   * @param enable true to record spans
+  */
+  static void Enable(bool enable);
+
+  /**
+   * @brief check if spans are recorded
+   * @return true if recording is enabled
+  */
+  static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief get current time
+   * @return microseconds since start of the process
+  */
+  static int64_t Now();
+
+  /**
+   * @brief record a completed span of the calling thread
+   * @param name span name, must be a string literal or otherwise outlive the Tracer
+   * @param category span category, must be a string literal
+   * @param detail optional argument shown with the span, e.g. a file name
+   * @param start start time as returned by Now()
+   * @param end end time as returned by Now()
+  */
+  static void Record(const char* name, const char* category, const std::string& detail, int64_t start, int64_t end);
+
+  /**
+   * @brief set name of the calling thread shown in the trace
+   * @param name thread name
+  */
+  static void SetThreadName(const std::string& name);
+
+  /**
+   * @brief write recorded spans as Chrome trace event JSON
+   * @param fileName output file name
+   * @return true if successful
+  */
+  static bool Write(const std::string& fileName);
+
+  /**
+   * @brief get recorded spans as Chrome trace event JSON
+   * @return JSON text
+  */
+  static std::string ToJson();
+
+  /**
+   * @brief discard all recorded spans
+  */
+  static void Clear();
+
+  /**
+   * @brief get number of recorded spans
+   * @return number of spans of all threads
+  */
+  static size_t GetSpanCount();
+
+  /**
+   * @brief escape text for use inside a JSON string
+   * @param text text to escape
+   * @return escaped text without enclosing quotes
+  */
+  static std::string EscapeJson(const std::string& text);
+
+private:
+  static std::atomic<bool> s_enabled;
+};
+
+/**
+ * @brief RAII span: records the time between construction and destruction if tracing is enabled
+*/
+class TraceSpan {
+public:
+  /**
+   * @brief constructor
+   * @param name span name, must be a string literal
+   * @param category span category, must be a string literal
+  */
+  TraceSpan(const char* name, const char* category = "") :
+    m_name(name), m_category(category), m_start(Tracer::IsEnabled() ? Tracer::Now() : -1) {}
+
+  /**
+   * @brief constructor
+   * @param name span name, must be a string literal
+   * @param category span category, must be a string literal
+   * @param detail argument shown with the span, only copied if tracing is enabled
+  */
+  TraceSpan(const char* name, const char* category, const std::string& detail) :
+    TraceSpan(name, category)
+  {
+    if(m_start >= 0) {
+      m_detail = detail;
+    }
+  }
+
+  ~TraceSpan() {
+    if(m_start >= 0) {
+      Tracer::Record(m_name, m_category, m_detail, m_start, Tracer::Now());
+    }
+  }
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+  const char* m_name;
+  const char* m_category;
+  int64_t     m_start;
+  std::string m_detail;
+};
+
+/**
+ * @brief RAII trace session of a tool command: records spans while in scope and writes them
+ *        to the trace file when the session is stopped or destroyed. Nothing is recorded if
+ *        the file name is empty.
+*/
+class TraceFile {
+public:
+  /**
+   * @brief constructor, enables recording and names the calling thread "main"
+   * @param fileName trace file to write, empty to disable tracing
+   * @param onWriteError optional callback reporting a trace file that cannot be written
+  */
+  TraceFile(const std::string& fileName, const std::function<void(const std::string&)>& onWriteError = nullptr);
+
+  /**
+   * @brief destructor, calls Stop()
+  */
+  ~TraceFile();
+
+  /**
+   * @brief disable recording, write the trace file and discard the recorded spans
+   * @return false if the trace file cannot be written, true otherwise
+  */
+  bool Stop();
+
+  TraceFile(const TraceFile&) = delete;
+  TraceFile& operator=(const TraceFile&) = delete;
+
+private:
+  std::string m_fileName;
+  std::function<void(const std::string&)> m_onWriteError;
+};
+
+#endif // TRACER_H
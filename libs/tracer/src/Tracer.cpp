@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "Tracer.h"
+
+#include "RteFileWriter.h"
+
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+struct TraceEvent {
+  const char* name;
+  const char* category;
+  string      detail;
+  int64_t     start;
+  int64_t     duration;
+};
+
+// each thread appends to its own buffer, the lock is only contended while writing the trace
+struct ThreadBuffer {
+  uint32_t           tid;
+  string             name;
+  mutex              lock;
+  vector<TraceEvent> events;
+};
+
+struct Registry {
+  mutex                            lock;
+  vector<shared_ptr<ThreadBuffer>> buffers;     // kept after thread exit
+};
+
+const chrono::steady_clock::time_point s_origin = chrono::steady_clock::now();
+
+Registry& GetRegistry()
+{
+  static Registry registry;
+  return registry;
+}
+
+ThreadBuffer& GetThreadBuffer()
+{
+  thread_local shared_ptr<ThreadBuffer> buffer;
+  if(!buffer) {
+    buffer = make_shared<ThreadBuffer>();
+    Registry& registry = GetRegistry();
+    lock_guard<mutex> guard(registry.lock);
+    buffer->tid = (uint32_t)registry.buffers.size() + 1;
+    registry.buffers.push_back(buffer);
+  }
+  return *buffer;
+}
+
+} // namespace
+
+atomic<bool> Tracer::s_enabled(false);
+
+void Tracer::Enable(bool enable)
+{
+  s_enabled.store(enable, memory_order_relaxed);
+}
+
+int64_t Tracer::Now()
+{
+  return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - s_origin).count();
+}
+
+void Tracer::Record(const char* name, const char* category, const string& detail, int64_t start, int64_t end)
+{
+  ThreadBuffer& buffer = GetThreadBuffer();
+  lock_guard<mutex> guard(buffer.lock);
+  buffer.events.push_back({ name, category, detail, start, end - start });
+}
+
+void Tracer::SetThreadName(const string& name)
+{
+  ThreadBuffer& buffer = GetThreadBuffer();
+  lock_guard<mutex> guard(buffer.lock);
+  buffer.name = name;
+}
+
+string Tracer::ToJson()
+{
+  ostringstream out;
+  out << "{\"traceEvents\":[";
+  const char* sep = "\n";
+
+  Registry& registry = GetRegistry();
+  lock_guard<mutex> guard(registry.lock);
+  for(const auto& buffer : registry.buffers) {
+    lock_guard<mutex> bufferGuard(buffer->lock);
+    if(!buffer->name.empty()) {
+      out << sep << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid << ",\"args\":{\"name\":\"";
+      out << Tracer::EscapeJson(buffer->name);
+      out << "\"}}";
+      sep = ",\n";
+    }
+    for(const auto& event : buffer->events) {
+      out << sep << "{\"name\":\"";
+      out << Tracer::EscapeJson(event.name);
+      out << "\",\"cat\":\"";
+      out << Tracer::EscapeJson(event.category);
+      out << "\",\"ph\":\"X\",\"ts\":" << event.start << ",\"dur\":" << event.duration
+          << ",\"pid\":1,\"tid\":" << buffer->tid;
+      if(!event.detail.empty()) {
+        out << ",\"args\":{\"detail\":\"";
+        out << Tracer::EscapeJson(event.detail);
+        out << "\"}";
+      }
+      out << "}";
+      sep = ",\n";
+    }
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  return out.str();
+}
+
+bool Tracer::Write(const string& fileName)
+{
+  return RteFileWriter::WriteFile(fileName, ToJson());
+}
+
+void Tracer::Clear()
+{
+  Registry& registry = GetRegistry();
+  lock_guard<mutex> guard(registry.lock);
+  for(const auto& buffer : registry.buffers) {
+    lock_guard<mutex> bufferGuard(buffer->lock);
+    buffer->events.clear();
+  }
+}
+
+string Tracer::EscapeJson(const string& text)
+{
+  static const char hex[] = "0123456789abcdef";
+  string json;
+  json.reserve(text.size());
+  for(const char c : text) {
+    switch(c) {
+      case '"':  json += "\\\""; break;
+      case '\\': json += "\\\\"; break;
+      case '\n': json += "\\n";  break;
+      case '\r': json += "\\r";  break;
+      case '\t': json += "\\t";  break;
+      default:
+        if((unsigned char)c < 0x20) {
+          json += "\\u00";
+          json += hex[(c >> 4) & 0xF];
+          json += hex[c & 0xF];
+        } else {
+          json += c;
+        }
+    }
+  }
+  return json;
+}
+
+size_t Tracer::GetSpanCount()
+{
+  size_t count = 0;
+  Registry& registry = GetRegistry();
+  lock_guard<mutex> guard(registry.lock);
+  for(const auto& buffer : registry.buffers) {
+    lock_guard<mutex> bufferGuard(buffer->lock);
+    count += buffer->events.size();
+  }
+  return count;
+}
+
+TraceFile::TraceFile(const string& fileName, const function<void(const string&)>& onWriteError) :
+  m_fileName(fileName),
+  m_onWriteError(onWriteError)
+{
+  if(!m_fileName.empty()) {
+    Tracer::Enable(true);
+    Tracer::SetThreadName("main");
+  }
+}
+
+TraceFile::~TraceFile()
+{
+  Stop();
+}
+
+bool TraceFile::Stop()
+{
+  if(m_fileName.empty()) {
+    return true;
+  }
+  Tracer::Enable(false);
+  const bool written = Tracer::Write(m_fileName);
+  if(!written && m_onWriteError) {
+    m_onWriteError(m_fileName);
+  }
+  Tracer::Clear();
+  m_fileName.clear();
+  return written;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "gtest/gtest.h"
+#include "Tracer.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+class TracerTest :public ::testing::Test {
+protected:
+  void SetUp() override
+  {
+    Tracer::Clear();
+  }
+  void TearDown() override
+  {
+    Tracer::Enable(false);
+    Tracer::Clear();
+  }
+};
+
+TEST_F(TracerTest, Disabled) {
+  {
+    TraceSpan span("Disabled", "test", "detail");
+  }
+  EXPECT_EQ(0, Tracer::GetSpanCount());
+}
+
+TEST_F(TracerTest, SpansOfThreads) {
+  Tracer::Enable(true);
+  Tracer::SetThreadName("main");
+  {
+    TraceSpan outer("Outer", "test");
+    vector<thread> threads;
+    for(int i = 0; i < 4; i++) {
+      threads.emplace_back([i]() {
+        TraceSpan span("Worker", "test", "job \"" + to_string(i) + "\"\\");
+      });
+    }
+    for(auto& t : threads) {
+      t.join();
+    }
+  }
+  EXPECT_EQ(5, Tracer::GetSpanCount());
+
+  const string json = Tracer::ToJson();
+  EXPECT_EQ(0, json.find("{\"traceEvents\":["));
+  EXPECT_NE(string::npos, json.find("\"name\":\"thread_name\",\"ph\":\"M\""));
+  EXPECT_NE(string::npos, json.find("{\"name\":\"Outer\",\"cat\":\"test\",\"ph\":\"X\",\"ts\":"));
+  EXPECT_NE(string::npos, json.find("\"args\":{\"detail\":\"job \\\"3\\\"\\\\\"}"));
+  EXPECT_NE(string::npos, json.find("\"displayTimeUnit\":\"ms\"}"));
+
+  // thread ids differ from the main thread
+  const auto outerPos = json.find("\"Outer\"");
+  const auto workerPos = json.find("\"Worker\"");
+  const auto tid = [&json](size_t pos) {
+    pos = json.find("\"tid\":", pos) + 6;
+    return json.substr(pos, json.find_first_of(",}", pos) - pos);
+  };
+  EXPECT_NE(tid(outerPos), tid(workerPos));
+
+  const string fileName = "TracerTest.json";
+  EXPECT_TRUE(Tracer::Write(fileName));
+  ifstream file(fileName);
+  stringstream content;
+  content << file.rdbuf();
+  file.close();
+  EXPECT_EQ(json, content.str());
+  remove(fileName.c_str());
+
+  Tracer::Clear();
+  EXPECT_EQ(0, Tracer::GetSpanCount());
+}
+
+TEST_F(TracerTest, TraceFile) {
+  const string fileName = "TraceFileTest.json";
+  {
+    TraceFile traceFile(fileName);
+    EXPECT_TRUE(Tracer::IsEnabled());
+    TraceSpan span("Command", "test");
+  }
+  EXPECT_FALSE(Tracer::IsEnabled());
+  EXPECT_EQ(0, Tracer::GetSpanCount());
+  ifstream file(fileName);
+  stringstream content;
+  content << file.rdbuf();
+  file.close();
+  EXPECT_NE(string::npos, content.str().find("{\"name\":\"Command\",\"cat\":\"test\""));
+  remove(fileName.c_str());
+
+  // no file name: nothing is recorded
+  {
+    TraceFile traceFile("");
+    EXPECT_FALSE(Tracer::IsEnabled());
+    EXPECT_TRUE(traceFile.Stop());
+  }
+
+  // write error is reported once: a file is in the way of the trace file's directory
+  ofstream(fileName) << "file";
+  int errors = 0;
+  {
+    TraceFile traceFile(fileName + "/TraceFileTest.json", [&errors](const string&) { errors++; });
+    EXPECT_FALSE(traceFile.Stop());
+  }
+  EXPECT_EQ(1, errors);
+  remove(fileName.c_str());
+}
+
+TEST_F(TracerTest, EscapeJson) {
+  EXPECT_EQ("plain text", Tracer::EscapeJson("plain text"));
+  EXPECT_EQ("C:\\\\path\\\\\\\"file\\\".svd", Tracer::EscapeJson("C:\\path\\\"file\".svd"));
+  EXPECT_EQ("line\\nnext\\r\\tend", Tracer::EscapeJson("line\nnext\r\tend"));
+  EXPECT_EQ("\\u0001\\u001f", Tracer::EscapeJson(string("\x01\x1f")));
+}
@@ -9,6 +9,8 @@
 
 #include "ISchemaChecker.h"
 
+#include "yaml-cpp/yaml.h"
+
 class YmlSchemaChecker : public ISchemaChecker{
 public:
 
@@ -19,6 +21,15 @@ public:
    * @return true if validation pass, otherwise false
   */
   bool ValidateFile(const std::string& file, const std::string& schemaFile) override;
+
+  /**
+   * @brief Validates YAML data already loaded from a file with respect to schema given
+   * @param data YAML data loaded from file
+   * @param file input YAML file name used for error reporting
+   * @param schemaFile input schema file defines the structure of YAML
+   * @return true if validation pass, otherwise false
+  */
+  bool ValidateData(const YAML::Node& data, const std::string& file, const std::string& schemaFile);
 };
 
 #endif // YML_SCHEMACHECKER_H
@@ -12,5 +12,11 @@ bool YmlSchemaChecker::ValidateFile(const std::string& file, const std::string&
   YmlSchemaValidator validator(file, schemaFile);
   return validator.Validate(m_errors);
 }
+
+bool YmlSchemaChecker::ValidateData(const YAML::Node& data, const std::string& file, const std::string& schemaFile)
+{
+  YmlSchemaValidator validator(data, file, schemaFile);
+  return validator.Validate(m_errors);
+}
 // end of YmlSchemaChecker.cpp
 
@@ -13,10 +13,10 @@
 
 using namespace std;
 
-YmlSchemaErrorHandler::YmlSchemaErrorHandler(const std::string& filePath) :
-  m_yamlFile(filePath)
+YmlSchemaErrorHandler::YmlSchemaErrorHandler(const std::string& filePath, const YAML::Node& yamlData) :
+  m_yamlFile(filePath),
+  m_yamlData(yamlData)
 {
-  m_yamlData = YAML::LoadFile(m_yamlFile);
   m_errList.clear();
 }
 
@@ -34,13 +34,19 @@ void YmlSchemaErrorHandler::error(const nlohmann::json::json_pointer& ptr,
     schemaNodesStr = schemaNodesStr.substr(1, schemaNodesStr.size());
     RteUtils::SplitString(segments, schemaNodesStr, '/');
   }
+  // the data is shared with the caller: use const access, a non-const lookup would insert missing keys
   std::vector<YAML::Node> nodes;
   nodes.push_back(m_yamlData);
   for (auto& segment : segments) {
-    nodes.push_back(nodes.back()[segment]);
+    const YAML::Node& node = nodes.back();
+    const YAML::Node& child = node.IsSequence() ? node[RteUtils::StringToUnsigned(segment)] : node[segment];
+    if (!child.IsDefined()) {
+      break;
+    }
+    nodes.push_back(child);
   }
   auto mark = nodes.back().Mark();
-  if (nodes.size() > 1) {
+  if (nodes.size() > 1 && nodes.size() == segments.size() + 1 && prev(prev(nodes.end()))->IsMap()) {
     auto parent = *prev(prev(nodes.end()));
     for (const auto& item : parent) {
       if (!item.first.Mark().is_null() && item.first.as<string>() == segments.back()) {
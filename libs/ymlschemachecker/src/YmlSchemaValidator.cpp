@@ -17,7 +17,19 @@ YmlSchemaValidator::YmlSchemaValidator(
   const std::string& dataFilePath,
   const std::string& schemaFilePath):
   m_dataFile(dataFilePath),
-  m_schemaFile(schemaFilePath)
+  m_schemaFile(schemaFilePath),
+  m_yamlLoaded(false)
+{
+}
+
+YmlSchemaValidator::YmlSchemaValidator(
+  const YAML::Node& data,
+  const std::string& dataFilePath,
+  const std::string& schemaFilePath) :
+  m_dataFile(dataFilePath),
+  m_schemaFile(schemaFilePath),
+  m_yamlData(data),
+  m_yamlLoaded(true)
 {
 }
 
@@ -27,6 +39,10 @@ YmlSchemaValidator::~YmlSchemaValidator()
 json YmlSchemaValidator::ReadData() {
   json data;
 
+  if (m_yamlLoaded) {
+    return YamlToJson(m_yamlData);
+  }
+
   std::string extn = RteUtils::ExtractFileExtension(m_dataFile, false);
   if (extn == "json") {
     std::ifstream file(m_dataFile);
@@ -44,15 +60,15 @@ json YmlSchemaValidator::ReadData() {
     file.close();
   }
   else if (extn == "yml" || extn == "yaml") {
-    YAML::Node yamldata;
     try {
-      yamldata = YAML::LoadFile(m_dataFile);
+      m_yamlData = YAML::LoadFile(m_dataFile);
+      m_yamlLoaded = true;
     }
     catch (YAML::Exception& e) {
       throw RteError(m_dataFile, "schema check failed, verify syntax", e.mark.line + 1, e.mark.column + 1);
     }
 
-    data = YamlToJson(yamldata);
+    data = YamlToJson(m_yamlData);
   }
 
   return data;
@@ -181,7 +197,8 @@ bool YmlSchemaValidator::Validate(std::list<RteError>& errList) {
   }
 
   // 3) do the actual validation of the data
-  YmlSchemaErrorHandler handler(m_dataFile);
+  // error locations are taken from the data already loaded, json data has no marks
+  YmlSchemaErrorHandler handler(m_dataFile, m_yamlLoaded ? m_yamlData : YAML::LoadFile(m_dataFile));
   validator.validate(data, handler);
 
   errList = handler.GetAllErrors();
@@ -21,6 +21,8 @@ class YmlSchemaValidator {
 public:
   YmlSchemaValidator(const std::string& dataFilePath,
     const std::string& schemaFilePath);
+  YmlSchemaValidator(const YAML::Node& data, const std::string& dataFilePath,
+    const std::string& schemaFilePath);
   ~YmlSchemaValidator();
 
   /**
@@ -41,6 +43,8 @@ private:
 
   std::string m_dataFile;
   std::string m_schemaFile;
+  YAML::Node m_yamlData;
+  bool m_yamlLoaded;
 };
 
 #endif // YML_SCHEMAVALIDATOR_H
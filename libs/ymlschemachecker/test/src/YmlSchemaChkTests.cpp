@@ -49,6 +49,30 @@ TEST_F(YmlSchemaChkTests, validate_clayer_yml_schema) {
   EXPECT_EQ(ymlTree.GetErrors(), errList.size());
 }
 
+TEST_F(YmlSchemaChkTests, validate_loaded_yml_data) {
+  string datafile = testinput_folder + "/sample-data/clayer.yaml";
+  string schemafile = testinput_folder + "/clayer.schema.json";
+
+  YmlSchemaChecker fileChecker;
+  EXPECT_FALSE(fileChecker.ValidateFile(datafile, schemafile));
+  auto& fileErrList = fileChecker.GetErrors();
+
+  // validating loaded data reports the same errors and leaves the data untouched
+  const YAML::Node data = YAML::LoadFile(datafile);
+  const string dump = YAML::Dump(data);
+  YmlSchemaChecker dataChecker;
+  EXPECT_FALSE(dataChecker.ValidateData(data, datafile, schemafile));
+  auto& dataErrList = dataChecker.GetErrors();
+  ASSERT_EQ(dataErrList.size(), fileErrList.size());
+  for (auto& err : fileErrList) {
+    auto errItr = find_if(dataErrList.begin(), dataErrList.end(), [&](const RteError& dataErr) {
+      return dataErr.m_file == err.m_file && dataErr.m_line == err.m_line && dataErr.m_col == err.m_col;
+    });
+    EXPECT_TRUE(dataErrList.end() != errItr);
+  }
+  EXPECT_EQ(dump, YAML::Dump(data));
+}
+
 TEST_F(YmlSchemaChkTests, validate_cproject_yml_schema) {
   string datafile = testinput_folder + "/sample-data/cproject.yaml";
   string schemafile = testinput_folder + "/cproject.schema.json";
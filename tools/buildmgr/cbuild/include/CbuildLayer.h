@@ -13,7 +13,9 @@
 #include <string>
 #include <sstream>
 #include <set>
+#include <list>
 #include <map>
+#include <vector>
 
 /**
  * @brief CPRJ schema definitions
@@ -95,6 +97,13 @@ public:
   */
   bool WriteXmlFile(const std::string &file, XMLTree* tree, const bool saveBackup=false);
 
+  /**
+   * @brief format and write several xml files concurrently
+   * @param files list of pairs of output file path and tree to be written
+   * @return true if all xml files are written successfully, otherwise false
+  */
+  static bool WriteXmlFiles(const std::vector<std::pair<std::string, XMLTree*>>& files);
+
   /**
    * @brief initialize header (tool and timestamp) information
    * @param file path to the input project file
@@ -128,8 +137,12 @@ public:
 
 protected:
   static bool GetSections(const XMLTree* tree, xml_elements* elements, std::string* layerName);
+  static XMLTree* ParseXml(const std::string& file);
+  bool InitSections(XMLTree* tree, std::string* layerName);
+  bool InitLayerXml(const std::vector<std::string>& files, std::list<std::string>& layerNames);
   static void CopyElement(XMLTreeElement* destination, const XMLTreeElement* origin, const bool create=true);
   static void CopyMatchedChildren(const XMLTreeElement* origin, XMLTreeElement* destination, const std::string& layer, const std::string& parentLayer="");
+  static void CopyMatchedChildren(const XMLTreeElement* origin, const std::map<std::string, XMLTreeElement*>& destinations, const std::string& parentLayer="");
   static void RemoveMatchedChildren(const std::string& layer, XMLTreeElement* item);
   static void CopyNestedGroups (XMLTreeElement* destination, const XMLTreeElement* origin);
   static void GetArgsFromChild(const XMLTreeElement* element, const std::string& reference, std::set<std::string>& argList);
@@ -7,15 +7,18 @@
 #include "Cbuild.h"
 #include "CbuildKernel.h"
 #include "CbuildLayer.h"
+#include "Tracer.h"
 
 using namespace std;
 
 
 bool CreateRte(const CbuildRteArgs& args) {
+  TraceSpan span("CreateRte", "cbuild", args.file);
   return CbuildKernel::Get()->Construct(args);
 }
 
 bool RunLayer(const int &cmd, const CbuildLayerArgs& args) {
+  TraceSpan span("RunLayer", "cbuild", args.file);
   CbuildLayer clayer;
   switch (cmd) {
     case L_EXTRACT: return clayer.Extract (args);
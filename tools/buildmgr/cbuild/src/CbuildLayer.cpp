@@ -11,7 +11,9 @@
 #include "CbuildUtils.h"
 
 #include "ErrLog.h"
+#include "JobPool.h"
 #include "RteUtils.h"
+#include "RteFileWriter.h"
 #include "RteFsUtils.h"
 #include "RteModel.h"
 #include "XMLTreeSlim.h"
@@ -26,12 +28,14 @@
 #include <list>
 #include <set>
 #include <map>
+#include <memory>
 #include <algorithm>
 
 using namespace std;
 
 #define PDEXT ".cprj"             // Project description extension
 #define CLEXT ".clayer"           // Layer extension
+#define LAYER_PREFIX "layer."     // Layer infrastructure file prefix
 #define EOL "\n"                  // End of line
 
 CbuildLayer::CbuildLayer(void) {
@@ -101,7 +105,10 @@ bool CbuildLayer::Extract(const CbuildLayerArgs& args) {
   // Set absolute output path
   const string& outputPath = RteFsUtils::AbsolutePath(RteUtils::BackSlashesToSlashes(args.output)).generic_string();
 
-  // Iterate over list of layers
+  // Create the sections of the selected layers up to the target
+  vector<string> layerNames;
+  vector<unique_ptr<XMLTree>> layerTrees;
+  map<string, XMLTreeElement*> layerRoots;
   const auto layers = m_cprj->layers->GetChildren();
   for (auto layer : layers) {
     const string& layerName = layer->GetAttribute("name");
@@ -169,40 +176,63 @@ bool CbuildLayer::Extract(const CbuildLayerArgs& args) {
     if (layer->GetAttributeAsBool("hasTarget")) {
       if (!m_cprj->target) {
         // Missing <target> element
+        delete xmlTreeLayer;
         LogMsg("M609", VAL("NAME", "target"));
         return false;
       }
       CopyElement(rootElement, m_cprj->target);
     }
 
-    // Components
-    CopyMatchedChildren(m_cprj->components, rootElement, layerName);
+    // A repeated layer name replaces the previous one
+    if (layerRoots.find(layerName) != layerRoots.end()) {
+      const size_t index = find(layerNames.begin(), layerNames.end(), layerName) - layerNames.begin();
+      layerTrees[index].reset(xmlTreeLayer);
+    } else {
+      layerNames.push_back(layerName);
+      layerTrees.emplace_back(xmlTreeLayer);
+    }
+    layerRoots[layerName] = rootElement;
+  }
 
-    // Files
-    CopyMatchedChildren(m_cprj->files, rootElement, layerName);
+  // Components and files of all selected layers in a single pass
+  if (m_cprj->components) {
+    CopyMatchedChildren(m_cprj->components, layerRoots);
+  }
+  if (m_cprj->files) {
+    CopyMatchedChildren(m_cprj->files, layerRoots);
+  }
 
-    // Write Xml file
-    const string& layerPath = outputPath + "/" + layerName;
-    const string& layerFilename = layerPath + "/" + layerName + CLEXT;
+  // Create output directories
+  vector<pair<string, XMLTree*>> layerFilenames;
+  for (size_t i = 0; i < layerNames.size(); i++) {
+    const string& layerPath = outputPath + "/" + layerNames[i];
     error_code ec;
     fs::create_directories(layerPath, ec);
     if (ec) {
       LogMsg("M211", PATH(layerPath));
       return false;
     }
-    if (!WriteXmlFile(layerFilename, xmlTreeLayer)) {
-      return false;
-    }
+    layerFilenames.push_back({ layerPath + "/" + layerNames[i] + CLEXT, layerTrees[i].get() });
+  }
 
-    // Find infrastructure files
-    for (auto& p : fs::recursive_directory_iterator(m_cprjPath, ec)) {
-      const string& file = p.path().stem().generic_string();
-      if (file == "layer."+layerName) {
-        m_layerFiles[layerName].insert(p.path().generic_string().substr(m_cprjPath.length(), string::npos));
-      }
+  // Write Xml files
+  if (!WriteXmlFiles(layerFilenames)) {
+    return false;
+  }
+
+  // Find infrastructure files of all selected layers
+  error_code ec;
+  for (auto& p : fs::recursive_directory_iterator(m_cprjPath, ec)) {
+    const string& file = p.path().stem().generic_string();
+    if ((file.compare(0, sizeof(LAYER_PREFIX) - 1, LAYER_PREFIX) == 0) &&
+      (layerRoots.find(file.substr(sizeof(LAYER_PREFIX) - 1)) != layerRoots.end())) {
+      m_layerFiles[file.substr(sizeof(LAYER_PREFIX) - 1)].insert(p.path().generic_string().substr(m_cprjPath.length(), string::npos));
     }
+  }
 
-    // Copy files
+  // Copy files
+  for (const auto& layerName : layerNames) {
+    const string& layerPath = outputPath + "/" + layerName;
     for (auto file : m_layerFiles[layerName]) {
       const string& origin = m_cprjPath + "/" + file;
       const string& destination = layerPath + "/" + file;
@@ -265,12 +295,8 @@ bool CbuildLayer::Compose(const CbuildLayerArgs& args) {
 
   // Parse layer files
   list<string> layerNameList;
-  for (auto layerFile : args.layerFiles) {
-    string layerName;
-    if (!InitXml(layerFile, &layerName)) {
-      return false;
-    }
-    layerNameList.push_back(layerName);
+  if (!InitLayerXml(args.layerFiles, layerNameList)) {
+    return false;
   }
 
   // Iterate over list of layers
@@ -400,17 +426,23 @@ bool CbuildLayer::Compose(const CbuildLayerArgs& args) {
   }
 
   // Get readme file in the format layer.<name>.md
-  for (auto layerName : layerNameList) {
-    const string& readmeFile = "layer." + layerName + ".md";
-    error_code ec;
-    for (auto& p : fs::recursive_directory_iterator(m_cprjPath, ec)) {
-      if (fs::is_regular_file(p, ec)) {
-        if (p.path().filename() == readmeFile) {
-          m_readmeFiles.push_back(p.path().generic_string());
-        }
+  map<string, list<string>> readmeFiles;
+  for (const auto& layerName : layerNameList) {
+    readmeFiles[LAYER_PREFIX + layerName + ".md"];
+  }
+  error_code ec;
+  for (auto& p : fs::recursive_directory_iterator(m_cprjPath, ec)) {
+    if (fs::is_regular_file(p, ec)) {
+      auto it = readmeFiles.find(p.path().filename().generic_string());
+      if (it != readmeFiles.end()) {
+        it->second.push_back(p.path().generic_string());
       }
     }
   }
+  for (const auto& layerName : layerNameList) {
+    const auto& files = readmeFiles[LAYER_PREFIX + layerName + ".md"];
+    m_readmeFiles.insert(m_readmeFiles.end(), files.begin(), files.end());
+  }
 
   // Merge readme files
   if (!m_readmeFiles.empty()) {
@@ -479,11 +511,9 @@ bool CbuildLayer::Add(const CbuildLayerArgs& args) {
   }
 
   // Parse layer files
-  for (auto layerFile : args.layerFiles) {
-    string layerName;
-    if (!InitXml(layerFile, &layerName)) {
-      return false;
-    }
+  list<string> layerNameList;
+  if (!InitLayerXml(args.layerFiles, layerNameList)) {
+    return false;
   }
 
   // Iterate over list of layers
@@ -766,9 +796,14 @@ bool CbuildLayer::Remove(const CbuildLayerArgs& args) {
 }
 
 void CbuildLayer::CopyMatchedChildren(const XMLTreeElement* origin, XMLTreeElement* destination, const string& layer, const string& parentLayer) {
+  CopyMatchedChildren(origin, map<string, XMLTreeElement*>{ { layer, destination } }, parentLayer);
+}
+
+void CbuildLayer::CopyMatchedChildren(const XMLTreeElement* origin, const map<string, XMLTreeElement*>& destinations, const string& parentLayer) {
   /*
   CopyMatchedChildren:
-  Recursively copy origin element ('files' or 'components') and its children elements into destination parent if the children's layer attribute matches
+  Recursively copy origin element ('files' or 'components') and its children elements into the destination parent of each layer
+  if the children's layer attribute matches, the origin tree is walked once for all layers
   */
   const string& tag = origin->GetTag();
   const string& originLayer = origin->GetAttribute("layer");
@@ -776,28 +811,37 @@ void CbuildLayer::CopyMatchedChildren(const XMLTreeElement* origin, XMLTreeEleme
   // Element with empty layer attribute inherits the layer assignment from its parent
   const string& effectiveLayer = originLayer.empty() ? parentLayer : originLayer;
 
-  if (tag == "group") {
-    // Skip group with different layer assignment but process the nested groups further if unassigned
-    if (!effectiveLayer.empty() && (effectiveLayer != layer)) {
-      return;
-    }
-  } else if (!((tag == "files") || (tag == "components"))) {
-    // Skip any other element with different or empty layer assignment (except 'files' and 'components')
-    if (effectiveLayer != layer) {
+  map<string, XMLTreeElement*> matched;
+  if (((tag == "group") && effectiveLayer.empty()) || (tag == "files") || (tag == "components")) {
+    // Unassigned group is processed further for all layers, as well as 'files' and 'components'
+    matched = destinations;
+  } else {
+    // Skip group or any other element with different or empty layer assignment
+    auto it = destinations.find(effectiveLayer);
+    if (it == destinations.end()) {
       return;
     }
+    matched.insert(*it);
   }
 
-  XMLTreeElement* copy = destination->CreateElement(origin->GetTag());
-  copy->SetText(origin->GetText());
-  copy->SetAttributes(origin->GetAttributes());
+  map<string, XMLTreeElement*> copies;
+  for (const auto& [layer, destination] : matched) {
+    XMLTreeElement* copy = destination->CreateElement(origin->GetTag());
+    copy->SetText(origin->GetText());
+    copy->SetAttributes(origin->GetAttributes());
+    copies[layer] = copy;
+  }
   for (auto child : origin->GetChildren()) {
-    CopyMatchedChildren(child, copy, layer, effectiveLayer);
+    CopyMatchedChildren(child, copies, effectiveLayer);
   }
 
   // Remove 'files' or 'group' if empty
-  if ((!copy->HasChildren()) && ((tag == "files") || (tag == "group"))) {
-    destination->RemoveChild(copy, true);
+  if ((tag == "files") || (tag == "group")) {
+    for (const auto& [layer, copy] : copies) {
+      if (!copy->HasChildren()) {
+        matched[layer]->RemoveChild(copy, true);
+      }
+    }
   }
 }
 
@@ -941,10 +985,18 @@ void CbuildLayer::GetArgsFromChild(const XMLTreeElement* parent, const string& t
 }
 
 bool CbuildLayer::InitXml(const string &file, string* layerName) {
+  XMLTree* tree = ParseXml(file);
+  if (!tree) {
+    return false;
+  }
+  return InitSections(tree, layerName);
+}
+
+XMLTree* CbuildLayer::ParseXml(const string &file) {
   error_code ec;
   if (!fs::exists(file, ec)) { // file does not exist
     LogMsg("M204", PATH(file));
-    return false;
+    return nullptr;
   }
 
   // Parse Xml Tree
@@ -953,9 +1005,12 @@ bool CbuildLayer::InitXml(const string &file, string* layerName) {
   if (!tree->AddFileName(file, true)) {
     delete tree;
     LogMsg("M203", PATH(file));
-    return false;
+    return nullptr;
   }
+  return tree;
+}
 
+bool CbuildLayer::InitSections(XMLTree* tree, string* layerName) {
   // Get sections
   xml_elements *elements = new xml_elements();
   if (!GetSections(tree, elements, layerName)) {
@@ -976,6 +1031,40 @@ bool CbuildLayer::InitXml(const string &file, string* layerName) {
   return true;
 }
 
+bool CbuildLayer::InitLayerXml(const vector<string>& files, list<string>& layerNames) {
+  /*
+  InitLayerXml:
+  Parse layer files concurrently, messages and sections are processed in the order of the given files
+  */
+  struct ParseJob {
+    XMLTree*       tree = nullptr;
+    ErrLogRecorder errLog;
+  };
+  vector<ParseJob> jobs(files.size());
+  JobPool::Run(jobs.size(), [&](size_t i) {
+    jobs[i].errLog.Activate();
+    jobs[i].tree = ParseXml(files[i]);
+    jobs[i].errLog.Deactivate();
+  });
+
+  bool success = true;
+  for (auto& job : jobs) {
+    if (!success) {
+      // processing stops at the first failing file
+      delete job.tree;
+      continue;
+    }
+    job.errLog.Replay(ErrLog::Get());
+    string layerName;
+    if (!job.tree || !InitSections(job.tree, &layerName)) {
+      success = false;
+      continue;
+    }
+    layerNames.push_back(layerName);
+  }
+  return success;
+}
+
 bool CbuildLayer::GetSections(const XMLTree* tree, xml_elements* elements, string* layerName) {
   /*
   GetSections:
@@ -1064,16 +1153,29 @@ bool CbuildLayer::WriteXmlFile(const string &file, XMLTree* tree, const bool sav
   }
 
   // Save file
-  ofstream xmlFile(file);
-  if (!xmlFile) {
+  if (!RteFileWriter::WriteFile(file, xmlContent + '\n', true)) {
     LogMsg("M210", PATH(file));
     return false;
   }
 
-  xmlFile << xmlContent;
-  xmlFile << std::endl;
-  xmlFile.close();
+  return true;
+}
 
+bool CbuildLayer::WriteXmlFiles(const vector<pair<string, XMLTree*>>& files) {
+  // Format and save files concurrently
+  vector<char> written(files.size(), false);
+  JobPool::Run(files.size(), [&](size_t i) {
+    XmlFormatter xmlFormatter(files[i].second, SCHEMA_FILE, SCHEMA_VERSION);
+    written[i] = RteFileWriter::WriteFile(files[i].first, xmlFormatter.GetContent() + '\n', true);
+  });
+
+  // Report the first failure in the order of the given files
+  for (size_t i = 0; i < files.size(); i++) {
+    if (!written[i]) {
+      LogMsg("M210", PATH(files[i].first));
+      return false;
+    }
+  }
   return true;
 }
 
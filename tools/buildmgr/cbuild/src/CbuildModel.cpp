@@ -22,12 +22,15 @@
 #include "RtePackage.h"
 #include "RteProject.h"
 #include "RteUtils.h"
+#include "Tracer.h"
 
 #include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 #include <regex>
 
 #define EOL "\n"        // End of line
@@ -44,7 +47,10 @@ CbuildModel::~CbuildModel() {
 bool CbuildModel::Create(const CbuildRteArgs& args) {
   // load cprj file
   CbuildKernel::Get()->SetCmsisPackRoot(args.rtePath);
-  m_cprjProject = CbuildKernel::Get()->LoadCprj(args.file, args.toolchain, true, args.updateRteFiles);
+  {
+    TraceSpan span("CbuildKernel::LoadCprj", "cbuild", args.file);
+    m_cprjProject = CbuildKernel::Get()->LoadCprj(args.file, args.toolchain, true, args.updateRteFiles);
+  }
   if (!m_cprjProject)
     return false;
 
@@ -297,38 +303,100 @@ bool CbuildModel::GenerateAuditData() {
     return false;
   }
 
-  const RteComponentMap components = m_cprjTarget->GetFilteredComponents();
-  const map<string, RteApi*> apis = m_cprjTarget->GetFilteredApis();
-  if (!components.empty()) {
-    const map<string, RteFileInstance*> configFiles = m_cprjProject->GetFileInstances();
-    ostringstream auditData;
-    for (auto pack : packs) {
-      auditData << EOL << EOL << "# Package: " << pack.second->GetPackageID();
-      auditData << EOL << "  Location: " << pack.second->GetAbsolutePackagePath();
-
-      for (auto component : components) {
-        if ((component.second->GetPackage()->Compare(pack.second)) && (m_cprjTarget->IsComponentUsed(component.second))) {
-          auditData << EOL << EOL << "  * Component: " << component.first;
-
-          for (auto configFile : configFiles) {
-            const RteComponent *configFileComponent = configFile.second->GetComponent(m_targetName);
-            if (configFileComponent && configFileComponent->Compare(component.second)) {
-              string instanceName = configFile.second->GetInstanceName();
-              RteFsUtils::NormalizePath(instanceName, m_prjFolder);
-              auditData << EOL << "    - ConfigFile: " << instanceName << ":" << configFile.second->GetVersionString();
-              if (configFile.second->HasNewVersion(m_targetName) > 0) auditData << " [" << configFile.second->GetFile(m_targetName)->GetVersionString() << "]";
-            }
+  const RteComponentMap& components = m_cprjTarget->GetFilteredComponents();
+  const map<string, RteApi*>& apis = m_cprjTarget->GetFilteredApis();
+  if (components.empty()) {
+    return true;
+  }
+
+  // find the loaded package an item belongs to: pointer lookup with fallback to attribute comparison
+  unordered_set<const RtePackage*> packSet;
+  for (const auto& [_, pack] : packs) {
+    packSet.insert(pack);
+  }
+  auto findPack = [&](const RtePackage* itemPack) -> const RtePackage* {
+    if (!itemPack || packSet.find(itemPack) != packSet.end()) {
+      return itemPack;
+    }
+    for (const auto& [_, pack] : packs) {
+      if (itemPack->Compare(pack)) {
+        return pack;
+      }
+    }
+    return nullptr;
+  };
+
+  // group used components by package keeping the order of the components map
+  unordered_map<const RtePackage*, vector<const RteComponentMap::value_type*> > packComponents;
+  unordered_set<RteComponent*> usedComponents;
+  for (const auto& component : components) {
+    if (m_cprjTarget->IsComponentUsed(component.second)) {
+      const RtePackage* pack = findPack(component.second->GetPackage());
+      if (pack) {
+        packComponents[pack].push_back(&component);
+        usedComponents.insert(component.second);
+      }
+    }
+  }
+
+  // group selected APIs by package keeping the order of the APIs map
+  unordered_map<const RtePackage*, vector<const map<string, RteApi*>::value_type*> > packApis;
+  for (const auto& api : apis) {
+    if (m_cprjTarget->IsApiSelected(api.second)) {
+      const RtePackage* pack = findPack(api.second->GetPackage());
+      if (pack) {
+        packApis[pack].push_back(&api);
+      }
+    }
+  }
+
+  // group config file entries by used component keeping the order of the file instances map,
+  // only files indexed for the component aggregate of the used component instance are checked
+  unordered_map<const RteComponent*, vector<string> > componentConfigFiles;
+  for (const auto& component : usedComponents) {
+    RteComponentInstance* ci = m_cprjTarget->GetUsedComponentInstance(component);
+    const map<string, RteFileInstance*>* configFiles = ci ? m_cprjProject->GetComponentAggregateFileInstances(ci->GetComponentAggregateID()) : nullptr;
+    if (!configFiles) {
+      continue;
+    }
+    for (const auto& [_, configFile] : *configFiles) {
+      const RteComponent* configFileComponent = configFile->GetComponent(m_targetName);
+      if (!configFileComponent || (configFileComponent != component && !configFileComponent->Compare(component))) {
+        continue;
+      }
+      string instanceName = configFile->GetInstanceName();
+      RteFsUtils::NormalizePath(instanceName, m_prjFolder);
+      string entry = instanceName + ":" + configFile->GetVersionString();
+      if (configFile->HasNewVersion(m_targetName) > 0) entry += " [" + configFile->GetFile(m_targetName)->GetVersionString() + "]";
+      componentConfigFiles[component].push_back(entry);
+    }
+  }
+
+  ostringstream auditData;
+  for (const auto& [_, pack] : packs) {
+    auditData << EOL << EOL << "# Package: " << pack->GetPackageID();
+    auditData << EOL << "  Location: " << pack->GetAbsolutePackagePath();
+
+    const auto itComponents = packComponents.find(pack);
+    if (itComponents != packComponents.end()) {
+      for (const auto& component : itComponents->second) {
+        auditData << EOL << EOL << "  * Component: " << component->first;
+        const auto itConfigFiles = componentConfigFiles.find(component->second);
+        if (itConfigFiles != componentConfigFiles.end()) {
+          for (const auto& entry : itConfigFiles->second) {
+            auditData << EOL << "    - ConfigFile: " << entry;
           }
         }
       }
-      for (auto api : apis) {
-        if ((api.second->GetPackage()->Compare(pack.second)) && (m_cprjTarget->IsApiSelected(api.second))) {
-          auditData << EOL << EOL << "  * API: " << api.first.substr(2) << ":" << api.second->GetVersionString();
-        }
+    }
+    const auto itApis = packApis.find(pack);
+    if (itApis != packApis.end()) {
+      for (const auto& api : itApis->second) {
+        auditData << EOL << EOL << "  * API: " << api->first.substr(2) << ":" << api->second->GetVersionString();
       }
     }
-    m_auditData = auditData.str();
   }
+  m_auditData = auditData.str();
   return true;
 }
 
@@ -83,6 +83,8 @@ void InitMessageTable()
   table["M614"] = MessageEntry(MsgLevel::LEVEL_ERROR,    CRLF_B,   "Missing access sequence delimiter: '%ACCSEQDELIM%'!"                         );
   table["M615"] = MessageEntry(MsgLevel::LEVEL_ERROR,    CRLF_B,   "%PROP% '%VAL%' was not found in the loaded packs!"                           );
   table["M616"] = MessageEntry(MsgLevel::LEVEL_ERROR,    CRLF_B,   "compiler registration environment variable missing, format: %NAME%_TOOLCHAIN_<major>_<minor>_<patch>");
+  table["M617"] = MessageEntry(MsgLevel::LEVEL_ERROR,    CRLF_B,   "Toolchain '%NAME%' is not supported by the 'ninja' command, use the 'cmake' command!");
+  table["M618"] = MessageEntry(MsgLevel::LEVEL_ERROR,    CRLF_B,   "Processor '%CPU%' is not supported by the 'ninja' command!"                   );
 
   table["M630"] = MessageEntry(MsgLevel::LEVEL_WARNING,  CRLF_B,   "Device '%DEV%' is substituted with variant '%VAR%'."                         );
   table["M631"] = MessageEntry(MsgLevel::LEVEL_WARNING,  CRLF_B,   "Project must have exactly one target element!"                               );
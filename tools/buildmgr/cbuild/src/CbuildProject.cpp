@@ -170,14 +170,12 @@ bool CbuildProject::AddAdditionalAttributes(map<string, string> &attributes, con
   if (!d)
     return false;
 
-  const RteDevicePropertyMap& propMap = d->GetEffectiveProperties(procName);
-  if (propMap.empty())
+  const RteEffectivePropertyTable& propTable = d->GetEffectiveProperties(procName);
+  if (propTable.empty())
     return false;
 
   // iterate through properties:
-  for (auto itpm : propMap) {
-    const string& propType = itpm.first;                 // processor, feature, memory, etc.
-    const list<RteDeviceProperty*>& props = itpm.second;
+  for (auto& [propType, props] : propTable) { // processor, feature, memory, etc.
     for (auto p : props) {
       if (propType == "processor") {
         processorProperty = p;
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+ // NinjaGenerator.h
+#ifndef NINJAGENERATOR_H
+#define NINJAGENERATOR_H
+
+#include "BuildSystemGenerator.h"
+
+class NinjaGenerator : public BuildSystemGenerator {
+public:
+  /**
+   * @brief generate build.ninja for target building without CMake
+   * @return true if build.ninja file is generated successfully, otherwise false
+  */
+  bool GenBuildNinja(void);
+
+protected:
+  /**
+   * @brief language specific settings of a source files list:
+   *        lang: CMake language identifier (ASM, AS_LEG, AS_ARM, AS_GNU, CC, CXX)
+   *        rule: ninja rule used to translate the files
+   *        files: pointer to the collected files list
+  */
+  struct NinjaFilesList {
+    std::string lang;
+    std::string rule;
+    std::map<std::string, module>* files;
+  };
+
+  std::string GetCpuFlags(void) const;
+  std::string GetOptionsFlags(const std::string& lang, const std::string& optimize,
+    const std::string& debug, const std::string& warnings, const std::string& language);
+  std::string GetDefinesFlags(const std::string& lang, const std::list<std::string>& defines);
+  std::string GetIncludesFlags(const std::list<std::string>& includes);
+
+  static std::string EscapePath(const std::string& path);
+  static std::string EscapeValue(const std::string& value);
+  static std::string QuoteArg(const std::string& arg);
+};
+
+#endif  // NINJAGENERATOR_H
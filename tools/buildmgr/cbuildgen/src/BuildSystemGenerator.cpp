@@ -15,6 +15,7 @@
 #include "ErrLog.h"
 #include "RteFsUtils.h"
 #include "RteUtils.h"
+#include "Tracer.h"
 
 #include <ctime>
 #include <fstream>
@@ -34,6 +35,7 @@ BuildSystemGenerator::~BuildSystemGenerator(void) {
 }
 
 bool BuildSystemGenerator::Collect(const string& inputFile, const CbuildModel *model, const string& outdir, const string& intdir, const string& compilerRoot) {
+  TraceSpan span("BuildSystemGenerator::Collect", "cbuildgen", inputFile);
   error_code ec;
   m_projectDir = StrConv(RteFsUtils::AbsolutePath(inputFile).remove_filename().generic_string());
   m_workingDir = fs::current_path(ec).generic_string() + SS;
@@ -366,6 +368,7 @@ bool BuildSystemGenerator::CollectTranslationControls(const CbuildModel* model)
 }
 
 bool BuildSystemGenerator::GenAuditFile(void) {
+  TraceSpan span("BuildSystemGenerator::GenAuditFile", "cbuildgen");
   // Clean output directory
   if (!CleanOutDir()) {
     return false;
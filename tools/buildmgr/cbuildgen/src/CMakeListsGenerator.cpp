@@ -10,6 +10,8 @@
 
 #include "CbuildUtils.h"
 #include "ErrLog.h"
+#include "RteFileWriter.h"
+#include "Tracer.h"
 
 #include <fstream>
 #include <sstream>
@@ -18,6 +20,7 @@
 using namespace std;
 
 bool CMakeListsGenerator::GenBuildCMakeLists(void) {
+  TraceSpan span("CMakeListsGenerator::GenBuildCMakeLists", "cbuildgen");
 
   // Create CMakeLists stream
   m_genfile = m_intdir + "CMakeLists" + TXTEXT;
@@ -726,14 +729,10 @@ bool CMakeListsGenerator::GenBuildCMakeLists(void) {
   // Compare cmakelists contents
   if (!CompareFile(m_genfile, cmakelists)) {
     // Create cmakelists
-    ofstream fileStream(m_genfile);
-    if (!fileStream) {
+    if (!RteFileWriter::WriteFile(m_genfile, cmakelists.str(), true)) {
       LogMsg("M210", PATH(m_genfile));
       return false;
     }
-    fileStream << cmakelists.rdbuf();
-    fileStream << flush;
-    fileStream.close();
   }
   return true;
 }
@@ -7,6 +7,7 @@
 #include "AuxCmd.h"
 #include "CbuildGen.h"
 #include "CMakeListsGenerator.h"
+#include "NinjaGenerator.h"
 #include "ProductInfo.h"
 
 #include "Cbuild.h"
@@ -15,6 +16,7 @@
 #include "CrossPlatformUtils.h"
 #include "ErrLog.h"
 #include "ErrOutputterSaveToStdoutOrFile.h"
+#include "Tracer.h"
 
 #include <regex>
 
@@ -27,6 +29,7 @@ Usage:\n\
  Commands:\n\
    packlist              Write the URLs of missing packs into <ProjectFile>.cpinstall\n\
    cmake                 Generate CMakeLists.txt\n\
+   ninja                 Generate build.ninja (GCC toolchain only)\n\
    extract               Export <Layer1>...<LayerN> from <ProjectFile>.cprj into <OutDir> folder\n\
    remove                Delete <Layer1>...<LayerN> from <ProjectFile>.cprj\n\
    compose               Generate a new <ProjectFile>.cprj from <1.clayer>...<N.clayer>\n\
@@ -45,7 +48,8 @@ Usage:\n\
    --pack-root arg       Path to the CMSIS-Pack root directory that stores software packs\n\
    --compiler-root arg   Path to the installation 'etc' directory\n\
    --update-rte          Update the RTE directory and files\n\
-   --quiet               Run cbuildgen silently, printing only error messages\n\n\
+   --quiet               Run cbuildgen silently, printing only error messages\n\
+   --trace arg           Write Chrome trace event JSON of processing steps to file\n\n\
 Use 'cbuildgen <command> -h' for more information about a command.\n\
 ";
 
@@ -101,6 +105,7 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
   cxxopts::Option packRoot    ("pack-root", "Path to the CMSIS-Pack root directory that stores software packs", cxxopts::value<string>());
   cxxopts::Option compilerRoot("compiler-root", "Path to the installation 'etc' directory", cxxopts::value<string>());
   cxxopts::Option cprjFile    ("cprjfile", "CMSIS Project Description file", cxxopts::value<string>());
+  cxxopts::Option trace       ("trace", "Write Chrome trace event JSON of processing steps to file", cxxopts::value<string>());
   cxxopts::Option args        ("args", "", cxxopts::value<vector<string>>());
   cxxopts::Option help        ("h,help", "Print usage");
   cxxopts::Option version     ("V,version", "Print version");
@@ -108,19 +113,20 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
   // command options dictionary
   map<string, pair<vector<cxxopts::Option>, string>> optionsDict = {
     // { "Command", {<options...>, "positional arg help"}}
-    {"packlist", {{toolchain, update, intDir, outDir, quiet},            "<ProjectFile>.cprj"}},
-    {"cmake",    {{toolchain, update, intDir, outDir, updateRte, quiet}, "<ProjectFile>.cprj"}},
-    {"extract",  {{layer, outDir},                                       "<ProjectFile>.cprj"}},
-    {"remove",   {{layer},                                               "<ProjectFile>.cprj"}},
-    {"compose",  {{name, description},                                   "<ProjectFile>.cprj <1.clayer>...<N.clayer>"}},
-    {"add",      {{},                                                    "<ProjectFile>.cprj <1.clayer>...<N.clayer>"}},
-    {"mkdir",    {{},                                                    "<path1>...<pathN>"}},
-    {"touch",    {{},                                                    "<filepath1>...<filepathN>"}},
-    {"rmdir",    {{except},                                              "<path1>...<pathN>"}},
+    {"packlist", {{toolchain, update, intDir, outDir, quiet, trace},            "<ProjectFile>.cprj"}},
+    {"cmake",    {{toolchain, update, intDir, outDir, updateRte, quiet, trace}, "<ProjectFile>.cprj"}},
+    {"ninja",    {{toolchain, update, intDir, outDir, updateRte, quiet, trace}, "<ProjectFile>.cprj"}},
+    {"extract",  {{layer, outDir, trace},                                       "<ProjectFile>.cprj"}},
+    {"remove",   {{layer, trace},                                               "<ProjectFile>.cprj"}},
+    {"compose",  {{name, description, trace},                                   "<ProjectFile>.cprj <1.clayer>...<N.clayer>"}},
+    {"add",      {{trace},                                                      "<ProjectFile>.cprj <1.clayer>...<N.clayer>"}},
+    {"mkdir",    {{},                                                           "<path1>...<pathN>"}},
+    {"touch",    {{},                                                           "<filepath1>...<filepathN>"}},
+    {"rmdir",    {{except},                                                     "<path1>...<pathN>"}},
   };
 
   string cprjFilePath, intDirPath, outDirPath, projectName, projectDesc;
-  string toolchainPath, updateCPRJ, packRootPath, compilerRootPath, exceptPath;
+  string toolchainPath, updateCPRJ, packRootPath, compilerRootPath, exceptPath, tracePath;
   vector<string> posArgs;
   vector<string> layerIDs;
   bool updateRteFiles = false;
@@ -133,7 +139,7 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
         update, intDir, outDir, quiet,
         layer, name, description, packRoot,
         compilerRoot, except, help, version,
-        updateRte
+        updateRte, trace
       });
 
     options.parse_positional({"args"});
@@ -211,7 +217,11 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
     updateRteFiles = parseResult["update-rte"].as<bool>();
   }
 
-  bool mkdirCmd = false, rmdirCmd = false, touchCmd = false, packMode = false, cmakeMode = false;
+  if (parseResult.count("trace")) {
+    tracePath = parseResult["trace"].as<string>();
+  }
+
+  bool mkdirCmd = false, rmdirCmd = false, touchCmd = false, packMode = false, cmakeMode = false, ninjaMode = false;
   bool extractLayer = false, composeLayer = false, addLayer = false, removeLayer = false;
   string command = "UNKNOWN";
   list<string> params;
@@ -223,6 +233,7 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
     else if (arg.compare("touch")    == 0)      touchCmd = true;
     else if (arg.compare("packlist") == 0)      packMode = true;
     else if (arg.compare("cmake")    == 0)      cmakeMode = true;
+    else if (arg.compare("ninja")    == 0)      ninjaMode = true;
     else if (arg.compare("extract")  == 0)      extractLayer = true;
     else if (arg.compare("compose")  == 0)      composeLayer = true;
     else if (arg.compare("add")      == 0)      addLayer = true;
@@ -236,7 +247,7 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
   }
 
   int cnt = 0;
-  for (auto b : { mkdirCmd, rmdirCmd, touchCmd, packMode, cmakeMode, extractLayer, composeLayer, addLayer, removeLayer }) {
+  for (auto b : { mkdirCmd, rmdirCmd, touchCmd, packMode, cmakeMode, ninjaMode, extractLayer, composeLayer, addLayer, removeLayer }) {
     if (b) {
       cnt++;
     }
@@ -321,6 +332,9 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
     }
   }
 
+  TraceFile traceFile(tracePath, [](const string& fileName) { LogMsg("M210", PATH(fileName)); });
+  TraceSpan span("cbuildgen", "cbuildgen", command);
+
   vector<string> layers(params.begin(), params.end());
   // Run layer command
   int cmd = extractLayer ? L_EXTRACT : composeLayer ? L_COMPOSE : addLayer ? L_ADD : removeLayer ? L_REMOVE : 0;
@@ -348,7 +362,7 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
     }
   }
 
-  if ((cmakeMode || packMode) && (!CreateRte({ cprjFilePath, packRootPath, compilerRootPath, toolchainPath, updateCPRJ, intDirPath, envVars, packMode, updateRteFiles }))) {
+  if ((cmakeMode || ninjaMode || packMode) && (!CreateRte({ cprjFilePath, packRootPath, compilerRootPath, toolchainPath, updateCPRJ, intDirPath, envVars, packMode, updateRteFiles }))) {
     // CreateRte failed
     return 1;
   }
@@ -373,6 +387,19 @@ int CbuildGen::RunCbuildGen(int argc, char **argv, char** envp) {
     }
     instance.GenAuditFile();
   }
+
+  if (ninjaMode) {
+    // Create NinjaGenerator instance and collect data
+    NinjaGenerator instance;
+    if (!instance.Collect(cprjFilePath, model, outDirPath, intDirPath, compilerRootPath)) {
+      return 1;
+    }
+    if (!instance.GenBuildNinja()) {
+      return 1;
+    }
+    LogMsg("M652", VAL("NAME", instance.m_genfile));
+    instance.GenAuditFile();
+  }
   return 0;
 }
 
@@ -0,0 +1,500 @@
+/*
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+ // NinjaGenerator.cpp
+
+#include "NinjaGenerator.h"
+
+#include "CbuildUtils.h"
+#include "ErrLog.h"
+#include "RteFileWriter.h"
+#include "RteFsUtils.h"
+#include "RteUtils.h"
+#include "Tracer.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+string NinjaGenerator::EscapePath(const string& path) {
+  /*
+  EscapePath:
+  Escape '$', ' ' and ':' in paths used in ninja build statements
+  */
+  string result;
+  result.reserve(path.size());
+  for (const char c : path) {
+    if ((c == '$') || (c == ' ') || (c == ':')) {
+      result += '$';
+    }
+    result += c;
+  }
+  return result;
+}
+
+string NinjaGenerator::EscapeValue(const string& value) {
+  /*
+  EscapeValue:
+  Escape '$' in ninja variable values
+  */
+  string result;
+  result.reserve(value.size());
+  for (const char c : value) {
+    if (c == '$') {
+      result += '$';
+    }
+    result += c;
+  }
+  return result;
+}
+
+string NinjaGenerator::QuoteArg(const string& arg) {
+  /*
+  QuoteArg:
+  Enclose command line argument in quotes if it contains spaces or quotes
+  */
+  if (arg.find_first_of(" \"") == string::npos) {
+    return arg;
+  }
+  return "\"" + CbuildUtils::EscapeQuotes(arg) + "\"";
+}
+
+string NinjaGenerator::GetCpuFlags(void) const {
+  /*
+  GetCpuFlags:
+  Map target core, fpu, dsp and mve attributes to GCC options
+  (see GCC.<version>.cmake toolchain configuration file)
+  */
+  const bool spFpu = m_targetFpu == "SP_FPU";
+  const bool dpFpu = m_targetFpu == "DP_FPU";
+  const bool noFpu = m_targetFpu.empty() || (m_targetFpu == "NO_FPU");
+  const bool dsp = m_targetDsp == "DSP";
+  const string& cpu = m_targetCpu;
+  string mcpu = "-mcpu=" + cpu;
+  transform(mcpu.begin(), mcpu.end(), mcpu.begin(), [](unsigned char c) { return (char)tolower(c); });
+
+  if (cpu == "Cortex-M0")  return "-mcpu=cortex-m0";
+  if (cpu == "Cortex-M0+") return "-mcpu=cortex-m0plus";
+  if (cpu == "Cortex-M1")  return "-mcpu=cortex-m1";
+  if (cpu == "Cortex-M3")  return "-mcpu=cortex-m3";
+  if (cpu == "Cortex-M23") return "-mcpu=cortex-m23";
+  if (cpu == "Cortex-M4") {
+    return spFpu ? "-mcpu=cortex-m4 -mfpu=fpv4-sp-d16 -mfloat-abi=hard" : "-mcpu=cortex-m4";
+  }
+  if (cpu == "Cortex-M7") {
+    return dpFpu ? "-mcpu=cortex-m7 -mfpu=fpv5-d16 -mfloat-abi=hard" :
+           spFpu ? "-mcpu=cortex-m7 -mfpu=fpv5-sp-d16 -mfloat-abi=hard" : "-mcpu=cortex-m7";
+  }
+  if ((cpu == "Cortex-M33") || (cpu == "Cortex-M35P")) {
+    mcpu += dsp ? "" : "+nodsp";
+    return spFpu ? mcpu + " -mfpu=fpv5-sp-d16 -mfloat-abi=hard" : mcpu;
+  }
+  if ((cpu == "Cortex-M55") || (cpu == "Cortex-M85")) {
+    if (noFpu) {
+      return mcpu + (m_targetMve == "NO_MVE" ? "+nofp+nomve" : "+nofp");
+    }
+    return mcpu + (m_targetMve == "NO_MVE" ? "+nomve" : m_targetMve == "MVE" ? "+nomve.fp" : "") + " -mfloat-abi=hard";
+  }
+  if ((cpu == "Cortex-A5") || (cpu == "Cortex-A7") || (cpu == "Cortex-A9")) {
+    return dpFpu ? mcpu + "+nosimd -mfpu=auto -mfloat-abi=hard" : mcpu + "+nosimd+nofp";
+  }
+  return RteUtils::EMPTY_STRING;
+}
+
+string NinjaGenerator::GetOptionsFlags(const string& lang, const string& optimize,
+  const string& debug, const string& warnings, const string& language)
+{
+  /*
+  GetOptionsFlags:
+  Map optimize, debug, warnings and language options to GCC flags
+  (see GCC.<version>.cmake toolchain configuration file)
+  */
+  static const map<string, string> optimizeFlags = {
+    {"debug", "-Og"}, {"none", "-O0"}, {"balanced", "-O2"}, {"size", "-Os"}, {"speed", "-O3"}
+  };
+  static const map<string, string> debugFlags = {
+    {"on", "-g3"}, {"off", "-g0"}
+  };
+  static const map<string, string> warningsFlags = {
+    {"on", ""}, {"off", "-w"}, {"all", "-Wall"}
+  };
+  static const map<string, string> warningsAsLegFlags = {
+    {"on", "--warn"}, {"off", "--no-warn"}, {"all", ""}
+  };
+
+  list<string> flags;
+  const bool asLeg = lang == "AS_LEG";
+  if (!asLeg && optimizeFlags.find(optimize) != optimizeFlags.end()) {
+    flags.push_back(optimizeFlags.at(optimize));
+  }
+  if (!asLeg && debugFlags.find(debug) != debugFlags.end()) {
+    flags.push_back(debugFlags.at(debug));
+  }
+  const map<string, string>& warnings_map = asLeg ? warningsAsLegFlags : warningsFlags;
+  if (warnings_map.find(warnings) != warnings_map.end()) {
+    flags.push_back(warnings_map.at(warnings));
+  }
+  if (!language.empty()) {
+    // C++ standards apply only to C++ files and C standards only to C files
+    const bool cxxStandard = language.find("++") != string::npos;
+    if (((lang == "CC") && !cxxStandard) || ((lang == "CXX") && cxxStandard)) {
+      flags.push_back("-std=" + language);
+    }
+  }
+  flags.remove(RteUtils::EMPTY_STRING);
+  return GetString(flags);
+}
+
+string NinjaGenerator::GetDefinesFlags(const string& lang, const list<string>& defines) {
+  /*
+  GetDefinesFlags:
+  Map defines to assembler or compiler specific flags
+  */
+  list<string> flags;
+  for (const auto& define : defines) {
+    if (define.empty()) {
+      continue;
+    }
+    if ((lang == "AS_LEG") || (lang == "AS_GNU")) {
+      const size_t pos = define.find('=');
+      const string key = define.substr(0, pos);
+      const string value = (pos == string::npos) ? "1" : define.substr(pos + 1);
+      flags.push_back(lang == "AS_LEG" ? "--defsym " + QuoteArg(key + "=" + value) :
+        "-Wa,-defsym," + QuoteArg(key + "=" + value));
+    } else {
+      flags.push_back(QuoteArg("-D" + define));
+    }
+  }
+  return GetString(flags);
+}
+
+string NinjaGenerator::GetIncludesFlags(const list<string>& includes) {
+  list<string> flags;
+  for (const auto& include : includes) {
+    if (!include.empty()) {
+      flags.push_back(QuoteArg("-I" + include));
+    }
+  }
+  return GetString(flags);
+}
+
+bool NinjaGenerator::GenBuildNinja(void) {
+  TraceSpan span("NinjaGenerator::GenBuildNinja", "cbuildgen");
+  m_genfile = m_intdir + "build.ninja";
+
+  if (m_toolchain != "GCC") {
+    LogMsg("M617", VAL("NAME", m_toolchain));
+    return false;
+  }
+  const string cpuFlags = GetCpuFlags();
+  if (cpuFlags.empty()) {
+    LogMsg("M618", VAL("CPU", m_targetCpu));
+    return false;
+  }
+
+  // Toolchain executables (see GCC.<version>.cmake toolchain configuration file)
+  const string toolchainPrefix = m_toolchainRegisteredRoot.empty() ? RteUtils::EMPTY_STRING :
+    CbuildUtils::RemoveTrailingSlash(StrConv(m_toolchainRegisteredRoot)) + SS + "arm-none-eabi-";
+
+  // Output files
+  fs::path outputPath;
+  if (m_outputFiles.find("elf") != m_outputFiles.end()) {
+    outputPath = fs::path(StrNorm(m_outputFiles.at("elf")));
+  } else if (m_outputFiles.find("lib") != m_outputFiles.end()) {
+    outputPath = fs::path(StrNorm(m_outputFiles.at("lib")));
+  }
+  const bool lib_output = (m_outputType.compare("lib") == 0) ? true :
+    (m_outputFiles.find("lib") != m_outputFiles.end() ? true : false);
+  const bool hex_output = m_outputFiles.find("hex") != m_outputFiles.end();
+  const bool bin_output = m_outputFiles.find("bin") != m_outputFiles.end();
+  const bool cmse_output = m_outputFiles.find("cmse-lib") != m_outputFiles.end();
+  const string outFile = m_outdir + (outputPath.empty() ? m_targetName + (lib_output ? ".a" : ".elf") : outputPath.generic_string());
+
+  // Linker script pre-processing
+  const string linkerExt = fs::path(m_linkerScript).extension().generic_string();
+  const bool linker_pp = !m_linkerScript.empty() && !lib_output &&
+    ((linkerExt == SRCPPEXT) || !m_linkerRegionsFile.empty() || !m_linkerPreProcessorDefines.empty());
+  string linkerScript = m_linkerScript;
+  if (linker_pp) {
+    string absLinkerScript = fs::path(m_linkerScript).filename().generic_string();
+    RteFsUtils::NormalizePath(absLinkerScript, m_intdir);
+    linkerScript = (linkerExt == SRCPPEXT) ? fs::path(absLinkerScript).replace_extension("").generic_string() :
+      fs::path(absLinkerScript).concat(PPEXT).generic_string();
+  }
+
+  // Secure, byte order and branch protection flags
+  const bool secure = (m_targetSecure == "Secure") || (m_targetSecure == "Secure-only");
+  const string byteOrder = (m_byteOrder == "Little-endian") ? "-mlittle-endian" :
+    (m_byteOrder == "Big-endian") ? "-mbig-endian" : RteUtils::EMPTY_STRING;
+  const string branchProt = (m_targetBranchProt == "NO_BRANCHPROT") ? "-mbranch-protection=none" :
+    (m_targetBranchProt == "BTI") ? "-mbranch-protection=bti" :
+    (m_targetBranchProt == "BTI_SIGNRET") ? "-mbranch-protection=bti+pac-ret" : RteUtils::EMPTY_STRING;
+
+  // Create build.ninja stream
+  stringstream ninja;
+
+  ninja << "# CMSIS Build build.ninja generated on " << CbuildUtils::GetLocalTimestamp() << EOL << EOL;
+
+  ninja << "ninja_required_version = 1.10" << EOL << EOL;
+
+  ninja << "# Target options" << EOL << EOL;
+  ninja << "target = " << EscapeValue(m_targetName) << EOL;
+  ninja << "cpu = " << cpuFlags << EOL;
+  ninja << "as = " << EscapeValue(QuoteArg(toolchainPrefix + "as")) << EOL;
+  ninja << "cc = " << EscapeValue(QuoteArg(toolchainPrefix + "gcc")) << EOL;
+  ninja << "cxx = " << EscapeValue(QuoteArg(toolchainPrefix + "g++")) << EOL;
+  ninja << "ar = " << EscapeValue(QuoteArg(toolchainPrefix + "ar")) << EOL;
+  ninja << "objcopy = " << EscapeValue(QuoteArg(toolchainPrefix + "objcopy")) << EOL << EOL;
+
+  // Rules
+  ninja << "# Rules" << EOL << EOL;
+  ninja << "rule as_leg" << EOL;
+  ninja << "  command = $as $cpu $defines $includes $options $flags -o $out $in" << EOL;
+  ninja << "  description = Assembling $in" << EOL << EOL;
+  ninja << "rule asm" << EOL;
+  ninja << "  command = $cc $cpu $defines $includes $options $flags -MD -MF $out.d -c $in -o $out" << EOL;
+  ninja << "  depfile = $out.d" << EOL;
+  ninja << "  deps = gcc" << EOL;
+  ninja << "  description = Assembling $in" << EOL << EOL;
+  ninja << "rule cc" << EOL;
+  ninja << "  command = $cc $cpu $defines $includes $options $flags -MD -MF $out.d -c $in -o $out" << EOL;
+  ninja << "  depfile = $out.d" << EOL;
+  ninja << "  deps = gcc" << EOL;
+  ninja << "  description = Compiling $in" << EOL << EOL;
+  ninja << "rule cxx" << EOL;
+  ninja << "  command = $cxx $cpu $defines $includes $options $flags -MD -MF $out.d -c $in -o $out" << EOL;
+  ninja << "  depfile = $out.d" << EOL;
+  ninja << "  deps = gcc" << EOL;
+  ninja << "  description = Compiling $in" << EOL << EOL;
+  if (lib_output) {
+    ninja << "rule archive" << EOL;
+#ifdef _WIN32
+    ninja << "  command = cmd /c if exist $out del /q $out && $ar rcs $out $in" << EOL;
+#else
+    ninja << "  command = rm -f $out && $ar rcs $out $in" << EOL;
+#endif
+    ninja << "  description = Archiving $out" << EOL << EOL;
+  } else {
+    ninja << "rule link" << EOL;
+    ninja << "  command = $linker $cpu $ldflags $in $libs -o $out" << EOL;
+    ninja << "  description = Linking $out" << EOL << EOL;
+  }
+  if (linker_pp) {
+    ninja << "rule ld_pp" << EOL;
+    ninja << "  command = $cc -E -P $cpu -xc $flags $in -o $out" << EOL;
+    ninja << "  description = Pre-processing $in" << EOL << EOL;
+  }
+  if (hex_output || bin_output) {
+    ninja << "rule objcopy" << EOL;
+    ninja << "  command = $objcopy -O $format $in $out" << EOL;
+    ninja << "  description = Converting $out" << EOL << EOL;
+  }
+
+  // Files lists
+  vector<NinjaFilesList> filesLists = {
+    {"ASM",    "asm",    &m_asFilesList},
+    {"AS_LEG", "as_leg", &m_asLegacyFilesList},
+    {"AS_ARM", "asm",    &m_asArmclangFilesList},
+    {"AS_GNU", "asm",    &m_asGnuFilesList},
+    {"CC",     "cc",     &m_ccFilesList},
+    {"CXX",    "cxx",    &m_cxxFilesList},
+  };
+
+  const list<string> globalDefines(m_definesList.begin(), m_definesList.end());
+  const list<string> globalIncludes(m_incPathsList.begin(), m_incPathsList.end());
+
+  // Build statements for objects
+  ninja << "# Objects" << EOL << EOL;
+  list<string> objects;
+  map<string, int> objectNames;
+  for (const auto& filesList : filesLists) {
+    const string& lang = filesList.lang;
+    for (const auto& [src, file] : *filesList.files) {
+      const auto group = m_groupsList.find(fs::path(file.group).generic_string());
+      const TranslationControls* controls = (group != m_groupsList.end()) ? &group->second : nullptr;
+
+      // Unique object name: <filename>.o, <filename>.1.o, ...
+      const string filename = fs::path(src).filename().generic_string();
+      const int index = objectNames[filename]++;
+      const string object = m_intdir + "obj/" + filename + (index ? "." + to_string(index) : "") + ".o";
+      objects.push_back(object);
+
+      // Defines: file, group or global
+      list<string> defines;
+      if (!file.defines.empty()) {
+        RteUtils::SplitString(defines, file.defines, ' ');
+      } else if (controls && !controls->defines.empty()) {
+        RteUtils::SplitString(defines, controls->defines, ' ');
+      } else {
+        defines = globalDefines;
+      }
+
+      // Includes: global and file or group
+      list<string> includes = globalIncludes;
+      if (!file.includes.empty()) {
+        RteUtils::SplitString(includes, file.includes, ' ');
+      } else if (controls && !controls->includes.empty()) {
+        RteUtils::SplitString(includes, controls->includes, ' ');
+      }
+
+      // Options: file, group or target
+      auto option = [&](const string& fileOpt, const string& groupOpt, const string& targetOpt) -> const string& {
+        return !fileOpt.empty() ? fileOpt : !groupOpt.empty() ? groupOpt : targetOpt;
+      };
+      const string& optimize = option(file.optimize, controls ? controls->optimize : RteUtils::EMPTY_STRING, m_optimize);
+      const string& debug = option(file.debug, controls ? controls->debug : RteUtils::EMPTY_STRING, m_debug);
+      const string& warnings = option(file.warnings, controls ? controls->warnings : RteUtils::EMPTY_STRING, m_warnings);
+      const string& language = (lang == "CC") ? option(file.languageC, controls ? controls->languageC : RteUtils::EMPTY_STRING, m_languageC) :
+        (lang == "CXX") ? option(file.languageCpp, controls ? controls->languageCpp : RteUtils::EMPTY_STRING, m_languageCpp) : RteUtils::EMPTY_STRING;
+      string options = GetOptionsFlags(lang, optimize, debug, warnings, language);
+
+      // Misc flags: file, group or global
+      list<string> flags;
+      const string& globalMsc = (lang == "CC") ? m_ccMscGlobal : (lang == "CXX") ? m_cxxMscGlobal : m_asMscGlobal;
+      const string& groupMsc = !controls ? RteUtils::EMPTY_STRING : (lang == "CC") ? controls->ccMsc : (lang == "CXX") ? controls->cxxMsc : controls->asMsc;
+      flags.push_back(option(file.flags, groupMsc, globalMsc));
+      if ((lang == "ASM") || (lang == "CC") || (lang == "CXX")) {
+        flags.push_front(byteOrder);
+      }
+      if ((lang == "CC") || (lang == "CXX")) {
+        if (secure) {
+          flags.push_back("-mcmse");
+        }
+        flags.push_back(branchProt);
+        for (const auto& preinc : m_preincGlobal) {
+          flags.push_back("-include " + QuoteArg(preinc));
+        }
+        if (controls) {
+          for (const auto& preinc : controls->preinc) {
+            flags.push_back("-include " + QuoteArg(preinc));
+          }
+        }
+      }
+      flags.remove(RteUtils::EMPTY_STRING);
+
+      ninja << "build " << EscapePath(object) << ": " << filesList.rule << " " << EscapePath(src) << EOL;
+      if (!defines.empty()) ninja << "  defines = " << EscapeValue(GetDefinesFlags(lang, defines)) << EOL;
+      if (!includes.empty()) ninja << "  includes = " << EscapeValue(GetIncludesFlags(includes)) << EOL;
+      if (!options.empty()) ninja << "  options = " << EscapeValue(options) << EOL;
+      if (!flags.empty()) ninja << "  flags = " << EscapeValue(GetString(flags)) << EOL;
+    }
+  }
+  ninja << EOL;
+
+  // Linker script pre-processing
+  if (linker_pp) {
+    ninja << "# Linker script pre-processing" << EOL << EOL;
+    list<string> flags;
+    if (secure) {
+      flags.push_back("-mcmse");
+    }
+    const list<string> ppDefines(m_linkerPreProcessorDefines.begin(), m_linkerPreProcessorDefines.end());
+    flags.push_back(GetDefinesFlags("CC", ppDefines));
+    if (!m_linkerRegionsFile.empty()) {
+      flags.push_back("-include " + QuoteArg(m_linkerRegionsFile));
+    }
+    flags.remove(RteUtils::EMPTY_STRING);
+    ninja << "build " << EscapePath(linkerScript) << ": ld_pp " << EscapePath(m_linkerScript);
+    if (!m_linkerRegionsFile.empty()) {
+      ninja << " | " << EscapePath(m_linkerRegionsFile);
+    }
+    ninja << EOL;
+    if (!flags.empty()) ninja << "  flags = " << EscapeValue(GetString(flags)) << EOL;
+    ninja << EOL;
+  }
+
+  // Target
+  ninja << "# Target" << EOL << EOL;
+  ninja << "build " << EscapePath(outFile);
+  if (cmse_output && (m_targetSecure == "Secure")) {
+    ninja << " | " << EscapePath(m_outdir + StrNorm(m_outputFiles.at("cmse-lib")));
+  }
+  ninja << ": " << (lib_output ? "archive" : "link");
+  for (const auto& object : objects) {
+    ninja << " $" << EOL << "    " << EscapePath(object);
+  }
+  if (!lib_output) {
+    // Implicit dependencies
+    list<string> implicit(m_libFilesList.begin(), m_libFilesList.end());
+    if (!m_linkerScript.empty()) {
+      implicit.push_back(linkerScript);
+    }
+    if (!implicit.empty()) {
+      ninja << " |";
+      for (const auto& dependency : implicit) {
+        ninja << " $" << EOL << "    " << EscapePath(dependency);
+      }
+    }
+    ninja << EOL;
+    ninja << "  linker = " << (m_cxxFilesList.empty() ? "$cc" : "$cxx") << EOL;
+
+    // Linker flags
+    list<string> ldFlags;
+    if (!m_linkerScript.empty()) {
+      ldFlags.push_back("-T " + QuoteArg(linkerScript));
+    }
+    if (m_targetSecure == "Secure") {
+      ldFlags.push_back("-Wl,--cmse-implib");
+      if (cmse_output) {
+        ldFlags.push_back(QuoteArg("-Wl,--out-implib=" + m_outdir + StrNorm(m_outputFiles.at("cmse-lib"))));
+      }
+    }
+    ldFlags.push_back(m_linkerMscGlobal);
+    ldFlags.push_back(m_cxxFilesList.empty() ? m_linkerCMscGlobal : m_linkerCxxMscGlobal);
+    ldFlags.push_back(GetOptionsFlags("LD", m_optimize, m_debug, m_warnings, RteUtils::EMPTY_STRING));
+    ldFlags.remove(RteUtils::EMPTY_STRING);
+    if (!ldFlags.empty()) ninja << "  ldflags = " << EscapeValue(GetString(ldFlags)) << EOL;
+
+    // Libraries
+    list<string> libs;
+    if (!m_libFilesList.empty()) {
+      libs.push_back("-Wl,--start-group");
+      for (const auto& lib : m_libFilesList) {
+        libs.push_back(QuoteArg(lib));
+      }
+      libs.push_back("-Wl,--end-group");
+    }
+    libs.push_back(m_linkerLibsGlobal);
+    libs.remove(RteUtils::EMPTY_STRING);
+    if (!libs.empty()) ninja << "  libs = " << EscapeValue(GetString(libs)) << EOL;
+  } else {
+    ninja << EOL;
+  }
+  ninja << EOL;
+
+  // Bin and Hex Conversion
+  list<string> defaults = { outFile };
+  if (hex_output && !lib_output) {
+    const string hexFile = m_outdir + StrNorm(m_outputFiles.at("hex"));
+    ninja << "build " << EscapePath(hexFile) << ": objcopy " << EscapePath(outFile) << EOL;
+    ninja << "  format = ihex" << EOL << EOL;
+    defaults.push_back(hexFile);
+  }
+  if (bin_output && !lib_output) {
+    const string binFile = m_outdir + StrNorm(m_outputFiles.at("bin"));
+    ninja << "build " << EscapePath(binFile) << ": objcopy " << EscapePath(outFile) << EOL;
+    ninja << "  format = binary" << EOL << EOL;
+    defaults.push_back(binFile);
+  }
+
+  ninja << "default";
+  for (const auto& target : defaults) {
+    ninja << " " << EscapePath(target);
+  }
+  ninja << EOL;
+
+  // Compare build.ninja contents
+  if (!CompareFile(m_genfile, ninja)) {
+    // Create build.ninja
+    if (!RteFileWriter::WriteFile(m_genfile, ninja.str(), true)) {
+      LogMsg("M210", PATH(m_genfile));
+      return false;
+    }
+  }
+  return true;
+}
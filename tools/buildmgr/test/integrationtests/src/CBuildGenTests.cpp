@@ -170,6 +170,29 @@ TEST_F(CBuildGenTests, GenCMakeTest_4) {
   CheckCMakeLists        (param);
 }
 
+// Validate generation of build.ninja file required to build the project
+TEST_F(CBuildGenTests, GenNinjaTest) {
+  TestParam param = {
+    "GCC/TranslationControl/Project1", "Project",
+    "--update-rte", "ninja", true
+  };
+  error_code ec;
+
+  RunCBuildGen           (param);
+  EXPECT_TRUE(fs::exists(testout_folder + "/" + param.name + "/IntDir/build.ninja", ec));
+  EXPECT_FALSE(fs::exists(testout_folder + "/" + param.name + "/IntDir/CMakeLists.txt", ec));
+}
+
+// Validate ninja command with unsupported toolchain
+TEST_F(CBuildGenTests, GenNinjaTest_UnsupportedToolchain) {
+  TestParam param = {
+    "AC6/Build_AC6", "Simulation",
+    "--update-rte", "ninja", false
+  };
+
+  RunCBuildGen           (param);
+}
+
 // Validate generation of output files under current output directory
 TEST_F(CBuildGenTests, Gen_Output_In_SameDir) {
   vector<string> outDirs{ "OutDir", "./Build" };
@@ -297,6 +297,33 @@ TEST_F(CbuildLayerTests, CopyMatchedChildren) {
     ASSERT_EQ(true, (nullptr == fileChild) ? false : true);
     EXPECT_EQ("device", fileChild->GetAttribute("layer"));
   }
+
+  {
+    XMLTreeElement destDevice, destApp, destBoard, src;
+    src.SetTag("files");
+    auto common = src.CreateElement("group");
+    common->AddAttribute("name", "common");
+    common->CreateElement("file")->AddAttribute("layer", "device");
+    common->CreateElement("file")->AddAttribute("layer", "app");
+    auto app = src.CreateElement("group");
+    app->AddAttribute("name", "app");
+    app->AddAttribute("layer", "app");
+    app->CreateElement("file");
+
+    CopyMatchedChildren(&src, { {"device", &destDevice}, {"app", &destApp}, {"board", &destBoard} });
+    EXPECT_TRUE(destBoard.GetChildren().empty());
+    ASSERT_EQ(destDevice.GetChildren().size(), 1);
+    auto groups = destDevice.GetChildren().front()->GetChildren();
+    ASSERT_EQ(groups.size(), 1);
+    ASSERT_EQ(groups.front()->GetChildren().size(), 1);
+    EXPECT_EQ("device", groups.front()->GetChildren().front()->GetAttribute("layer"));
+    ASSERT_EQ(destApp.GetChildren().size(), 1);
+    groups = destApp.GetChildren().front()->GetChildren();
+    ASSERT_EQ(groups.size(), 2);
+    EXPECT_EQ("common", groups.front()->GetAttribute("name"));
+    EXPECT_EQ("app", groups.back()->GetAttribute("name"));
+    ASSERT_EQ(groups.back()->GetChildren().size(), 1);
+  }
 }
 
 TEST_F(CbuildLayerTests, RemoveMatchedChildren) {
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020-2023 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "CBuildUnitTestEnv.h"
+#include "NinjaGenerator.h"
+
+using namespace std;
+
+class NinjaGeneratorTests :
+  public NinjaGenerator, public ::testing::Test {
+public:
+  NinjaGeneratorTests() {
+    Init();
+  }
+  virtual ~NinjaGeneratorTests() {}
+protected:
+  string ReadGenFile();
+private:
+  void Init();
+};
+
+void NinjaGeneratorTests::Init() {
+  m_outdir = testout_folder + "/Ninja/OutDir/";
+  m_intdir = testout_folder + "/Ninja/IntDir/";
+  m_projectName = "Project";
+  m_targetName = "Project";
+  m_toolchain = "GCC";
+  m_toolchainRegisteredRoot = "/opt/gcc arm/bin";
+  m_targetCpu = "Cortex-M4";
+  m_targetFpu = "SP_FPU";
+  m_byteOrder = "Little-endian";
+  m_optimize = "size";
+  m_outputFiles = { {"elf", "Project.elf"}, {"hex", "Project.hex"} };
+  m_linkerScript = "/project/gcc_arm.ld";
+  m_definesList = { "GLOBAL_DEF" };
+  m_incPathsList = { "/project/inc" };
+
+  m_ccFilesList["/project/src/main.c"].group = "Source";
+  m_ccFilesList["/project/src/main.c"].optimize = "none";
+  m_ccFilesList["/project/lib/main.c"].group = "Lib";
+  m_asFilesList["/project/src/startup.S"].group = "Source";
+
+  m_groupsList["Lib"].defines = "LIB_DEF=1";
+  m_groupsList["Lib"].includes = "/project/lib/inc";
+  m_groupsList["Lib"].ccMsc = "-fno-common";
+
+  RteFsUtils::CreateDirectories(m_intdir);
+}
+
+string NinjaGeneratorTests::ReadGenFile() {
+  string content;
+  EXPECT_TRUE(RteFsUtils::ReadFile(m_genfile, content));
+  return content;
+}
+
+TEST_F(NinjaGeneratorTests, GenBuildNinja) {
+  ASSERT_TRUE(GenBuildNinja());
+  EXPECT_EQ(m_intdir + "build.ninja", m_genfile);
+
+  const string content = ReadGenFile();
+  EXPECT_NE(string::npos, content.find("cpu = -mcpu=cortex-m4 -mfpu=fpv4-sp-d16 -mfloat-abi=hard"));
+  EXPECT_NE(string::npos, content.find("cc = \"/opt/gcc arm/bin/arm-none-eabi-gcc\""));
+
+  // objects with same file name get unique names
+  EXPECT_NE(string::npos, content.find("IntDir/obj/main.c.o: cc /project/lib/main.c"));
+  EXPECT_NE(string::npos, content.find("IntDir/obj/main.c.1.o: cc /project/src/main.c"));
+  EXPECT_NE(string::npos, content.find("IntDir/obj/startup.S.o: asm /project/src/startup.S"));
+
+  // group defines, includes and flags; target options
+  EXPECT_NE(string::npos, content.find("  defines = -DLIB_DEF=1\n  includes = -I/project/inc -I/project/lib/inc\n"
+    "  options = -Os\n  flags = -mlittle-endian -fno-common\n"));
+  // global defines; file options
+  EXPECT_NE(string::npos, content.find("  defines = -DGLOBAL_DEF\n  includes = -I/project/inc\n"
+    "  options = -O0\n  flags = -mlittle-endian\n"));
+
+  // linker and hex conversion
+  EXPECT_NE(string::npos, content.find("  linker = $cc\n  ldflags = -T /project/gcc_arm.ld -Os\n"));
+  EXPECT_NE(string::npos, content.find("OutDir/Project.hex: objcopy "));
+  EXPECT_NE(string::npos, content.find("  format = ihex\n"));
+}
+
+TEST_F(NinjaGeneratorTests, GenBuildNinja_Library) {
+  m_outputType = "lib";
+  m_outputFiles = { {"lib", "libProject.a"} };
+
+  ASSERT_TRUE(GenBuildNinja());
+  const string content = ReadGenFile();
+  EXPECT_NE(string::npos, content.find("rule archive"));
+  EXPECT_EQ(string::npos, content.find("rule link"));
+  EXPECT_NE(string::npos, content.find("OutDir/libProject.a: archive $\n"));
+}
+
+TEST_F(NinjaGeneratorTests, GenBuildNinja_UnsupportedToolchain) {
+  m_toolchain = "AC6";
+  EXPECT_FALSE(GenBuildNinja());
+
+  m_toolchain = "GCC";
+  m_targetCpu = "Unknown";
+  EXPECT_FALSE(GenBuildNinja());
+}
@@ -15,6 +15,7 @@
 
 #include <string>
 #include <set>
+#include <vector>
 
 
 class PackChk {
@@ -24,6 +25,15 @@ public:
 
   int Check(int argc, const char* argv[], const char* envp[]);
 
+  /**
+   * @brief check several packages reading each PDSC file only once. Every package is checked
+   *        as if the other ones were passed with option -i and gets its own report
+   * @param pdscFiles PDSC files to check, reported with their canonical path
+   * @param refFiles additional reference PDSC files
+   * @return 0: ok, 1: error
+  */
+  int CheckPackages(const std::vector<std::string>& pdscFiles, const std::set<std::string>& refFiles);
+
   const RteGlobalModel& GetModel() { return m_rteModel; }
 
 protected:
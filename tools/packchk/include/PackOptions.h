@@ -31,6 +31,7 @@ public:
   bool SetFileUnderTest(const std::string& filename);
   bool AddRefPackFile(const std::string& includeFile);
   bool SetPackNamePath(const std::string& packNamePath);
+  bool SetTraceFile(const std::string& traceFile);
   bool SetUrlRef(const std::string& urlRef);
   bool SetIgnoreOtherPdscFiles(bool bIgnore);
   bool GetIgnoreOtherPdscFiles();
@@ -48,6 +49,7 @@ public:
   const std::string GetProgramName();
   const std::string& GetUrlRef();
   const std::string& GetPackTextfileName();
+  const std::string& GetTraceFile();
   const std::string& GetPdscFullpath();
   const std::string& GetLogPath();
   const std::string& GetXsdPath();
@@ -63,6 +65,7 @@ private:
 
   std::string m_urlRef;    // package URL reference, check the URL of the PDSC against this value. if not std::set it is compared against the Keil Pack Server URL
   std::string m_packNamePath;
+  std::string m_traceFile;
   std::string m_packToCheck;
   std::string m_logPath;
   std::string m_xsdPath;   // PACK.xsd file path, use to validate the input PDSC file
@@ -35,6 +35,7 @@ protected:
   bool AddDiagSuppress(const std::string& suppress);
   bool AddRefPackFile(const std::string& includeFile);
   bool SetPackNamePath(const std::string& packNamePath);
+  bool SetTraceFile(const std::string& traceFile);
   bool SetCheckSvd(bool bCheck);
   bool SetUrlRef(const std::string& urlRef);
   bool SetVerbose(bool bVerbose);
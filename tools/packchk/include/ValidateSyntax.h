@@ -11,6 +11,9 @@
 #include "CheckFiles.h"
 #include "PackChk.h"
 
+#include <unordered_map>
+#include <unordered_set>
+
 #define PKG_FEXT               ".pack"
 #define COMMON_PROCESSORS_STR  "__COMMON__PROCESSORS__PROPMAP__"
 
@@ -75,6 +78,7 @@ private:
   bool CheckForBoard(RteExample* example);
   bool CheckAddBoard(RteBoard* board);
   bool BoardFindExamples(RteBoard* board);
+  void InitBoardIndex();
   void AddToId(std::string& id, const std::string type, const std::string text);
   bool CheckDevicesMultiple(RteDeviceItem* deviceItem, const std::map<std::string, RteDeviceItem*>& newDevicesList);
   bool CheckAddDevice(RteDeviceItem* deviceItem, std::map<std::string, RteDeviceItem*>& devicesList, const std::string& devName);
@@ -89,6 +93,8 @@ private:
   std::map<std::string, std::list<RteDeviceItem*> > m_allDevices;
   std::string m_pdscFullpath;
   std::map<std::string, RteBoard*> boardsFound;
+  std::unordered_map<std::string, std::unordered_set<std::string> > m_boardVendors;         // board name -> vendors of boards in model
+  std::unordered_map<std::string, std::unordered_set<std::string> > m_exampleBoardVendors;  // board name -> vendors of boards referenced by examples
 
   FEATURE_TABLE m_featureTableDevice;
   FEATURE_TABLE m_featureTableBoard;
@@ -14,6 +14,9 @@
 #include "ErrLog.h"
 #include "ErrOutputterSaveToStdoutOrFile.h"
 #include "ParseOptions.h"
+#include "Tracer.h"
+
+#include <algorithm>
 
 using namespace std;
 
@@ -115,24 +118,33 @@ bool PackChk::CheckPackage()
   LogMsg("M023", VAL("CHECK", "1: Read PDSC files"));
 
   // Read all PDSC files
-  if(!createModel.ReadAllPdsc()) {
-    bOk = false;
+  {
+    TraceSpan span("CreateModel::ReadAllPdsc", "packchk");
+    if(!createModel.ReadAllPdsc()) {
+      bOk = false;
+    }
   }
 
   // Validate Model
   LogMsg("M015");
   LogMsg("M023", VAL("CHECK", "2: Static Data & Dependencies check"));
   ValidateSyntax validateSyntax(m_rteModel, m_packOptions);
-  if(!validateSyntax.Check()) {
-    bOk = false;
+  {
+    TraceSpan span("ValidateSyntax::Check", "packchk");
+    if(!validateSyntax.Check()) {
+      bOk = false;
+    }
   }
 
   // Validate dependencies
   LogMsg("M015");
   LogMsg("M023", VAL("CHECK", "3: RTE Model based Data & Dependencies check"));
   ValidateSemantic validateSemantic(m_rteModel, m_packOptions);
-  if(!validateSemantic.Check()) {
-    bOk = false;
+  {
+    TraceSpan span("ValidateSemantic::Check", "packchk");
+    if(!validateSemantic.Check()) {
+      bOk = false;
+    }
   }
 
   // Create File with Packet Name
@@ -198,7 +210,9 @@ int PackChk::Check(int argc, const char* argv[], const char* envp[])
       return 1;
   }
 
+  TraceFile traceFile(m_packOptions.GetTraceFile(), [](const string& fileName) { LogMsg("M211", PATH(fileName)); });
   bool bOk = CheckPackage();
+  traceFile.Stop();
 
   if(ErrLog::Get()->GetErrCnt() || !bOk) {
     return 1;
@@ -213,3 +227,102 @@ int PackChk::Check(int argc, const char* argv[], const char* envp[])
 
   return 0;
 }
+
+/**
+ * @brief check several packages sharing one model. Messages of the read phase are
+ *        recorded once and repeated in the report of every package
+ * @param pdscFiles PDSC files to check
+ * @param refFiles additional reference PDSC files
+ * @return 0: ok, 1: error
+*/
+int PackChk::CheckPackages(const vector<string>& pdscFiles, const set<string>& refFiles)
+{
+  // packchk started in the PDSC directory with the relative file name reports the
+  // resolved working directory, references given with -i are only made absolute
+  vector<string> files;
+  for(const auto& pdscFile : pdscFiles) {
+    files.push_back(RteFsUtils::MakePathCanonical(RteFsUtils::AbsolutePath(pdscFile).generic_string()));
+  }
+  for(const auto& refFile : refFiles) {
+    const string& file = RteFsUtils::AbsolutePath(refFile).generic_string();
+    if(find(files.begin(), files.end(), file) == files.end()) {
+      files.push_back(file);
+    }
+  }
+
+  // Read all PDSC files into one model
+  ErrLogRecorder readLog;
+  readLog.Activate();
+  CreateModel createModel(m_rteModel);
+  bool bModelOk = m_packOptions.SetXsdFile() && createModel.SetPackXsd(m_packOptions.GetXsdPath());
+  for(const auto& file : files) {
+    if(bModelOk && !createModel.AddPdsc(file, true)) {
+      bModelOk = false;
+    }
+  }
+  bool bReadOk = bModelOk;
+  if(bModelOk) {
+    LogMsg("M015");
+    LogMsg("M023", VAL("CHECK", "1: Read PDSC files"));
+    TraceSpan span("CreateModel::ReadAllPdsc", "packchk");
+    bReadOk = createModel.ReadAllPdsc();
+  }
+  readLog.Deactivate();
+
+  // Validate each package with the other ones as reference
+  int result = 0;
+  for(size_t i = 0; i < pdscFiles.size(); i++) {
+    const string& pdscFile = files[i];
+    ErrLogContext errLog(new ErrOutputterSaveToStdoutOrFile());
+    errLog.Activate();
+
+    CPackOptions packOptions;
+    LogMsg("M001", TXT(packOptions.GetHeader()));
+    bool bOk = packOptions.SetFileUnderTest(pdscFile);
+    for(const auto& file : files) {
+      if(file != pdscFile) {
+        packOptions.AddRefPdscFile(file);
+      }
+    }
+
+    LogMsg("M061");
+    if(bOk && !createModel.CheckForOtherPdscFiles(pdscFile)) {
+      LogMsg("M203", PATH(pdscFile));
+      bOk = false;
+    }
+    readLog.Replay(&errLog, nullptr, true);
+
+    // like CheckPackage(), a failed read does not skip the checks
+    if(bOk && bModelOk) {
+      LogMsg("M015");
+      LogMsg("M023", VAL("CHECK", "2: Static Data & Dependencies check"));
+      ValidateSyntax validateSyntax(m_rteModel, packOptions);
+      {
+        TraceSpan span("ValidateSyntax::Check", "packchk");
+        if(!validateSyntax.Check()) {
+          bOk = false;
+        }
+      }
+
+      LogMsg("M015");
+      LogMsg("M023", VAL("CHECK", "3: RTE Model based Data & Dependencies check"));
+      ValidateSemantic validateSemantic(m_rteModel, packOptions);
+      {
+        TraceSpan span("ValidateSemantic::Check", "packchk");
+        if(!validateSemantic.Check()) {
+          bOk = false;
+        }
+      }
+    }
+
+    LogMsg("M016");
+    LogMsg("M022", ERR(errLog.GetErrCnt()), WARN(errLog.GetWarnCnt()));
+
+    if(!bOk || !bReadOk || errLog.GetErrCnt()) {
+      result = 1;
+    }
+    errLog.Deactivate();
+  }
+
+  return result;
+}
@@ -94,7 +94,7 @@ const MsgTable PackChk::msgTable = {
   { "M208", { MsgLevel::LEVEL_ERROR,    CRLF_BE, "" } },
   { "M209", { MsgLevel::LEVEL_TEXT,     CRLF_B, "" } },
   { "M210", { MsgLevel::LEVEL_ERROR,    CRLF_B, "Only one input file to be checked is allowed." } },
-  { "M211", { MsgLevel::LEVEL_ERROR,    CRLF_BE, "" } },
+  { "M211", { MsgLevel::LEVEL_ERROR,    CRLF_BE, "Cannot create trace file '%PATH%'" } },
   { "M212", { MsgLevel::LEVEL_ERROR,    CRLF_BE, "" } },
   { "M213", { MsgLevel::LEVEL_WARNING,  CRLF_BE, "Found blank char '%NUM%' in Packname output filename, deleted" } },
   { "M214", { MsgLevel::LEVEL_ERROR,    CRLF_BE, "Invalid argument: %OPT%" } },
@@ -145,6 +145,31 @@ bool CPackOptions::SetPackNamePath(const std::string& path)
   return true;
 }
 
+/**
+ * @brief set file name for trace events of the check steps
+ * @param path file name
+ * @return passed / failed
+*/
+bool CPackOptions::SetTraceFile(const std::string& path)
+{
+  if(path.empty()) {
+    return false;
+  }
+
+  m_traceFile = path;
+
+  return true;
+}
+
+/**
+ * @brief returns file name for trace events
+ * @return string name, empty if tracing is disabled
+*/
+const string& CPackOptions::GetTraceFile()
+{
+  return m_traceFile;
+}
+
 /**
  * @brief returns a list of PDSC reference files
  * @return list of string
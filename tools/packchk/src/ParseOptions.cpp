@@ -153,6 +153,16 @@ bool ParseOptions::SetPackNamePath(const string& packNamePath)
   return true;
 }
 
+/**
+ * @brief option "trace"
+ * @param traceFile string filename
+ * @return passed / failed
+ */
+bool ParseOptions::SetTraceFile(const string& traceFile)
+{
+  return m_packOptions.SetTraceFile(traceFile);
+}
+
 /**
  * @brief option "u"
  * @param urlRef string url
@@ -222,6 +232,7 @@ ParseOptions::Result ParseOptions::Parse(int argc, const char* argv[])
         {"break", "Debug halt after start", cxxopts::value<bool>()->default_value("false")},
         {"ignore-other-pdsc", "Ignores other PDSC files in working folder", cxxopts::value<bool>()->default_value("false")},
         {"pedantic", "Return with error value on warning", cxxopts::value<bool>()->default_value("false")},
+        {"trace", "Write Chrome trace event JSON of check steps to file", cxxopts::value<string>()},
       });
 
     options.parse_positional({"input"});
@@ -309,6 +320,11 @@ ParseOptions::Result ParseOptions::Parse(int argc, const char* argv[])
         bOk = false;
       }
     }
+    if(parseResult.count("trace")) {
+      if(!SetTraceFile(parseResult["trace"].as<string>())) {
+        bOk = false;
+      }
+    }
     if(parseResult.count("ignore-other-pdsc")) {
       if(!SetIgnoreOtherPdscFiles(parseResult["ignore-other-pdsc"].as<bool>())) {
         bOk = false;
@@ -131,6 +131,7 @@ bool RteModelReader::ReadAll()
 
   // ----------------------  Construct Model  ----------------------
   t1 = CrossPlatformUtils::ClockInMsec();
+  m_rteModel.SetPrecomputeEffectiveProperties(true); // all devices are checked
   m_rteModel.InsertPacks(m_rteItemBuilder.GetPacks());
   t2 = CrossPlatformUtils::ClockInMsec() - t1;
   LogMsg("M076", TIME(t2));
@@ -11,6 +11,7 @@
 #include "RteProject.h"
 #include "RteFsUtils.h"
 #include "ErrLog.h"
+#include "Tracer.h"
 
 using namespace std;
 
@@ -91,6 +92,7 @@ bool ValidateSemantic::EndTest()
  */
 bool ValidateSemantic::GatherCompilers(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSemantic::GatherCompilers", "packchk");
   if(!pKg) {
     return false;
   }
@@ -209,7 +211,7 @@ bool ValidateSemantic::CheckMemory(RteDeviceItem* device)
 
     LogMsg("M071", NAME(devName), proc->GetLineNumber());
 
-    const list<RteDeviceProperty*>& propGroup = device->GetEffectiveProperties("memory", pName);
+    const vector<RteDeviceProperty*>& propGroup = device->GetEffectiveProperties("memory", pName);
     if(propGroup.empty()) {
       LogMsg("M312", TAG("memory"), NAME(device->GetName()), device->GetLineNumber());
       return false;
@@ -709,6 +711,7 @@ bool ValidateSemantic::HasExternalGenerator(RteComponentAggregate* aggregate)
  */
 bool ValidateSemantic::TestMcuDependencies(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSemantic::TestMcuDependencies", "packchk");
   RteGlobalModel& model = GetModel();
   RteProject* rteProject = model.AddProject(1);
   if(!rteProject || !pKg) {
@@ -735,6 +738,7 @@ bool ValidateSemantic::TestMcuDependencies(RtePackage* pKg)
  */
 bool ValidateSemantic::TestComponentDependencies()
 {
+  TraceSpan span("ValidateSemantic::TestComponentDependencies", "packchk");
   list<RteDevice*> devices;
   string dname, dvendor;
   string pKgFileName;
@@ -14,6 +14,7 @@
 #include "RteGenerator.h"
 #include "RteUtils.h"
 #include "RteFsUtils.h"
+#include "Tracer.h"
 
 #include <regex>
 
@@ -75,6 +76,8 @@ const string& ValidateSyntax::GetRteTypeString(const RteDeviceItem::TYPE type)
 */
 bool ValidateSyntax::Check()
 {
+  InitBoardIndex();
+
   for(auto pack : GetModel().GetChildren()) {
     RtePackage* pKg = dynamic_cast<RtePackage*>(pack);
     if(!pKg) {
@@ -139,6 +142,7 @@ bool ValidateSyntax::EndTest()
  */
 bool ValidateSyntax::CheckAllFiles(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckAllFiles", "packchk");
   string workDir = pKg->GetAbsolutePackagePath();
   if(workDir.empty()) {
     workDir = "./";
@@ -192,6 +196,7 @@ bool ValidateSyntax::CheckLicense(RtePackage* pKg, CheckFilesVisitor& fileVisito
  */
 bool ValidateSyntax::CheckInfo(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckInfo", "packchk");
   string fileName = pKg->GetPackageFileName();
   LogMsg("M052", PATH(fileName));
 
@@ -261,6 +266,7 @@ bool ValidateSyntax::CheckInfo(RtePackage* pKg)
  */
 bool ValidateSyntax::CheckComponents(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckComponents", "packchk");
   string workDir = pKg->GetAbsolutePackagePath();
 
   CheckConditions checkConditions(GetModel());
@@ -292,6 +298,7 @@ bool ValidateSyntax::CheckComponents(RtePackage* pKg)
  */
 bool ValidateSyntax::CheckSchemaVersion(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckSchemaVersion", "packchk");
   m_schemaVersion = pKg->GetAttribute("schemaVersion");
   if(m_schemaVersion.empty()) {
     LogMsg("M376");
@@ -323,6 +330,7 @@ bool ValidateSyntax::ClearSchemaVersion()
  */
 bool ValidateSyntax::CheckPackageReleaseDate(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckPackageReleaseDate", "packchk");
   time_t rawtime;
   char buffer[80] = { "0000-00-00" };
 
@@ -408,6 +416,7 @@ bool ValidateSyntax::CheckPackageReleaseDate(RtePackage* pKg)
  */
 bool ValidateSyntax::CheckPackageUrl(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckPackageUrl", "packchk");
   CPackOptions& packOptions = GetOptions();
   const string& pRefUrl = packOptions.GetUrlRef();
   string pUrl = pKg->GetURL();
@@ -973,6 +982,7 @@ bool ValidateSyntax::CheckAddPropertyAll(RteDeviceProperty* prop, map<string, ma
  */
 bool ValidateSyntax::CheckDeviceProperties(RteDeviceItem* deviceItem, map<string, map<string, RteDeviceProperty*>>& prevPropertiesMaps)
 {
+  TraceSpan span("ValidateSyntax::CheckDeviceProperties", "packchk");
   if(!deviceItem) {
     return true;
   }
@@ -1113,6 +1123,7 @@ bool ValidateSyntax::CheckAddBoardProperty(RteItem* prop, map<string, RteItem*>&
  */
 bool ValidateSyntax::CheckBoardProperties(RteItem* boardItem, map<string, RteItem*>& prevProperties)
 {
+  TraceSpan span("ValidateSyntax::CheckBoardProperties", "packchk");
   if(!boardItem) {
     return true;
   }
@@ -1217,6 +1228,7 @@ bool ValidateSyntax::CheckDevices(RtePackage* pKg)
  */
 bool ValidateSyntax::CheckHierarchy(RteItem* parentItem, map<string, RteDeviceItem*>& treeItems)
 {
+  TraceSpan span("ValidateSyntax::CheckHierarchy", "packchk");
   if(!parentItem) {
     return true;
   }
@@ -1422,24 +1434,13 @@ bool ValidateSyntax::CheckForBoard(RteExample* example)
   const string& boardName = boardInfo->GetAttribute("name");
   const string& boardVendor = boardInfo->GetAttribute("vendor");
   const string& exampleName = example->GetName();
-  const RteBoardMap& boardMap = GetModel().GetBoards();
 
   LogMsg("M062", VAL("EXAMPLE", exampleName), VAL("BOARD", boardName), VAL("VENDOR", boardVendor));
 
   bool ok = false;
-  for(auto &[kBoard, vBoard] : boardMap) {
-    RteBoard* board = dynamic_cast<RteBoard*>(vBoard);
-    if(!board) {
-      continue;
-    }
-
-    string name = board->GetName();
-    string vendor = board->GetAttribute("vendor");
-
-    if(!boardName.compare(name) && !boardVendor.compare(vendor)) {
-      ok = true;
-      break;
-    }
+  auto it = m_boardVendors.find(boardName);
+  if(it != m_boardVendors.end()) {
+    ok = it->second.find(boardVendor) != it->second.end();
   }
 
   if(!ok) {
@@ -1459,6 +1460,7 @@ bool ValidateSyntax::CheckForBoard(RteExample* example)
  */
 bool ValidateSyntax::CheckExamples(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckExamples", "packchk");
   if(!pKg) {
     return true;
   }
@@ -1528,6 +1530,35 @@ bool ValidateSyntax::BoardFindExamples(RteBoard* board)
   const string& vendor = board->GetAttribute("vendor");
 
   bool ok = false;
+  auto it = m_exampleBoardVendors.find(name);
+  if(it != m_exampleBoardVendors.end()) {
+    ok = it->second.find(vendor) != it->second.end();
+  }
+
+  if(!ok) {
+    LogMsg("M379", VAL("BOARD", name), VAL("VENDOR", vendor), lineNo);
+  }
+
+  return ok;
+}
+
+/**
+ * @brief collect names and vendors of all boards and of all boards referenced by examples,
+ *        so board and example checks do not need to search the whole model
+ */
+void ValidateSyntax::InitBoardIndex()
+{
+  m_boardVendors.clear();
+  m_exampleBoardVendors.clear();
+
+  for(auto &[kBoard, vBoard] : GetModel().GetBoards()) {
+    RteBoard* board = dynamic_cast<RteBoard*>(vBoard);
+    if(!board) {
+      continue;
+    }
+    m_boardVendors[board->GetName()].insert(board->GetAttribute("vendor"));
+  }
+
   for(auto packItem : GetModel().GetChildren()) {
     RtePackage* pKg = dynamic_cast<RtePackage*>(packItem);
     if(pKg == nullptr) {
@@ -1541,26 +1572,14 @@ bool ValidateSyntax::BoardFindExamples(RteBoard* board)
 
     for(auto child : examples->GetChildren()) {
       RteExample* example = dynamic_cast<RteExample*>(child);
-      if(!example ||!example->GetBoardInfoItem()) {
+      if(!example || !example->GetBoardInfoItem()) {
         continue;
       }
 
       const RteItem* boardInfo = example->GetBoardInfoItem();
-      const string& boardName = boardInfo->GetAttribute("name");
-      const string& boardVendor = boardInfo->GetAttribute("vendor");
-
-      if(!boardName.compare(name) && !boardVendor.compare(vendor)) {
-        ok = true;
-        break;
-      }
+      m_exampleBoardVendors[boardInfo->GetAttribute("name")].insert(boardInfo->GetAttribute("vendor"));
     }
   }
-
-  if(!ok) {
-    LogMsg("M379", VAL("BOARD", name), VAL("VENDOR", vendor), lineNo);
-  }
-
-  return ok;
 }
 
 /**
@@ -1570,6 +1589,7 @@ bool ValidateSyntax::BoardFindExamples(RteBoard* board)
  */
 bool ValidateSyntax::CheckBoards(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckBoards", "packchk");
   if(!pKg) {
     return true;
   }
@@ -1697,6 +1717,7 @@ bool ValidateSyntax::CheckBoards(RtePackage* pKg)
  */
 bool ValidateSyntax::CheckTaxonomy(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckTaxonomy", "packchk");
   if(!pKg) {
     return true;
   }
@@ -1868,6 +1889,7 @@ bool ValidateSyntax::CheckDevicesMultiple(RteDeviceItem* deviceItem, const map<s
  */
 bool ValidateSyntax::CheckRequirements(RtePackage* pKg)
 {
+  TraceSpan span("ValidateSyntax::CheckRequirements", "packchk");
   if(!pKg) {
     return true;
   }
@@ -173,6 +173,38 @@ TEST_F(PackChkIntegTests, CheckComponentDependency) {
   }
 }
 
+// Check several packages in one run
+TEST_F(PackChkIntegTests, CheckPackages) {
+  const string& pdscFile = PackChkIntegTestEnv::globaltestdata_dir +
+    "/packs/ARM/RteTest/0.1.0/ARM.RteTest.pdsc";
+  const string& refFile = PackChkIntegTestEnv::globaltestdata_dir +
+    "/packs/ARM/RteTest_DFP/0.1.1/ARM.RteTest_DFP.pdsc";
+  const string& invalidFile = PackChkIntegTestEnv::localtestdata_dir +
+    "/InvalidPack/TestVendor.TestInvalidPack.pdsc";
+  ASSERT_TRUE(RteFsUtils::Exists(pdscFile));
+  ASSERT_TRUE(RteFsUtils::Exists(refFile));
+  ASSERT_TRUE(RteFsUtils::Exists(invalidFile));
+
+  PackChk packChk;
+  EXPECT_EQ(0, packChk.CheckPackages({ pdscFile }, { refFile }));
+
+  // an invalid package fails the run
+  PackChk packChkInvalid;
+  EXPECT_EQ(1, packChkInvalid.CheckPackages({ pdscFile, invalidFile }, { refFile }));
+
+  // files are reported with their canonical path, every report ends with a summary
+  const string& schemaFile = PackChkIntegTestEnv::localtestdata_dir +
+    "/SchemaValidation/../SchemaValidation/TestVendor.SchemaValidation.pdsc";
+  ASSERT_TRUE(RteFsUtils::Exists(schemaFile));
+  testing::internal::CaptureStdout();
+  PackChk packChkSchema;
+  EXPECT_EQ(1, packChkSchema.CheckPackages({ schemaFile }, {}));
+  const string& output = testing::internal::GetCapturedStdout();
+  EXPECT_EQ(string::npos, output.find("/../"));
+  EXPECT_NE(string::npos, output.find(RteFsUtils::MakePathCanonical(schemaFile)));
+  EXPECT_NE(string::npos, output.find("M022"));
+}
+
 // Check generation of pack file name
 TEST_F(PackChkIntegTests, WritePackFileName) {
   const char* argv[4];
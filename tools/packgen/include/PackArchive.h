@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PACKARCHIVE_H
+#define PACKARCHIVE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief archive entry structure containing
+ *        entry name inside the archive,
+ *        source file, empty for a directory entry
+*/
+struct archiveEntry {
+  std::string name;
+  std::string source;
+};
+
+/**
+ * @brief zip archive writer for *.pack files
+ *        entries are streamed from their source files, deflated concurrently with zlib
+ *        and written in the order they were added,
+ *        all entries get the same timestamp so identical inputs give a byte-identical archive,
+ *        archives exceeding the zip32 limits (4 GB, 65535 entries) are rejected
+*/
+class PackArchive {
+public:
+  /**
+   * @brief class constructor
+  */
+  PackArchive(void);
+
+  /**
+   * @brief class destructor
+  */
+  ~PackArchive(void);
+
+  /**
+   * @brief add entry to the archive
+   * @param name entry name inside the archive using forward slashes, directory names end with '/'
+   * @param source file to be read, empty string for a directory entry
+  */
+  void AddEntry(const std::string& name, const std::string& source);
+
+  /**
+   * @brief set number of compression threads
+   * @param jobs number of threads, 0 to use the hardware concurrency
+  */
+  void SetJobs(unsigned jobs);
+
+  /**
+   * @brief set modification time stored for all entries
+   * @param seconds seconds since 1970-01-01 UTC, times before 1980-01-01 are stored as 1980-01-01
+  */
+  void SetTimestamp(int64_t seconds);
+
+  /**
+   * @brief write archive file
+   * @param archiveFile archive file name
+   * @return true if no errors happened, false otherwise
+  */
+  bool Write(const std::string& archiveFile);
+
+  /**
+   * @brief get message of the last error
+   * @return error message
+  */
+  const std::string& GetErrorMessage(void) const { return m_errorMessage; }
+
+  /**
+   * @brief calculate CRC-32 checksum as used by zip
+   * @param data input data
+   * @param size size of input data
+   * @param crc checksum of preceding data
+   * @return updated checksum
+  */
+  static uint32_t Crc32(const char* data, size_t size, uint32_t crc = 0);
+
+protected:
+  std::vector<archiveEntry> m_entries;
+  unsigned m_jobs;
+  uint16_t m_dosTime;
+  uint16_t m_dosDate;
+  std::string m_errorMessage;
+};
+
+#endif  // PACKARCHIVE_H
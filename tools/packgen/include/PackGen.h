@@ -161,7 +161,8 @@ struct releaseInfo {
  *        list of taxonomy elements,
  *        list of api elements,
  *        list of component elements,
- *        pack output directory
+ *        pack output directory,
+ *        map of copied files in the output directory to their source files
 */
 struct packInfo {
   std::string name;
@@ -177,6 +178,7 @@ struct packInfo {
   std::list<std::string> apis;
   std::list<std::string> components;
   std::string outputDir;
+  std::map<std::string, std::string> sources;
 };
 
 /**
@@ -244,13 +246,13 @@ public:
   bool CreatePack(void);
 
   /**
-   * @brief run packchk to validate the generated pack
+   * @brief validate the generated packs with the packchk library
    * @return true if no errors happened, false otherwise
   */
   bool CheckPack(void);
 
   /**
-   * @brief run 7z to compress the generated pack
+   * @brief compress the generated pack into a *.pack archive
    * @return true if no errors happened, false otherwise
   */
   bool CompressPack(void);
@@ -273,7 +275,7 @@ protected:
   std::map<std::string, std::list<std::string>> m_extensions;
 
   static void SetAttribute(XMLTreeElement* element, const std::string& name, const std::string& value);
-  static bool CopyItem(const std::string& src, const std::string& dst, std::list<std::string>& ext);
+  static bool CopyItem(const std::string& src, const std::string& dst, std::list<std::string>& ext, std::map<std::string, std::string>& sources);
   static const std::string GetFileCategory(const std::string& file, std::list<std::string>& ext);
   static uint32_t CountNodes(const YAML::Node node, const std::string& name);
   void AddComponentBuildInfo(const std::string& componentName, buildInfo& reference);
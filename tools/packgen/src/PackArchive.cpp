@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "PackArchive.h"
+
+#include "JobPool.h"
+#include "RteFileWriter.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <mutex>
+
+using namespace std;
+
+namespace {
+
+// zip record signatures and fields
+constexpr uint32_t LOCAL_HEADER_SIGNATURE = 0x04034b50;
+constexpr uint32_t CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+constexpr uint32_t END_OF_CENTRAL_DIR_SIGNATURE = 0x06054b50;
+constexpr uint16_t METHOD_STORED = 0;
+constexpr uint16_t METHOD_DEFLATED = 8;
+constexpr uint16_t VERSION_STORED = 10;
+constexpr uint16_t VERSION_DEFLATED = 20;
+constexpr uint16_t FLAG_UTF8 = 0x0800;
+constexpr uint32_t ATTRIBUTE_DIRECTORY = 0x10;
+constexpr uint64_t ZIP32_LIMIT = 0xFFFFFFFF;
+constexpr size_t ZIP32_MAX_ENTRIES = 0xFFFF;
+
+// source files are streamed in chunks of this size
+constexpr size_t CHUNK_SIZE = 65536;
+// compression is given up once this much input did not shrink
+constexpr uint64_t INCOMPRESSIBLE_SIZE = 1024 * 1024;
+
+// compressed entry, filled by a worker thread and written in entry order
+struct ArchiveData {
+  string data;
+  uint32_t crc = 0;
+  uint64_t size = 0;
+  uint16_t method = METHOD_STORED;
+  string error;
+};
+
+// read file chunk by chunk, stops and returns false if consume returns false
+bool ReadSource(const string& file, const function<bool(const char*, size_t)>& consume) {
+  ifstream stream(file, ios::binary);
+  if (!stream) {
+    return false;
+  }
+  vector<char> buffer(CHUNK_SIZE);
+  while (stream) {
+    stream.read(buffer.data(), buffer.size());
+    const size_t size = static_cast<size_t>(stream.gcount());
+    if (size > 0 && !consume(buffer.data(), size)) {
+      return false;
+    }
+  }
+  return stream.eof();
+}
+
+// deflate with zlib default level, kept only if it is smaller than the source
+void CompressEntry(const archiveEntry& entry, ArchiveData& result) {
+  if (entry.source.empty()) {
+    return;
+  }
+  z_stream stream = {};
+  if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+    result.error = "cannot initialize compression";
+    return;
+  }
+  bool compress = true;
+  auto deflateChunk = [&](const char* data, size_t size, int flush) {
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream.avail_in = static_cast<uInt>(size);
+    do {
+      const size_t used = result.data.size();
+      result.data.resize(used + CHUNK_SIZE);
+      stream.next_out = reinterpret_cast<Bytef*>(&result.data[used]);
+      stream.avail_out = static_cast<uInt>(CHUNK_SIZE);
+      deflate(&stream, flush);
+      result.data.resize(used + CHUNK_SIZE - stream.avail_out);
+    } while (stream.avail_out == 0);
+  };
+  const bool read = ReadSource(entry.source, [&](const char* data, size_t size) {
+    result.crc = PackArchive::Crc32(data, size, result.crc);
+    result.size += size;
+    if (compress) {
+      deflateChunk(data, size, Z_NO_FLUSH);
+      if (result.size >= INCOMPRESSIBLE_SIZE && result.data.size() >= result.size) {
+        compress = false;
+        string().swap(result.data);
+      }
+    }
+    return true;
+  });
+  if (!read) {
+    result.error = "cannot read file '" + entry.source + "'";
+  } else if (compress) {
+    deflateChunk(nullptr, 0, Z_FINISH);
+    if (result.data.size() < result.size) {
+      result.method = METHOD_DEFLATED;
+    } else {
+      string().swap(result.data);
+    }
+  }
+  deflateEnd(&stream);
+}
+
+void PutLE(string& out, uint32_t value, unsigned bytes) {
+  for (unsigned i = 0; i < bytes; i++, value >>= 8) {
+    out.push_back(static_cast<char>(value & 0xFF));
+  }
+}
+
+} // namespace
+
+PackArchive::PackArchive(void) :
+  m_jobs(0)
+{
+  SetTimestamp(0);
+}
+
+PackArchive::~PackArchive(void) {
+  // Reserved
+}
+
+void PackArchive::AddEntry(const string& name, const string& source) {
+  m_entries.push_back({ name, source });
+}
+
+void PackArchive::SetJobs(unsigned jobs) {
+  m_jobs = jobs;
+}
+
+void PackArchive::SetTimestamp(int64_t seconds) {
+  // civil date from days since epoch, UTC
+  constexpr int64_t DOS_EPOCH = 315532800; // 1980-01-01T00:00:00Z
+  seconds = max(seconds, DOS_EPOCH);
+  const int64_t days = seconds / 86400;
+  const int64_t secs = seconds % 86400;
+  const int64_t z = days + 719468;
+  const int64_t era = z / 146097;
+  const int64_t doe = z - era * 146097;
+  const int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const int64_t mp = (5 * doy + 2) / 153;
+  const int64_t day = doy - (153 * mp + 2) / 5 + 1;
+  const int64_t month = mp < 10 ? mp + 3 : mp - 9;
+  const int64_t year = min<int64_t>(yoe + era * 400 + (month <= 2 ? 1 : 0), 2107);
+  m_dosDate = static_cast<uint16_t>(((year - 1980) << 9) | (month << 5) | day);
+  m_dosTime = static_cast<uint16_t>(((secs / 3600) << 11) | (((secs / 60) % 60) << 5) | ((secs % 60) / 2));
+}
+
+bool PackArchive::Write(const string& archiveFile) {
+  m_errorMessage.clear();
+  const size_t count = m_entries.size();
+  if (count > ZIP32_MAX_ENTRIES) {
+    m_errorMessage = "too many archive entries";
+    return false;
+  }
+  RteFileWriter writer;
+  if (!writer.Open(archiveFile)) {
+    m_errorMessage = "cannot create file '" + archiveFile + "'";
+    return false;
+  }
+
+  // append compressed entry, stored entries are copied from their source again
+  string centralDir;
+  uint64_t offset = 0;
+  auto writeEntry = [&](const archiveEntry& entry, const ArchiveData& result) {
+    if (!result.error.empty()) {
+      m_errorMessage = result.error;
+      return false;
+    }
+    const uint64_t compressedSize = result.method == METHOD_DEFLATED ? result.data.size() : result.size;
+    if (compressedSize > ZIP32_LIMIT || offset > ZIP32_LIMIT) {
+      m_errorMessage = "archive exceeds 4 GB";
+      return false;
+    }
+    const bool directory = entry.source.empty();
+    const bool utf8 = any_of(entry.name.begin(), entry.name.end(), [](char c) { return static_cast<unsigned char>(c) > 0x7F; });
+    const uint16_t version = result.method == METHOD_DEFLATED ? VERSION_DEFLATED : VERSION_STORED;
+
+    // fields shared by local and central headers
+    string common;
+    PutLE(common, version, 2);
+    PutLE(common, utf8 ? FLAG_UTF8 : 0, 2);
+    PutLE(common, result.method, 2);
+    PutLE(common, m_dosTime, 2);
+    PutLE(common, m_dosDate, 2);
+    PutLE(common, result.crc, 4);
+    PutLE(common, static_cast<uint32_t>(compressedSize), 4);
+    PutLE(common, static_cast<uint32_t>(result.size), 4);
+    PutLE(common, static_cast<uint32_t>(entry.name.size()), 2);
+    PutLE(common, 0, 2);
+
+    string header;
+    PutLE(header, LOCAL_HEADER_SIGNATURE, 4);
+    header += common;
+    header += entry.name;
+    writer.Write(header);
+    if (result.method == METHOD_DEFLATED) {
+      writer.Write(result.data);
+    } else if (!directory) {
+      uint32_t crc = 0;
+      uint64_t size = 0;
+      const bool read = ReadSource(entry.source, [&](const char* data, size_t chunk) {
+        crc = Crc32(data, chunk, crc);
+        size += chunk;
+        return size <= result.size && writer.Write(data, chunk);
+      });
+      if (!read || size != result.size || crc != result.crc) {
+        m_errorMessage = "cannot read file '" + entry.source + "'";
+        return false;
+      }
+    }
+
+    PutLE(centralDir, CENTRAL_HEADER_SIGNATURE, 4);
+    PutLE(centralDir, VERSION_DEFLATED, 2);
+    centralDir += common;
+    PutLE(centralDir, 0, 2);
+    PutLE(centralDir, 0, 2);
+    PutLE(centralDir, 0, 2);
+    PutLE(centralDir, directory ? ATTRIBUTE_DIRECTORY : 0, 4);
+    PutLE(centralDir, static_cast<uint32_t>(offset), 4);
+    centralDir += entry.name;
+
+    offset += header.size() + compressedSize;
+    return true;
+  };
+
+  // each job compresses one entry and writes it once all preceding entries are written,
+  // so the output does not depend on the number of jobs and every job holds at most one entry
+  size_t turn = 0;
+  mutex turnMutex;
+  condition_variable turnChanged;
+  atomic<bool> failed(false);
+  auto job = [&](size_t i) {
+    ArchiveData result;
+    if (!failed) {
+      CompressEntry(m_entries[i], result);
+    }
+    {
+      unique_lock<mutex> lock(turnMutex);
+      turnChanged.wait(lock, [&turn, i]() { return turn == i; });
+      if (!failed && !writeEntry(m_entries[i], result)) {
+        failed = true;
+      }
+      turn++;
+    }
+    turnChanged.notify_all();
+  };
+  JobPool::Run(count, job, m_jobs);
+
+  if (m_errorMessage.empty() && (offset > ZIP32_LIMIT || offset + centralDir.size() > ZIP32_LIMIT)) {
+    m_errorMessage = "archive exceeds 4 GB";
+  }
+  if (!m_errorMessage.empty()) {
+    writer.Discard();
+    return false;
+  }
+
+  string endOfCentralDir;
+  PutLE(endOfCentralDir, END_OF_CENTRAL_DIR_SIGNATURE, 4);
+  PutLE(endOfCentralDir, 0, 2);
+  PutLE(endOfCentralDir, 0, 2);
+  PutLE(endOfCentralDir, static_cast<uint32_t>(count), 2);
+  PutLE(endOfCentralDir, static_cast<uint32_t>(count), 2);
+  PutLE(endOfCentralDir, static_cast<uint32_t>(centralDir.size()), 4);
+  PutLE(endOfCentralDir, static_cast<uint32_t>(offset), 4);
+  PutLE(endOfCentralDir, 0, 2);
+  writer.Write(centralDir);
+  if (!writer.Write(endOfCentralDir) || !writer.Commit()) {
+    m_errorMessage = "cannot write file '" + archiveFile + "'";
+    return false;
+  }
+  return true;
+}
+
+uint32_t PackArchive::Crc32(const char* data, size_t size, uint32_t crc) {
+  // zlib takes 32-bit lengths
+  while (size > 0) {
+    const uInt chunk = static_cast<uInt>(min<size_t>(size, CHUNK_SIZE));
+    crc = static_cast<uint32_t>(crc32(crc, reinterpret_cast<const Bytef*>(data), chunk));
+    data += chunk;
+    size -= chunk;
+  }
+  return crc;
+}
+
+// end of PackArchive.cpp
@@ -4,9 +4,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include "PackArchive.h"
+#include "PackChk.h"
 #include "PackGen.h"
 #include "ProductInfo.h"
 
+#include "RteFileWriter.h"
 #include "RteFsUtils.h"
 #include "XmlFormatter.h"
 #include "CrossPlatformUtils.h"
@@ -142,14 +145,14 @@ int PackGen::RunPackGen(int argc, char **argv) {
     return 1;
   }
 
-  // Run packchk
+  // Check generated packs
   if (!nocheck) {
     if (!generator.CheckPack()) {
       return 1;
     }
   }
 
-  // Run 7zip
+  // Create *.pack archive
   if (!nozip) {
     if (!generator.CompressPack()) {
       return 1;
@@ -683,7 +686,9 @@ bool PackGen::CreatePack() {
     // Copy license
     error_code ec;
     fs::create_directories(pack.outputDir, ec);
-    fs::copy_file(m_repoRoot + "/" + pack.license, pack.outputDir + "/" + pack.license, fs::copy_options::overwrite_existing, ec);
+    const string& license = pack.outputDir + "/" + pack.license;
+    fs::copy_file(m_repoRoot + "/" + pack.license, license, fs::copy_options::overwrite_existing, ec);
+    pack.sources[fs::path(license).lexically_normal().generic_string()] = m_repoRoot + "/" + pack.license;
 
     // Root
     m_pdscTree = new XMLTreeSlim();
@@ -724,14 +729,9 @@ bool PackGen::CreatePack() {
 
     // Save file
     const string& file = pack.outputDir + "/" + pack.vendor + "." + pack.name + ".pdsc";
-    ofstream xmlFile(file);
-    if (!xmlFile) {
+    if (!RteFileWriter::WriteFile(file, xmlContent + '\n', true)) {
       return false;
     }
-
-    xmlFile << xmlContent;
-    xmlFile << std::endl;
-    xmlFile.close();
   }
 
   return true;
@@ -815,7 +815,7 @@ void PackGen::CreatePackApis(XMLTreeElement* rootElement, packInfo& pack) {
           SetAttribute(fileElement, attribute.first, attribute.second);
         }
         const string dst = pack.outputDir + "/" + file.name;
-        CopyItem(m_repoRoot + "/" + file.name, dst, m_extensions[apiName]);
+        CopyItem(m_repoRoot + "/" + file.name, dst, m_extensions[apiName], pack.sources);
       }
     }
   }
@@ -896,7 +896,7 @@ void PackGen::CreatePackComponentsAndConditions(XMLTreeElement* rootElement, pac
           destination = pack.outputDir + "/" + src;
         }
         fileElement->AddAttribute("name", name);
-        CopyItem(origin, destination, m_extensions[componentName]);
+        CopyItem(origin, destination, m_extensions[componentName], pack.sources);
       }
       // Include paths from CMake targets
       for (const auto& inc : componentInfo.build.inc) {
@@ -913,7 +913,7 @@ void PackGen::CreatePackComponentsAndConditions(XMLTreeElement* rootElement, pac
           destination = pack.outputDir + "/" + inc;
         }
         fileElement->AddAttribute("name", name);
-        CopyItem(origin, destination, m_extensions[componentName]);
+        CopyItem(origin, destination, m_extensions[componentName], pack.sources);
       }
       // Other files described in manifest
       for (const auto& file : componentInfo.files) {
@@ -923,7 +923,7 @@ void PackGen::CreatePackComponentsAndConditions(XMLTreeElement* rootElement, pac
           SetAttribute(fileElement, attribute.first, attribute.second);
         }
         const string dst = pack.outputDir + "/" + file.name;
-        CopyItem(m_repoRoot + "/" + file.name, dst, m_extensions[componentName]);
+        CopyItem(m_repoRoot + "/" + file.name, dst, m_extensions[componentName], pack.sources);
 
         // Add file conditions described in manifest
         if (!file.conditions.empty()) {
@@ -959,69 +959,79 @@ void PackGen::CreatePackComponentsAndConditions(XMLTreeElement* rootElement, pac
 }
 
 bool PackGen::CheckPack(void) {
-  StrIntPair result;
   error_code ec;
   const auto& workingDir = fs::current_path(ec);
 
-  // Iterate over packs
+  // PDSC files generated in this run, each one is checked with the other ones as reference
+  vector<string> pdscFiles;
   for (const auto& pack : m_pack) {
+    pdscFiles.push_back(pack.outputDir + "/" + pack.vendor + "." + pack.name + ".pdsc");
+  }
 
-    // Change working dir
-    fs::current_path(pack.outputDir, ec);
-
-    // PDSC references generated in this run
-    string pdscList;
-    for (const auto& ref : m_pack) {
-      if ((pack.name != ref.name) || (pack.vendor != ref.vendor)) {
-        pdscList += " -i \"" + ref.outputDir + "/" + ref.vendor + "." + ref.name + ".pdsc\"";
-      }
-    }
-
-    // External PDSC references
-    for (auto& externalPdsc : m_externalPdsc) {
-      RteFsUtils::NormalizePath(externalPdsc, workingDir.generic_string() + "/");
-      if (RteFsUtils::Exists(externalPdsc)) {
-        pdscList += " -i \"" + externalPdsc + "\"";
-      }
-    }
-
-    // packchk
-    result = CrossPlatformUtils::ExecCommand("packchk \"" + pack.vendor + "." + pack.name + ".pdsc\"" + pdscList);
-    if (result.second) {
-      cerr << "packgen error: packchk failed" << endl << result.first << endl;
-      return false;
-    } else {
-      // packchk report
-      cout << result.first << endl;
+  // External PDSC references
+  set<string> refFiles;
+  for (auto& externalPdsc : m_externalPdsc) {
+    RteFsUtils::NormalizePath(externalPdsc, workingDir.generic_string() + "/");
+    if (RteFsUtils::Exists(externalPdsc)) {
+      refFiles.insert(externalPdsc);
     }
   }
 
-  // Restore working dir
-  fs::current_path(workingDir, ec);
+  // packchk
+  PackChk packChk;
+  if (packChk.CheckPackages(pdscFiles, refFiles)) {
+    cerr << "packgen error: packchk failed" << endl;
+    return false;
+  }
   return true;
 }
 
 bool PackGen::CompressPack(void) {
-  StrIntPair result;
-  error_code ec;
-  const auto& workingDir = fs::current_path(ec);
+  // Reproducible timestamp for all archive entries
+  int64_t timestamp = 0;
+  const string& sourceDateEpoch = CrossPlatformUtils::GetEnv("SOURCE_DATE_EPOCH");
+  if (!sourceDateEpoch.empty()) {
+    try {
+      timestamp = stoll(sourceDateEpoch);
+    }
+    catch (exception&) {
+      cerr << "packgen warning: invalid SOURCE_DATE_EPOCH '" << sourceDateEpoch << "'" << endl;
+    }
+  }
 
   // Iterate over packs
   for (const auto& pack : m_pack) {
+    const string& packFile = pack.vendor + "." + pack.name + "." + pack.version + ".pack";
 
-    // Change working dir
-    fs::current_path(pack.outputDir, ec);
-
-    // 7zip
-    result = CrossPlatformUtils::ExecCommand("7z a \"" + pack.vendor + "." + pack.name + "." + pack.version + ".pack\" -tzip");
-    if (result.second) {
-      cerr << "packgen error: 7zip failed\n" << result.first << endl;
+    // Collect staged files in a deterministic order
+    error_code ec;
+    vector<pair<string, bool>> items;
+    for (const auto& p : fs::recursive_directory_iterator(pack.outputDir, ec)) {
+      const string& name = p.path().lexically_relative(pack.outputDir).generic_string();
+      if (name == packFile) {
+        continue;
+      }
+      items.push_back({ name, p.is_directory(ec) });
+    }
+    sort(items.begin(), items.end());
+
+    // Write archive, copied files are read from their original sources
+    PackArchive archive;
+    archive.SetTimestamp(timestamp);
+    for (const auto& [name, directory] : items) {
+      if (directory) {
+        archive.AddEntry(name + "/", "");
+        continue;
+      }
+      const string& staged = fs::path(pack.outputDir + "/" + name).lexically_normal().generic_string();
+      const auto source = pack.sources.find(staged);
+      archive.AddEntry(name, source != pack.sources.end() ? source->second : staged);
+    }
+    if (!archive.Write(pack.outputDir + "/" + packFile)) {
+      cerr << "packgen error: " << packFile << " creation failed: " << archive.GetErrorMessage() << endl;
       return false;
     }
   }
-
-  // Restore working dir
-  fs::current_path(workingDir, ec);
   return true;
 }
 
@@ -1078,7 +1088,7 @@ bool PackGen::CreateQuery() {
   return true;
 }
 
-bool PackGen::CopyItem(const string& src, const string& dst, list<string>& ext) {
+bool PackGen::CopyItem(const string& src, const string& dst, list<string>& ext, map<string, string>& sources) {
   //Copy file or directory recursively filtering extensions
   error_code ec;
   fs::path srcPath = fs::path(src);
@@ -1087,6 +1097,7 @@ bool PackGen::CopyItem(const string& src, const string& dst, list<string>& ext)
     // Copy file
     fs::create_directories(dstPath.parent_path(), ec);
     fs::copy_file(srcPath, dstPath, fs::copy_options::overwrite_existing, ec);
+    sources[dstPath.lexically_normal().generic_string()] = srcPath.generic_string();
   } else {
     // Copy directory recursively filtering extensions
     for (const auto& p : fs::recursive_directory_iterator(srcPath, ec)) {
@@ -1095,6 +1106,7 @@ bool PackGen::CopyItem(const string& src, const string& dst, list<string>& ext)
         string filename = dstPath.generic_string() + p.path().generic_string().substr(srcPath.generic_string().length(), string::npos);
         fs::create_directories(fs::path(filename).parent_path(), ec);
         fs::copy_file(p.path(), fs::path(filename), fs::copy_options::overwrite_existing, ec);
+        sources[fs::path(filename).lexically_normal().generic_string()] = p.path().generic_string();
       }
     }
   }
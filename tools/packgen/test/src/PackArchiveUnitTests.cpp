@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "PackArchive.h"
+#include "PackGenTestEnv.h"
+#include "RteFsUtils.h"
+
+#include "gtest/gtest.h"
+
+#include <zlib.h>
+
+using namespace std;
+
+class PackArchiveUnitTests : public ::testing::Test {
+protected:
+  static uint32_t ReadLE(const string& data, size_t pos, unsigned bytes) {
+    uint32_t value = 0;
+    for (unsigned i = 0; i < bytes; i++) {
+      value |= static_cast<uint32_t>(static_cast<uint8_t>(data[pos + i])) << (8 * i);
+    }
+    return value;
+  }
+
+  static uint32_t Crc32(const string& data) {
+    return PackArchive::Crc32(data.data(), data.size());
+  }
+
+  // raw inflate of an archive entry
+  static bool Inflate(const string& input, string& output) {
+    z_stream stream = {};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+      return false;
+    }
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+    int ret = Z_OK;
+    char buffer[4096];
+    while (ret == Z_OK) {
+      stream.next_out = reinterpret_cast<Bytef*>(buffer);
+      stream.avail_out = sizeof(buffer);
+      ret = inflate(&stream, Z_NO_FLUSH);
+      output.append(buffer, sizeof(buffer) - stream.avail_out);
+    }
+    inflateEnd(&stream);
+    return ret == Z_STREAM_END && stream.avail_in == 0;
+  }
+
+  // check local header and content of the entry at pos, returns position of the next entry
+  size_t CheckEntry(const string& archive, size_t pos, const string& name, uint16_t method, const string& content) {
+    EXPECT_EQ(0x04034b50u, ReadLE(archive, pos, 4));
+    EXPECT_EQ(method, ReadLE(archive, pos + 8, 2));
+    EXPECT_EQ(Crc32(content), ReadLE(archive, pos + 14, 4));
+    EXPECT_EQ(content.size(), ReadLE(archive, pos + 22, 4));
+    EXPECT_EQ(name, archive.substr(pos + 30, ReadLE(archive, pos + 26, 2)));
+    const string& data = archive.substr(pos + 30 + name.size(), ReadLE(archive, pos + 18, 4));
+    string output;
+    if (method == 8) {
+      EXPECT_TRUE(Inflate(data, output));
+    } else {
+      output = data;
+    }
+    EXPECT_TRUE(content == output);
+    return pos + 30 + name.size() + data.size();
+  }
+};
+
+TEST_F(PackArchiveUnitTests, Crc32) {
+  EXPECT_EQ(0u, Crc32(""));
+  EXPECT_EQ(0xCBF43926u, Crc32("123456789"));
+  EXPECT_EQ(0xCBF43926u, PackArchive::Crc32("6789", 4, Crc32("12345")));
+}
+
+TEST_F(PackArchiveUnitTests, Write) {
+  const string& srcDir = testoutput_folder + "/PackArchive";
+  RteFsUtils::CreateDirectories(srcDir + "/Include");
+  string text;
+  for (unsigned i = 0; i < 1000; i++) {
+    text += "#define VALUE_" + to_string(i) + " " + to_string(i) + "\n";
+  }
+  RteFsUtils::CreateTextFile(srcDir + "/Include/Test.h", text);
+  RteFsUtils::CreateTextFile(srcDir + "/LICENSE", "x");
+
+  auto write = [&](unsigned jobs, const string& file) {
+    PackArchive archive;
+    archive.SetJobs(jobs);
+    archive.SetTimestamp(1700000000);
+    archive.AddEntry("Include/", "");
+    archive.AddEntry("Include/Test.h", srcDir + "/Include/Test.h");
+    archive.AddEntry("LICENSE", srcDir + "/LICENSE");
+    EXPECT_TRUE(archive.Write(file)) << archive.GetErrorMessage();
+  };
+  const string& archive1 = testoutput_folder + "/PackArchive1.pack";
+  const string& archive2 = testoutput_folder + "/PackArchive2.pack";
+  write(1, archive1);
+  write(4, archive2);
+
+  // archive is independent of the number of jobs
+  string content1, content2;
+  ASSERT_TRUE(RteFsUtils::ReadFile(archive1, content1));
+  ASSERT_TRUE(RteFsUtils::ReadFile(archive2, content2));
+  EXPECT_TRUE(content1 == content2);
+
+  // end of central directory record
+  ASSERT_GT(content1.size(), 22u);
+  const size_t end = content1.size() - 22;
+  EXPECT_EQ(0x06054b50u, ReadLE(content1, end, 4));
+  EXPECT_EQ(3u, ReadLE(content1, end + 10, 2));
+
+  // file entries: deflated, 2023-11-14 22:13:20 UTC, content matches
+  size_t pos = 30 + string("Include/").size();
+  EXPECT_EQ((22u << 11) | (13u << 5) | 10u, ReadLE(content1, pos + 10, 2));
+  EXPECT_EQ(((2023u - 1980u) << 9) | (11u << 5) | 14u, ReadLE(content1, pos + 12, 2));
+  pos = CheckEntry(content1, pos, "Include/Test.h", 8, text);
+  CheckEntry(content1, pos, "LICENSE", 0, "x");
+
+  // missing source file
+  PackArchive archive;
+  archive.AddEntry("Missing.h", srcDir + "/Missing.h");
+  EXPECT_FALSE(archive.Write(testoutput_folder + "/PackArchive3.pack"));
+  EXPECT_FALSE(archive.GetErrorMessage().empty());
+  EXPECT_FALSE(RteFsUtils::Exists(testoutput_folder + "/PackArchive3.pack"));
+}
+
+TEST_F(PackArchiveUnitTests, WriteStreamed) {
+  const string& srcDir = testoutput_folder + "/PackArchiveStreamed";
+  RteFsUtils::CreateDirectories(srcDir);
+
+  // text spanning several read chunks
+  string text;
+  for (unsigned i = 0; i < 20000; i++) {
+    text += "line " + to_string(i % 997) + " of the test input\n";
+  }
+  // incompressible data larger than the point where compression is given up
+  string noise;
+  uint32_t seed = 1;
+  for (unsigned i = 0; i < 1200000; i++) {
+    seed = seed * 1103515245 + 12345;
+    noise.push_back(static_cast<char>(seed >> 24));
+  }
+  RteFsUtils::CopyBufferToFile(srcDir + "/Text.txt", text, false);
+  RteFsUtils::CopyBufferToFile(srcDir + "/Noise.bin", noise, false);
+
+  PackArchive archive;
+  archive.AddEntry("Text.txt", srcDir + "/Text.txt");
+  archive.AddEntry("Noise.bin", srcDir + "/Noise.bin");
+  const string& archiveFile = testoutput_folder + "/PackArchiveStreamed.pack";
+  ASSERT_TRUE(archive.Write(archiveFile)) << archive.GetErrorMessage();
+
+  string content;
+  ASSERT_TRUE(RteFsUtils::ReadFile(archiveFile, content));
+  const size_t pos = CheckEntry(content, 0, "Text.txt", 8, text);
+  EXPECT_LT(pos, text.size() / 4);
+  CheckEntry(content, pos, "Noise.bin", 0, noise);
+}
@@ -7,6 +7,7 @@
 #ifndef PROJMGR_H
 #define PROJMGR_H
 
+#include "ProjMgrContextCache.h"
 #include "ProjMgrParser.h"
 #include "ProjMgrWorker.h"
 #include "ProjMgrGenerator.h"
@@ -136,6 +137,7 @@ protected:
   std::string m_clayerSearchPath;
   std::string m_export;
   std::string m_selectedToolchain;
+  std::string m_traceFile;
   bool m_checkSchema;
   bool m_missingPacks;
   bool m_updateRteFiles;
@@ -148,10 +150,15 @@ protected:
   bool m_frozenPacks;
   bool m_cbuildgen;
   bool m_updateIdx;
+  bool m_force;
+  bool m_useContextCache;
   GroupNode m_files;
   std::vector<ContextItem*> m_processedContexts;
   std::vector<ContextItem*> m_allContexts;
   std::set<std::string> m_failedContext;
+  std::set<std::string> m_cachedContexts;
+  StrMap m_contextInputs;
+  ProjMgrContextCache m_contextCache;
 
   bool RunConfigure();
   bool RunConvert();
@@ -175,6 +182,11 @@ protected:
   bool GenerateYMLConfigurationFiles();
   bool UpdateRte();
   bool ParseAndValidateContexts();
+  bool IsContextCacheApplicable();
+  bool GetContextInputs(ContextItem& context, std::string& inputs);
+  void CollectContextFiles(const ContextItem& context, StrSet& files, StrSet& existingFiles);
+  void UpdateContextCache(bool success);
+  std::string GetCbuildIdxDirectory();
 };
 
 #endif  // PROJMGR_H
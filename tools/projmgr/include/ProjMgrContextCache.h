@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PROJMGRCONTEXTCACHE_H
+#define PROJMGRCONTEXTCACHE_H
+
+#include "ProjMgrUtils.h"
+
+#include <cstdint>
+
+/**
+ * @brief cached context entry containing
+ *        fingerprint of the context inputs,
+ *        map of files produced or read while processing the context and their stamps
+*/
+struct ContextCacheItem {
+  std::string inputs;
+  StrMap files;
+};
+
+/**
+ * @brief projmgr context cache class, it keeps fingerprints of the contexts converted by a previous run
+ *        next to the cbuild-idx.yml so unchanged contexts can reuse their previous outputs
+*/
+class ProjMgrContextCache {
+public:
+  /**
+   * @brief class constructor
+  */
+  ProjMgrContextCache(void);
+
+  /**
+   * @brief class destructor
+  */
+  ~ProjMgrContextCache(void);
+
+  /**
+   * @brief load cache file and check which contexts the previous cbuild-idx.yml lists without issues
+   * @param cacheFile cache file name
+   * @param cbuildIdxFile previous cbuild-idx.yml file name
+  */
+  void Load(const std::string& cacheFile, const std::string& cbuildIdxFile);
+
+  /**
+   * @brief write cache file, remove it if no context is cached
+   * @return true if executed successfully
+  */
+  bool Save(void) const;
+
+  /**
+   * @brief drop all cached contexts
+  */
+  void Clear(void);
+
+  /**
+   * @brief check whether context inputs and files are unchanged since the cached run
+   * @param context name
+   * @param inputs fingerprint of the context inputs
+   * @return true if the previous outputs of the context can be reused
+  */
+  bool IsUpToDate(const std::string& context, const std::string& inputs) const;
+
+  /**
+   * @brief record context after processing
+   * @param context name
+   * @param inputs fingerprint of the context inputs
+   * @param files files whose size and modification time must be unchanged
+   * @param existingFiles files that only need to exist
+  */
+  void Update(const std::string& context, const std::string& inputs, const StrSet& files, const StrSet& existingFiles);
+
+  /**
+   * @brief remove context from cache
+   * @param context name
+  */
+  void Remove(const std::string& context);
+
+  /**
+   * @brief add file name and content to a fingerprint started with RteUtils::FNV_OFFSET,
+   *        a missing file is hashed with empty content
+   * @param hash fingerprint to be updated
+   * @param file file name
+  */
+  static void HashFile(uint64_t& hash, const std::string& file);
+
+  /**
+   * @brief get file stamp
+   * @param file file name
+   * @param exists true to stamp only the file existence
+   * @return stamp string with file size and modification time
+  */
+  static std::string GetFileStamp(const std::string& file, bool exists = false);
+
+  /**
+   * @brief convert fingerprint to string
+   * @param hash fingerprint
+   * @return hexadecimal string
+  */
+  static std::string ToString(uint64_t hash);
+
+protected:
+  std::string m_cacheFile;
+  std::map<std::string, ContextCacheItem> m_contexts;
+  StrSet m_indexedContexts;
+};
+
+#endif  // PROJMGRCONTEXTCACHE_H
@@ -8,9 +8,12 @@
 #define PROJMGRPARSER_H
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+struct YamlDocument;
+
 /**
 * @brief type pair containing
 *        build-type,
@@ -587,6 +590,14 @@ public:
   */
   bool ParseCbuildSet(const std::string& input, bool checkSchema);
 
+  /**
+   * @brief load and validate files concurrently ahead of parsing them,
+   *        errors are reported when a file is parsed
+   * @param files list of cproject.yml and clayer.yml files
+   * @param checkSchema false to skip schema validation
+  */
+  void PreloadFiles(const std::vector<std::string>& files, bool checkSchema);
+
   /**
    * @brief get cdefault
    * @return cdefault item
@@ -630,6 +641,7 @@ protected:
   std::map<std::string, CprojectItem> m_cprojects;
   std::map<std::string, ClayerItem> m_clayers;
   std::map<std::string, ClayerItem> m_genericClayers;
+  std::map<std::string, std::shared_ptr<YamlDocument>> m_documents;
 };
 
 #endif  // PROJMGRPARSER_H
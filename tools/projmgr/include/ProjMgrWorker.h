@@ -585,6 +585,12 @@ public:
   */
   void SetEnvironmentVariables(const StrVec& envVars);
 
+  /**
+   * @brief get vector of environment variables
+   * @return reference to vector of environment variables
+  */
+  const StrVec& GetEnvironmentVariables() const { return m_envVars; };
+
   /**
    * @brief set selected toolchain
    * @param reference to selected toolchain
@@ -623,6 +629,14 @@ public:
   */
   bool LoadAllRelevantPacks(void);
 
+  /**
+   * @brief get pdsc files relevant for a context without loading packs
+   * @param context item
+   * @param pdscFiles reference to set of pdsc file names
+   * @return true if executed successfully
+  */
+  bool GetContextPdscFiles(ContextItem& context, StrSet& pdscFiles);
+
   /**
    * @brief parse context selection
    * @param contexts pattern (wildcards are allowed)
@@ -752,6 +766,9 @@ protected:
   RteGlobalModel* m_model = nullptr;
   ProjMgrExtGenerator* m_extGenerator = nullptr;
   std::list<RtePackage*> m_loadedPacks;
+  std::list<std::string> m_relevantPdscFiles;
+  bool m_relevantPdscCollected = false;
+  bool m_relevantPdscValid = false;
   std::vector<ToolchainItem> m_toolchains;
   StrVec m_toolchainConfigFiles;
   StrVec m_missingToolchains;
@@ -783,10 +800,17 @@ protected:
   StrVec m_selectableCompilers;
   bool m_undefCompiler = false;
   std::map<std::string, FileNode> m_missingFiles;
+  // pack requirements resolved once for all contexts: (vendor, name, version range) -> (pack ID, pdsc file)
+  std::map<std::tuple<std::string, std::string, std::string>, std::pair<std::string, std::string>> m_effectivePdscFiles;
+  // pack filters expanded once for all contexts: (pack root, vendor, name pattern) -> packs
+  std::map<std::tuple<std::string, std::string, std::string>, std::vector<PackageItem>> m_filteredPacks;
+  // pack requirements matched once per cbuild-pack file: (cbuild-pack file, pack requirement) -> pack IDs
+  std::map<std::pair<std::string, std::string>, std::vector<std::string>> m_cbuildPackMatches;
 
   bool LoadPacks(ContextItem& context);
   bool CheckMissingPackRequirements(const std::string& contextName);
   bool CollectRequiredPdscFiles(ContextItem& context, const std::string& packRoot);
+  bool CollectAllRelevantPdscFiles(void);
   bool CheckRteErrors(void);
   bool CheckBoardDeviceInLayer(const ContextItem& context, const ClayerItem& clayer);
   bool CheckCompiler(const std::vector<std::string>& forCompiler, const std::string& selectedCompiler);
@@ -834,7 +858,8 @@ protected:
   bool GetPrecedentValue(std::string& outValue, const std::string& element) const;
   std::string GetDeviceInfoString(const std::string& vendor, const std::string& name, const std::string& processor) const;
   std::string GetBoardInfoString(const std::string& vendor, const std::string& name, const std::string& revision) const;
-  std::vector<PackageItem> GetFilteredPacks(const PackageItem& packItem, const std::string& rtePath) const;
+  std::vector<PackageItem> GetFilteredPacks(const PackageItem& packItem, const std::string& rtePath);
+  const std::pair<std::string, std::string>& GetEffectivePdscFile(const std::string& vendor, const std::string& name, const std::string& versionRange);
   ToolchainItem GetToolchain(const std::string& compiler);
   bool IsPreIncludeByTarget(const RteTarget* activeTarget, const std::string& preInclude);
   void PrintConnectionsValidation(ConnectionsValidationResult result, std::string& msg);
@@ -872,6 +897,8 @@ protected:
   bool GetGeneratorOptions(ContextItem& context, const std::string& layer, GeneratorOptionsItem& options);
   bool GetExtGeneratorOptions(ContextItem& context, const std::string& layer, GeneratorOptionsItem& options);
   bool ParseContextLayers(ContextItem& context);
+  void ResolveContextLayers(ContextItem& context, StrVec& clayerFiles);
+  bool ParseContextLayerFiles(ContextItem& context, const StrVec& clayerFiles);
   bool AddPackRequirements(ContextItem& context, const std::vector<PackItem>& packRequirements);
   void InsertPackRequirements(const std::vector<PackItem>& src, std::vector<PackItem>& dst, std::string base);
   void CheckTypeFilterSpelling(const TypeFilter& typeFilter);
@@ -880,6 +907,7 @@ protected:
   void CheckDeviceAttributes(const ContextItem& context, const ProcessorItem& userSelection, const StrMap& targetAttributes);
   std::string GetContextRteFolder(ContextItem& context);
   std::vector<std::string> FindMatchingPackIdsInCbuildPack(const PackItem& needle, const std::vector<ResolvedPackItem>& resolvedPacks);
+  std::vector<std::string> FindMatchingPackIdsInCbuildPack(const PackItem& needle, const CbuildPackItem& cbuildPack);
   void PrintContextErrors(const std::string& contextName);
   void SetFilesDependencies(const GroupNode& group, const std::string& ouput, StrVec& dependsOn, const std::string& dep, const std::string& outDir);
   void SetBuildOutputDependencies(const OutputTypes& outputTypes, const std::string& input, StrVec& dependsOn, const std::string& dep, const std::string& outDir);
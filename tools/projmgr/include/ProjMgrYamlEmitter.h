@@ -33,12 +33,14 @@ public:
    * @param failed contexts
    * @param executes nodes at solution level
    * @param boolean check schema of generated file
+   * @param cached contexts whose entries are taken over from the existing file
    * @return true if executed successfully
   */
   static bool GenerateCbuildIndex(ProjMgrParser& parser, ProjMgrWorker& worker,
     const std::vector<ContextItem*>& contexts, const std::string& outputDir,
     const std::set<std::string>& failedContexts,
-    const std::map<std::string, ExecutesItem>& executes, bool checkSchema);
+    const std::map<std::string, ExecutesItem>& executes, bool checkSchema,
+    const std::set<std::string>& cachedContexts = std::set<std::string>());
 
   /**
    * @brief generate cbuild-gen-idx.yml file
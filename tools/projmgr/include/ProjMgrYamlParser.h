@@ -8,8 +8,11 @@
 #define PROJMGRYAMLPARSER_H
 
 #include "ProjMgrParser.h"
+#include "RteError.h"
 #include "yaml-cpp/yaml.h"
 
+#include <list>
+
 /**
   * @brief YAML key definitions
 */
@@ -37,6 +40,7 @@ static constexpr const char* YAML_BUILDTYPES = "build-types";
 static constexpr const char* YAML_CATEGORY = "category";
 static constexpr const char* YAML_CBUILDS = "cbuilds";
 static constexpr const char* YAML_CBUILD = "cbuild";
+static constexpr const char* YAML_CBUILD_CACHE = "cbuild-cache";
 static constexpr const char* YAML_CBUILD_GENS = "cbuild-gens";
 static constexpr const char* YAML_CBUILD_GEN = "cbuild-gen";
 static constexpr const char* YAML_CBUILD_PACK = "cbuild-pack";
@@ -103,6 +107,7 @@ static constexpr const char* YAML_IMPLEMENTED_BY = "implemented-by";
 static constexpr const char* YAML_IMPLEMENTS = "implements";
 static constexpr const char* YAML_INFO = "info";
 static constexpr const char* YAML_INPUT = "input";
+static constexpr const char* YAML_INPUTS = "inputs";
 static constexpr const char* YAML_INSTANCES = "instances";
 static constexpr const char* YAML_LANGUAGE = "language";
 static constexpr const char* YAML_LANGUAGE_C = "language-C";
@@ -165,6 +170,7 @@ static constexpr const char* YAML_SETUP = "setup";
 static constexpr const char* YAML_SET = "set";
 static constexpr const char* YAML_SETTINGS = "settings";
 static constexpr const char* YAML_SELECT_COMPILER = "select-compiler";
+static constexpr const char* YAML_STAMP = "stamp";
 static constexpr const char* YAML_STATUS = "status";
 static constexpr const char* YAML_SWITCH = "switch";
 static constexpr const char* YAML_TARGET_CONFIGURATIONS = "target-configurations";
@@ -181,6 +187,22 @@ static constexpr const char* YAML_VERSION = "version";
 static constexpr const char* YAML_WARNINGS = "warnings";
 static constexpr const char* YAML_WORKING_DIR = "working-dir";
 
+/**
+  * @brief yaml document loaded in advance containing
+  *        root node,
+  *        schema file,
+  *        schema check flag,
+  *        validity flag,
+  *        errors and warnings found while loading and validating it
+*/
+struct YamlDocument {
+  YAML::Node root;
+  std::string schemaFile;
+  bool checkSchema = false;
+  bool valid = false;
+  std::list<RteError> errors;
+};
+
 /**
   * @brief projmgr parser yaml implementation class, directly coupled to underlying yaml-cpp external library
 */
@@ -191,6 +213,12 @@ public:
   */
   ProjMgrYamlParser(void);
 
+  /**
+   * @brief class constructor
+   * @param documents files loaded in advance, taken over when parsed
+  */
+  ProjMgrYamlParser(std::map<std::string, std::shared_ptr<YamlDocument>>& documents);
+
   /**
    * @brief class destructor
   */
@@ -242,8 +270,17 @@ public:
   */
   bool ParseCbuildSet(const std::string& input, CbuildSetItem& cbuildSet, bool checkSchema);
 
+  /**
+   * @brief load and validate files concurrently, documents are stored for parsing them later
+   * @param files list of yml files
+   * @param checkSchema false to skip schema validation
+  */
+  void PreloadFiles(const std::vector<std::string>& files, bool checkSchema);
 
 protected:
+  std::map<std::string, std::shared_ptr<YamlDocument>>* m_documents;
+  bool LoadFile(const std::string& input, bool checkSchema, YAML::Node& root);
+  static void ReadDocument(const std::string& input, YamlDocument& document);
   bool ParseCbuildPack(const std::string& input, CbuildPackItem& cbuildPack, bool checkSchema);
   void ParseMisc(const YAML::Node& parent, std::vector<MiscItem>& misc);
   void ParseDefine(const YAML::Node& defineNode, std::vector<std::string>& define);
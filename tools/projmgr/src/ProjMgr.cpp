@@ -10,6 +10,7 @@
 #include "ProjMgrUtils.h"
 #include "ProductInfo.h"
 #include "RteFsUtils.h"
+#include "Tracer.h"
 
 #include "CrossPlatformUtils.h"
 
@@ -72,7 +73,9 @@ ProjMgr::ProjMgr() :
   m_contextSet(false),
   m_relativePaths(false),
   m_frozenPacks(false),
-  m_updateIdx(false)
+  m_updateIdx(false),
+  m_force(false),
+  m_useContextCache(false)
 {
 }
 
@@ -159,23 +162,25 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
   cxxopts::Option updateIdx("update-idx", "Update cbuild-idx file with layer info", cxxopts::value<bool>()->default_value("false"));
   cxxopts::Option quiet("q,quiet", "Run silently, printing only error messages", cxxopts::value<bool>()->default_value("false"));
   cxxopts::Option cbuildgen("cbuildgen", "Generate legacy *.cprj files", cxxopts::value<bool>()->default_value("false"));
+  cxxopts::Option trace("trace", "Write Chrome trace event JSON of processing steps to file", cxxopts::value<string>());
+  cxxopts::Option force("force", "Convert all contexts, including contexts unchanged since the previous run", cxxopts::value<bool>()->default_value("false"));
 
   // command options dictionary
   map<string, std::pair<bool, vector<cxxopts::Option>>> optionsDict = {
     // command, optional args, options
-    {"update-rte",        { false, {context, contextSet, debug, load, quiet, schemaCheck, toolchain, verbose, frozenPacks}}},
-    {"convert",           { false, {context, contextSet, debug, exportSuffix, load, quiet, schemaCheck, noUpdateRte, output, outputAlt, toolchain, verbose, frozenPacks, cbuildgen}}},
-    {"run",               { false, {context, contextSet, debug, generator, load, quiet, schemaCheck, verbose, dryRun}}},
-    {"list packs",        { true,  {context, contextSet, debug, filter, load, missing, quiet, schemaCheck, toolchain, verbose, relativePaths}}},
-    {"list boards",       { true,  {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list devices",      { true,  {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list configs",      { false, {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list components",   { true,  {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list dependencies", { false, {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list contexts",     { false, {debug, filter, quiet, schemaCheck, verbose, ymlOrder}}},
-    {"list generators",   { false, {context, contextSet, debug, load, quiet, schemaCheck, toolchain, verbose}}},
-    {"list layers",       { false, {context, contextSet, debug, load, clayerSearchPath, quiet, schemaCheck, toolchain, verbose, updateIdx}}},
-    {"list toolchains",   { false, {context, contextSet, debug, quiet, toolchain, verbose}}},
+    {"update-rte",        { false, {context, contextSet, debug, load, quiet, schemaCheck, toolchain, verbose, frozenPacks, trace}}},
+    {"convert",           { false, {context, contextSet, debug, exportSuffix, load, quiet, schemaCheck, noUpdateRte, output, outputAlt, toolchain, verbose, frozenPacks, cbuildgen, trace, force}}},
+    {"run",               { false, {context, contextSet, debug, generator, load, quiet, schemaCheck, verbose, dryRun, trace}}},
+    {"list packs",        { true,  {context, contextSet, debug, filter, load, missing, quiet, schemaCheck, toolchain, verbose, relativePaths, trace}}},
+    {"list boards",       { true,  {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose, trace}}},
+    {"list devices",      { true,  {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose, trace}}},
+    {"list configs",      { false, {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose, trace}}},
+    {"list components",   { true,  {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose, trace}}},
+    {"list dependencies", { false, {context, contextSet, debug, filter, load, quiet, schemaCheck, toolchain, verbose, trace}}},
+    {"list contexts",     { false, {debug, filter, quiet, schemaCheck, verbose, ymlOrder, trace}}},
+    {"list generators",   { false, {context, contextSet, debug, load, quiet, schemaCheck, toolchain, verbose, trace}}},
+    {"list layers",       { false, {context, contextSet, debug, load, clayerSearchPath, quiet, schemaCheck, toolchain, verbose, updateIdx, trace}}},
+    {"list toolchains",   { false, {context, contextSet, debug, quiet, toolchain, verbose, trace}}},
     {"list environment",  { true,  {}}},
   };
 
@@ -185,7 +190,7 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
       solution, context, contextSet, filter, generator,
       load, clayerSearchPath, missing, schemaCheck, noUpdateRte, output, outputAlt,
       help, version, verbose, debug, dryRun, exportSuffix, toolchain, ymlOrder,
-      relativePaths, frozenPacks, updateIdx, quiet, cbuildgen
+      relativePaths, frozenPacks, updateIdx, quiet, cbuildgen, trace, force
     });
     options.parse_positional({ "positional" });
 
@@ -210,6 +215,7 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
     m_frozenPacks = parseResult.count("frozen-packs");
     m_cbuildgen = parseResult.count("cbuildgen");
     m_worker.SetCbuild2Cmake(!m_cbuildgen);
+    m_force = parseResult.count("force");
     ProjMgrLogger::m_quiet = parseResult.count("quiet");
 
     vector<string> positionalArguments;
@@ -267,6 +273,9 @@ int ProjMgr::ParseCommandLine(int argc, char** argv) {
     if (parseResult.count("toolchain")) {
       m_selectedToolchain = parseResult["toolchain"].as<string>();
     }
+    if (parseResult.count("trace")) {
+      m_traceFile = parseResult["trace"].as<string>();
+    }
     if (parseResult.count("output") || parseResult.count("O")) {
       const std::string& key = parseResult.count("output") ? "output" : "O";
       m_outputDir = parseResult[key].as<std::string>();
@@ -312,9 +321,18 @@ int ProjMgr::RunProjMgr(int argc, char** argv, char** envp) {
     }
   }
   manager.m_worker.SetEnvironmentVariables(envVars);
-  if(manager.m_worker.InitializeModel()) {
-    res = manager.ProcessCommands();
-  } else {
+  TraceFile traceFile(manager.m_traceFile, [](const string& fileName) {
+    ProjMgrLogger::Get().Error("trace file cannot be written", "", fileName);
+  });
+  {
+    TraceSpan span("csolution", "projmgr", manager.m_command + (manager.m_args.empty() ? "" : " " + manager.m_args));
+    if(manager.m_worker.InitializeModel()) {
+      res = manager.ProcessCommands();
+    } else {
+      res = ErrorCode::ERROR;
+    }
+  }
+  if(!traceFile.Stop()) {
     res = ErrorCode::ERROR;
   }
   return res;
@@ -453,7 +471,8 @@ bool ProjMgr::PopulateContexts(void) {
         ProjMgrLogger::Get().Warn("cproject.yml files should be placed in separate sub-directories", "", m_csolutionFile);
       }
     }
-    // Parse cprojects
+    // Parse cprojects, the files are loaded and validated concurrently in advance
+    StrVec cprojectFiles;
     for (const auto& cproject : cprojects) {
       error_code ec;
       string const& cprojectFile = fs::canonical(m_rootDir + "/" + cproject, ec).generic_string();
@@ -461,6 +480,10 @@ bool ProjMgr::PopulateContexts(void) {
         ProjMgrLogger::Get().Error("cproject file was not found", "", cproject);
         return false;
       }
+      cprojectFiles.push_back(cprojectFile);
+    }
+    m_parser.PreloadFiles(cprojectFiles, m_checkSchema);
+    for (const auto& cprojectFile : cprojectFiles) {
       if (!m_parser.ParseCproject(cprojectFile, m_checkSchema)) {
         return false;
       }
@@ -499,8 +522,8 @@ bool ProjMgr::PopulateContexts(void) {
 }
 
 bool ProjMgr::GenerateYMLConfigurationFiles() {
-  // Generate cbuild pack file
-  const bool isUsingContexts = m_contextSet || m_context.size() != 0;
+  // Generate cbuild pack file, packs of cached contexts are kept from the existing file
+  const bool isUsingContexts = m_contextSet || m_context.size() != 0 || !m_cachedContexts.empty();
   if (!m_emitter.GenerateCbuildPack(m_parser, m_processedContexts, isUsingContexts, m_frozenPacks, m_checkSchema)) {
     return false;
   }
@@ -514,12 +537,27 @@ bool ProjMgr::GenerateYMLConfigurationFiles() {
       result = false;
     }
   }
+  for (const auto& contextItem : m_allContexts) {
+    if (m_cachedContexts.find(contextItem->name) != m_cachedContexts.end()) {
+      const string& filename = fs::path(contextItem->directories.cbuild).append(contextItem->name + ".cbuild.yml").generic_string();
+      if (m_verbose) {
+        ProjMgrLogger::Get().Info("context '" + contextItem->name + "' is unchanged, processing skipped", contextItem->name);
+      }
+      ProjMgrLogger::Get().Info("file is already up-to-date", contextItem->name, filename);
+    }
+  }
 
   // Generate cbuild index file
   if (!m_allContexts.empty()) {
     map<string, ExecutesItem> executes;
     m_worker.GetExecutes(executes);
-    if (!m_emitter.GenerateCbuildIndex(m_parser, m_worker, m_processedContexts, m_outputDir, m_failedContext, executes, m_checkSchema)) {
+    vector<ContextItem*> indexedContexts;
+    for (const auto& contextItem : m_allContexts) {
+      if (m_worker.IsContextSelected(contextItem->name)) {
+        indexedContexts.push_back(contextItem);
+      }
+    }
+    if (!m_emitter.GenerateCbuildIndex(m_parser, m_worker, indexedContexts, m_outputDir, m_failedContext, executes, m_checkSchema, m_cachedContexts)) {
       return false;
     }
   }
@@ -575,6 +613,16 @@ bool ProjMgr::Configure() {
   vector<string> orderedContexts;
   m_worker.GetYmlOrderedContexts(orderedContexts);
 
+  // Load fingerprints of contexts converted by the previous run
+  const bool useContextCache = m_useContextCache && IsContextCacheApplicable();
+  m_cachedContexts.clear();
+  m_contextInputs.clear();
+  if (useContextCache) {
+    const string& directory = GetCbuildIdxDirectory();
+    m_contextCache.Load(directory + "/" + m_parser.GetCsolution().name + ".cbuild-cache.yml",
+      directory + "/" + m_parser.GetCsolution().name + ".cbuild-idx.yml");
+  }
+
   // Process contexts
   bool error = false;
   m_allContexts.clear();
@@ -586,6 +634,16 @@ bool ProjMgr::Configure() {
     if (!m_worker.IsContextSelected(contextName)) {
       continue;
     }
+    if (useContextCache) {
+      // Skip context if inputs and outputs are unchanged
+      string& inputs = m_contextInputs[contextName];
+      if (!GetContextInputs(contextItem, inputs)) {
+        inputs.clear();
+      } else if (m_contextCache.IsUpToDate(contextName, inputs)) {
+        m_cachedContexts.insert(contextName);
+        continue;
+      }
+    }
     if (!m_worker.ProcessContext(contextItem, true, true, false)) {
       ProjMgrLogger::Get().Error("processing context '" + contextName + "' failed", contextName);
       m_failedContext.insert(contextItem.name);
@@ -660,7 +718,8 @@ bool ProjMgr::RunConfigure() {
 }
 
 bool ProjMgr::RunConvert(void) {
-  // Configure
+  // Configure, skipping unchanged contexts unless forced
+  m_useContextCache = !m_force;
   bool Success = Configure();
 
   // Generate YML build configuration files
@@ -684,15 +743,169 @@ bool ProjMgr::RunConvert(void) {
           ProjMgrLogger::Get().Info("export file generated successfully", contextItem->name, exportfilename);
         } else {
           ProjMgrLogger::Get().Error("export file cannot be written", contextItem->name, exportfilename);
+          UpdateContextCache(false);
           return false;
         }
       }
     }
   }
 
+  // Update fingerprints of converted contexts
+  UpdateContextCache(Success);
+
   return Success;
 }
 
+bool ProjMgr::IsContextCacheApplicable() {
+  // executes nodes connect contexts with each other, all contexts are converted then
+  if (!m_parser.GetCsolution().executes.empty()) {
+    return false;
+  }
+  for (const auto& [_, cproject] : m_parser.GetCprojects()) {
+    if (!cproject.executes.empty()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+string ProjMgr::GetCbuildIdxDirectory() {
+  return m_outputDir.empty() ? m_parser.GetCsolution().directory : RteFsUtils::AbsolutePath(m_outputDir).generic_string();
+}
+
+bool ProjMgr::GetContextInputs(ContextItem& context, string& inputs) {
+  uint64_t hash = RteUtils::FNV_OFFSET;
+
+  // tool version and options affecting the outputs
+  const vector<string> options = {
+    VERSION_STRING, context.name, m_outputDir, m_loadPacksPolicy, m_selectedToolchain, m_export,
+    m_cbuildgen ? "cbuildgen" : "", m_updateRteFiles ? "update-rte" : "", m_frozenPacks ? "frozen-packs" : "",
+    ProjMgrKernel::Get()->GetCmsisPackRoot(),
+  };
+  for (const auto& option : options) {
+    RteUtils::HashString(hash, option);
+  }
+
+  // environment variables registering toolchains and roots
+  for (const auto& envVar : m_worker.GetEnvironmentVariables()) {
+    if (envVar.find("_TOOLCHAIN_") != string::npos || envVar.rfind("CMSIS_", 0) == 0) {
+      RteUtils::HashString(hash, envVar);
+    }
+  }
+
+  // input files
+  ProjMgrContextCache::HashFile(hash, m_parser.GetCsolution().path);
+  if (!m_parser.GetCdefault().path.empty()) {
+    ProjMgrContextCache::HashFile(hash, m_parser.GetCdefault().path);
+  }
+  if (context.cproject) {
+    ProjMgrContextCache::HashFile(hash, context.cproject->path);
+  }
+  for (const auto& [clayer, _] : context.clayers) {
+    ProjMgrContextCache::HashFile(hash, clayer);
+  }
+  if (m_contextSet) {
+    ProjMgrContextCache::HashFile(hash, GetCbuildIdxDirectory() + "/" + m_parser.GetCsolution().name + ".cbuild-set.yml");
+  }
+
+  // resolved packs
+  StrSet pdscFiles;
+  if (!m_worker.GetContextPdscFiles(context, pdscFiles)) {
+    return false;
+  }
+  for (const auto& pdscFile : pdscFiles) {
+    RteUtils::HashString(hash, pdscFile);
+    RteUtils::HashString(hash, ProjMgrContextCache::GetFileStamp(pdscFile));
+  }
+
+  inputs = ProjMgrContextCache::ToString(hash);
+  return true;
+}
+
+void ProjMgr::CollectContextFiles(const ContextItem& context, StrSet& files, StrSet& existingFiles) {
+  const string& cprjDir = context.directories.cprj;
+  auto addFile = [&](StrSet& fileSet, const string& file) {
+    if (!file.empty() && !ProjMgrUtils::HasAccessSequence(file)) {
+      fileSet.insert(fs::path(file).is_absolute() ? file : RteFsUtils::LexicallyNormal(cprjDir + "/" + file));
+    }
+  };
+
+  // generated outputs
+  addFile(files, fs::path(context.directories.cbuild).append(context.name + ".cbuild.yml").generic_string());
+  addFile(files, m_parser.GetCsolution().directory + "/" + m_parser.GetCsolution().name + ".cbuild-pack.yml");
+  if (m_cbuildgen) {
+    addFile(files, cprjDir + "/" + context.name + ".cprj");
+    if (!m_export.empty()) {
+      addFile(files, cprjDir + "/" + context.name + m_export + ".cprj");
+    }
+  }
+
+  // configuration files and own target folder, target folders of sibling contexts are left out
+  error_code ec;
+  string targetDir;
+  if (context.rteActiveProject && context.rteActiveTarget) {
+    targetDir = RteFsUtils::ParentPath(context.rteActiveProject->GetProjectPath() +
+      context.rteActiveProject->GetRteComponentsH(context.rteActiveTarget->GetName(), ""));
+  }
+  const string& rteDir = cprjDir + "/" + context.directories.rte;
+  for (auto it = fs::recursive_directory_iterator(rteDir, ec); it != fs::recursive_directory_iterator(); it.increment(ec)) {
+    if (it.depth() == 0 && it->is_directory(ec) && it->path().filename().generic_string().rfind('_', 0) == 0 &&
+      !fs::equivalent(it->path(), targetDir, ec)) {
+      it.disable_recursion_pending();
+    } else if (it->is_regular_file(ec)) {
+      files.insert(it->path().generic_string());
+    }
+  }
+
+  // generator and layer files read while processing
+  for (const auto& [gpdsc, _] : context.gpdscs) {
+    addFile(files, gpdsc);
+  }
+  for (const auto& [clayer, _] : context.clayers) {
+    addFile(files, clayer);
+  }
+  addFile(files, context.linker.script);
+  addFile(files, context.linker.regions);
+
+  // user files only need to exist
+  function<void(const vector<GroupNode>&)> addGroupFiles = [&](const vector<GroupNode>& groups) {
+    for (const auto& group : groups) {
+      for (const auto& fileNode : group.files) {
+        addFile(existingFiles, fileNode.file);
+      }
+      addGroupFiles(group.groups);
+    }
+  };
+  addGroupFiles(context.groups);
+}
+
+void ProjMgr::UpdateContextCache(bool success) {
+  if (!m_useContextCache) {
+    return;
+  }
+  if (!success) {
+    // outputs of a failed run are incomplete, convert all contexts next time
+    m_contextCache.Clear();
+  } else {
+    for (const auto& contextItem : m_processedContexts) {
+      const string& inputs = m_contextInputs[contextItem->name];
+      const auto& warns = ProjMgrLogger::Get().GetWarns();
+      // contexts with warnings are converted again to report them
+      if (inputs.empty() || m_failedContext.find(contextItem->name) != m_failedContext.end() ||
+        warns.find(contextItem->name) != warns.end()) {
+        m_contextCache.Remove(contextItem->name);
+        continue;
+      }
+      StrSet files, existingFiles;
+      CollectContextFiles(*contextItem, files, existingFiles);
+      m_contextCache.Update(contextItem->name, inputs, files, existingFiles);
+    }
+  }
+  if (!m_contextCache.Save()) {
+    ProjMgrLogger::Get().Warn("context cache file cannot be written");
+  }
+}
+
 bool ProjMgr::RunListPacks(void) {
   if (!m_csolutionFile.empty()) {
     // Parse all input files and create contexts
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ProductInfo.h"
+#include "ProjMgrContextCache.h"
+#include "ProjMgrLogger.h"
+#include "ProjMgrYamlParser.h"
+#include "RteFileWriter.h"
+#include "RteFsUtils.h"
+
+#include <filesystem>
+
+using namespace std;
+
+static constexpr const char* STAMP_MISSING = "-";
+static constexpr const char* STAMP_EXISTS = "+";
+
+ProjMgrContextCache::ProjMgrContextCache(void) {
+  // Reserved
+}
+
+ProjMgrContextCache::~ProjMgrContextCache(void) {
+  // Reserved
+}
+
+void ProjMgrContextCache::Load(const string& cacheFile, const string& cbuildIdxFile) {
+  m_cacheFile = cacheFile;
+  m_contexts.clear();
+  m_indexedContexts.clear();
+  if (!RteFsUtils::Exists(cacheFile) || !RteFsUtils::Exists(cbuildIdxFile)) {
+    return;
+  }
+  try {
+    // contexts listed in the previous cbuild-idx.yml without errors or warnings
+    const YAML::Node& cbuildIdx = YAML::LoadFile(cbuildIdxFile);
+    for (const auto& cbuildNode : cbuildIdx[YAML_BUILD_IDX][YAML_CBUILDS]) {
+      const YAML::Node& messages = cbuildNode[YAML_MESSAGES];
+      if (cbuildNode[YAML_ERRORS].IsDefined() || messages[YAML_ERRORS].IsDefined() || messages[YAML_WARNINGS].IsDefined()) {
+        continue;
+      }
+      const string& cbuild = RteUtils::ExtractFileName(cbuildNode[YAML_CBUILD].as<string>(""));
+      m_indexedContexts.insert(RteUtils::RemoveSuffixByString(cbuild, ".cbuild.yml"));
+    }
+    const YAML::Node& cache = YAML::LoadFile(cacheFile);
+    for (const auto& contextNode : cache[YAML_CBUILD_CACHE][YAML_CONTEXTS]) {
+      ContextCacheItem item;
+      item.inputs = contextNode[YAML_INPUTS].as<string>("");
+      for (const auto& fileNode : contextNode[YAML_FILES]) {
+        item.files[fileNode[YAML_FILE].as<string>("")] = fileNode[YAML_STAMP].as<string>("");
+      }
+      m_contexts[contextNode[YAML_CONTEXT].as<string>("")] = item;
+    }
+  }
+  catch (YAML::Exception&) {
+    // an unreadable cache invalidates all contexts
+    m_contexts.clear();
+  }
+}
+
+bool ProjMgrContextCache::Save(void) const {
+  if (m_cacheFile.empty()) {
+    return true;
+  }
+  if (m_contexts.empty()) {
+    return !RteFsUtils::Exists(m_cacheFile) || RteFsUtils::RemoveFile(m_cacheFile);
+  }
+  YAML::Node rootNode;
+  YAML::Node node = rootNode[YAML_CBUILD_CACHE];
+  node[YAML_GENERATED_BY] = ORIGINAL_FILENAME + string(" version ") + VERSION_STRING;
+  for (const auto& [context, item] : m_contexts) {
+    YAML::Node contextNode;
+    contextNode[YAML_CONTEXT] = context;
+    contextNode[YAML_INPUTS] = item.inputs;
+    for (const auto& [file, stamp] : item.files) {
+      YAML::Node fileNode;
+      fileNode[YAML_FILE] = file;
+      fileNode[YAML_STAMP] = stamp;
+      contextNode[YAML_FILES].push_back(fileNode);
+    }
+    node[YAML_CONTEXTS].push_back(contextNode);
+  }
+  YAML::Emitter emitter;
+  emitter << rootNode;
+  return RteFileWriter::WriteFile(m_cacheFile, string(emitter.c_str()) + '\n', true);
+}
+
+void ProjMgrContextCache::Clear(void) {
+  m_contexts.clear();
+}
+
+bool ProjMgrContextCache::IsUpToDate(const string& context, const string& inputs) const {
+  const auto& it = m_contexts.find(context);
+  if (it == m_contexts.end() || it->second.inputs != inputs ||
+    m_indexedContexts.find(context) == m_indexedContexts.end()) {
+    return false;
+  }
+  for (const auto& [file, stamp] : it->second.files) {
+    if (GetFileStamp(file, stamp == STAMP_EXISTS) != stamp) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ProjMgrContextCache::Update(const string& context, const string& inputs, const StrSet& files, const StrSet& existingFiles) {
+  ContextCacheItem& item = m_contexts[context];
+  item.inputs = inputs;
+  item.files.clear();
+  for (const auto& file : existingFiles) {
+    item.files[file] = GetFileStamp(file, true);
+  }
+  for (const auto& file : files) {
+    item.files[file] = GetFileStamp(file);
+  }
+}
+
+void ProjMgrContextCache::Remove(const string& context) {
+  m_contexts.erase(context);
+}
+
+void ProjMgrContextCache::HashFile(uint64_t& hash, const string& file) {
+  string content;
+  if (!RteFsUtils::ReadFile(file, content)) {
+    content.clear();
+  }
+  RteUtils::HashString(hash, file);
+  RteUtils::HashString(hash, content);
+}
+
+string ProjMgrContextCache::GetFileStamp(const string& file, bool exists) {
+  error_code ec;
+  const auto size = fs::file_size(file, ec);
+  if (ec) {
+    return RteFsUtils::IsDirectory(file) ? STAMP_EXISTS : STAMP_MISSING;
+  }
+  if (exists) {
+    return STAMP_EXISTS;
+  }
+  const auto time = fs::last_write_time(file, ec);
+  return to_string(size) + ':' + to_string(time.time_since_epoch().count());
+}
+
+string ProjMgrContextCache::ToString(uint64_t hash) {
+  static constexpr const char* HEX = "0123456789abcdef";
+  string text(16, '0');
+  for (int i = 15; i >= 0; i--, hash >>= 4) {
+    text[i] = HEX[hash & 0xf];
+  }
+  return text;
+}
@@ -8,6 +8,7 @@
 #include "ProjMgrUtils.h"
 #include "ProductInfo.h"
 
+#include "RteFileWriter.h"
 #include "RteFsUtils.h"
 #include "XmlFormatter.h"
 #include "XMLTreeSlim.h"
@@ -428,14 +429,5 @@ bool ProjMgrGenerator::WriteXmlFile(const string& file, XMLTree* tree) {
   const string& xmlContent = xmlFormatter.GetContent();
 
   // Save file
-  ofstream xmlFile(file);
-  if (!xmlFile) {
-    return false;
-  }
-
-  xmlFile << xmlContent;
-  xmlFile << std::endl;
-  xmlFile.close();
-
-  return true;
+  return RteFileWriter::WriteFile(file, xmlContent + '\n', true);
 }
@@ -35,18 +35,18 @@ bool ProjMgrParser::ParseCsolution(const string& input, bool checkSchema, bool f
 
 bool ProjMgrParser::ParseCproject(const string& input, bool checkSchema, bool single) {
   // Parse project
-  return ProjMgrYamlParser().ParseCproject(
+  return ProjMgrYamlParser(m_documents).ParseCproject(
     input, m_csolution, m_cprojects, single, checkSchema);
 }
 
 bool ProjMgrParser::ParseClayer(const string& input, bool checkSchema) {
   // Parse layer file
-  return ProjMgrYamlParser().ParseClayer(input, m_clayers, checkSchema);
+  return ProjMgrYamlParser(m_documents).ParseClayer(input, m_clayers, checkSchema);
 }
 
 bool ProjMgrParser::ParseGenericClayer(const string& input, bool checkSchema) {
   // Parse generic layer file
-  return ProjMgrYamlParser().ParseClayer(input, m_genericClayers, checkSchema);
+  return ProjMgrYamlParser(m_documents).ParseClayer(input, m_genericClayers, checkSchema);
 }
 
 bool ProjMgrParser::ParseCbuildSet(const string& input, bool checkSchema) {
@@ -54,6 +54,11 @@ bool ProjMgrParser::ParseCbuildSet(const string& input, bool checkSchema) {
   return ProjMgrYamlParser().ParseCbuildSet(input, m_cbuildSet, checkSchema);
 }
 
+void ProjMgrParser::PreloadFiles(const vector<string>& files, bool checkSchema) {
+  // Load and validate files concurrently
+  ProjMgrYamlParser(m_documents).PreloadFiles(files, checkSchema);
+}
+
 CdefaultItem& ProjMgrParser::GetCdefault(void) {
   return m_cdefault;
 }
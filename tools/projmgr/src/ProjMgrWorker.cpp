@@ -10,6 +10,7 @@
 
 #include "CrossPlatformUtils.h"
 #include "RteFsUtils.h"
+#include "Tracer.h"
 
 #include <algorithm>
 #include <iostream>
@@ -158,6 +159,13 @@ void ProjMgrWorker::AddContext(ContextDesc& descriptor, const TypePair& type, Co
 }
 
 bool ProjMgrWorker::ParseContextLayers(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ParseContextLayers", "projmgr", context.name);
+  StrVec clayerFiles;
+  ResolveContextLayers(context, clayerFiles);
+  return ParseContextLayerFiles(context, clayerFiles);
+}
+
+void ProjMgrWorker::ResolveContextLayers(ContextItem& context, StrVec& clayerFiles) {
   // user defined variables
   typedef std::vector<std::pair<std::string, std::string>> Variables;
   auto itBuildType = std::find_if(context.csolution->buildTypes.begin(), context.csolution->buildTypes.end(),
@@ -193,7 +201,7 @@ bool ProjMgrWorker::ParseContextLayers(ContextItem& context) {
       context.variables[key] = expandedValue;
     }
   }
-  // parse clayers
+  // resolve clayers
   for (const auto& clayer : context.cproject->clayers) {
     if (clayer.layer.empty()) {
       continue;
@@ -220,11 +228,17 @@ bool ProjMgrWorker::ParseContextLayers(ContextItem& context) {
           }
         }
       }
-      if (m_parser->ParseClayer(clayerFile, m_checkSchema)) {
-        context.clayers[clayerFile] = &m_parser->GetClayers().at(clayerFile);
-      } else {
-        return false;
-      }
+      clayerFiles.push_back(clayerFile);
+    }
+  }
+}
+
+bool ProjMgrWorker::ParseContextLayerFiles(ContextItem& context, const StrVec& clayerFiles) {
+  for (const auto& clayerFile : clayerFiles) {
+    if (m_parser->ParseClayer(clayerFile, m_checkSchema)) {
+      context.clayers[clayerFile] = &m_parser->GetClayers().at(clayerFile);
+    } else {
+      return false;
     }
   }
   return true;
@@ -313,13 +327,8 @@ bool ProjMgrWorker::CollectRequiredPdscFiles(ContextItem& context, const std::st
       auto filteredPackItems = GetFilteredPacks(packItem, packRoot);
       for (const auto& filteredPackItem : filteredPackItems) {
         auto filteredPack = filteredPackItem.pack;
-        XmlItem attributes({
-          {"name",    filteredPack.name},
-          {"vendor",  filteredPack.vendor},
-          {"version", reqVersionRange},
-          });
         // get installed and local pdsc that satisfy the version range requirements
-        auto pdsc = m_kernel->GetEffectivePdscFile(attributes);
+        const auto& pdsc = GetEffectivePdscFile(filteredPack.vendor, filteredPack.name, reqVersionRange);
         const string& pdscFile = pdsc.second;
         if (pdscFile.empty()) {
           if (!bPackFilter) {
@@ -409,9 +418,10 @@ bool ProjMgrWorker::InitializeModel() {
   return m_kernel->Init();
 }
 
-bool ProjMgrWorker::LoadAllRelevantPacks() {
+bool ProjMgrWorker::CollectAllRelevantPdscFiles() {
   // Get required pdsc files
-  std::list<std::string> pdscFiles;
+  std::list<std::string>& pdscFiles = m_relevantPdscFiles;
+  pdscFiles.clear();
   if (m_selectedContexts.empty()) {
     for (const auto& [context,_] : m_contexts) {
       m_selectedContexts.push_back(context);
@@ -455,6 +465,18 @@ bool ProjMgrWorker::LoadAllRelevantPacks() {
       return false;
     }
   }
+  return true;
+}
+
+bool ProjMgrWorker::LoadAllRelevantPacks() {
+  TraceSpan span("ProjMgrWorker::LoadAllRelevantPacks", "projmgr");
+  // Use pdsc files collected in advance for context fingerprints, otherwise collect them now
+  const bool collected = m_relevantPdscCollected ? m_relevantPdscValid : CollectAllRelevantPdscFiles();
+  m_relevantPdscCollected = false;
+  if (!collected) {
+    return false;
+  }
+  std::list<std::string> pdscFiles = m_relevantPdscFiles;
   if (!m_kernel->LoadAndInsertPacks(m_loadedPacks, pdscFiles)) {
     ProjMgrLogger::Get().Error("failed to load and insert packs");
     return CheckRteErrors();
@@ -477,6 +499,7 @@ bool ProjMgrWorker::LoadAllRelevantPacks() {
 }
 
 bool ProjMgrWorker::LoadPacks(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::LoadPacks", "projmgr", context.name);
   if (!InitializeModel()) {
     return false;
   }
@@ -502,6 +525,27 @@ bool ProjMgrWorker::LoadPacks(ContextItem& context) {
   return CheckRteErrors();
 }
 
+bool ProjMgrWorker::GetContextPdscFiles(ContextItem& context, StrSet& pdscFiles) {
+  if (!InitializeModel()) {
+    return false;
+  }
+  if (m_loadedPacks.empty() && !m_relevantPdscCollected) {
+    // collect without loading, the following LoadAllRelevantPacks call takes over the result
+    m_relevantPdscValid = CollectAllRelevantPdscFiles();
+    m_relevantPdscCollected = true;
+  }
+  if (m_relevantPdscCollected && !m_relevantPdscValid) {
+    return false;
+  }
+  const bool allOrLatest = (m_loadPacksPolicy == LoadPacksPolicy::ALL) || (m_loadPacksPolicy == LoadPacksPolicy::LATEST);
+  for (const auto& pdscFile : m_relevantPdscFiles) {
+    if (allOrLatest || (context.pdscFiles.find(pdscFile) != context.pdscFiles.end())) {
+      pdscFiles.insert(pdscFile);
+    }
+  }
+  return true;
+}
+
 bool ProjMgrWorker::CheckMissingPackRequirements(const std::string& contextName)
 {
   bool bRequiredPacksLoaded = true;
@@ -529,7 +573,7 @@ bool ProjMgrWorker::CheckMissingPackRequirements(const std::string& contextName)
   return bRequiredPacksLoaded;
 }
 
-std::vector<PackageItem> ProjMgrWorker::GetFilteredPacks(const PackageItem& packItem, const string& rtePath) const
+std::vector<PackageItem> ProjMgrWorker::GetFilteredPacks(const PackageItem& packItem, const string& rtePath)
 {
   std::vector<PackageItem> filteredPacks;
   auto& pack = packItem.pack;
@@ -537,6 +581,12 @@ std::vector<PackageItem> ProjMgrWorker::GetFilteredPacks(const PackageItem& pack
     filteredPacks.push_back({{ pack.name, pack.vendor, pack.version }});
   }
   else {
+    // installed packs are listed once per filter for all contexts
+    const auto key = make_tuple(rtePath, pack.vendor, pack.name);
+    const auto it = m_filteredPacks.find(key);
+    if (it != m_filteredPacks.end()) {
+      return it->second;
+    }
     error_code ec;
     string dirName, path;
     path = rtePath + '/' + pack.vendor;
@@ -548,10 +598,27 @@ std::vector<PackageItem> ProjMgrWorker::GetFilteredPacks(const PackageItem& pack
         }
       }
     }
+    m_filteredPacks[key] = filteredPacks;
   }
   return filteredPacks;
 }
 
+const pair<string, string>& ProjMgrWorker::GetEffectivePdscFile(const string& vendor, const string& name, const string& versionRange)
+{
+  // contexts mostly share their pack requirements: resolve each of them once
+  const auto key = make_tuple(vendor, name, versionRange);
+  auto it = m_effectivePdscFiles.find(key);
+  if (it == m_effectivePdscFiles.end()) {
+    XmlItem attributes({
+      {"name",    name},
+      {"vendor",  vendor},
+      {"version", versionRange},
+      });
+    it = m_effectivePdscFiles.emplace(key, m_kernel->GetEffectivePdscFile(attributes)).first;
+  }
+  return it->second;
+}
+
 bool ProjMgrWorker::CheckRteErrors(void) {
   const auto& callback = m_kernel->GetCallback();
   const list<string>& rteWarningMessages = callback->GetWarningMessages();
@@ -776,6 +843,7 @@ bool ProjMgrWorker::DiscoverMatchingLayers(ContextItem& context, string clayerSe
 }
 
 bool ProjMgrWorker::ProcessLayerCombinations(ContextItem& context, LayersDiscovering& discover) {
+  TraceSpan span("ProjMgrWorker::ProcessLayerCombinations", "projmgr", context.name);
   // debug message
   string debugMsg;
   if (m_debug) {
@@ -1183,6 +1251,7 @@ ConnectionsValidationResult ProjMgrWorker::ValidateConnections(ConnectionsCollec
 }
 
 bool ProjMgrWorker::ProcessDevice(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessDevice", "projmgr", context.name);
   DeviceItem deviceItem;
   GetDeviceItem(context.device, deviceItem);
   if (context.board.empty() && deviceItem.name.empty()) {
@@ -1197,14 +1266,12 @@ bool ProjMgrWorker::ProcessDevice(ContextItem& context) {
     GetBoardItem(context.board, boardItem);
     // find board
     RteBoard* matchedBoard = nullptr;
-    const RteBoardMap& availableBoards = context.rteFilteredModel->GetBoards();
     list<RteBoard*> partialMatchedBoards;
-    for (const auto& [_, board] : availableBoards) {
-      if (board->GetName() == boardItem.name) {
-        if (boardItem.vendor.empty() || (boardItem.vendor == board->GetVendorString())) {
-          partialMatchedBoards.push_back(board);
-        }
-      }
+    context.rteFilteredModel->FindBoards(boardItem.name, partialMatchedBoards);
+    if (!boardItem.vendor.empty()) {
+      partialMatchedBoards.remove_if([&boardItem](RteBoard* board) {
+        return boardItem.vendor != board->GetVendorString();
+      });
     }
     if (partialMatchedBoards.empty()) {
       ProjMgrLogger::Get().Error("board '" + context.board + "' was not found", context.name);
@@ -1283,13 +1350,11 @@ bool ProjMgrWorker::ProcessDevice(ContextItem& context) {
   RteDeviceItem* matchedDevice = nullptr;
   if (!deviceItem.name.empty()) {
     list<RteDevice*> devices;
-    context.rteFilteredModel->GetDevices(devices, "", "", RteDeviceItem::VARIANT);
+    context.rteFilteredModel->FindDevices(deviceItem.name, devices);
     list<RteDeviceItem*> matchedDevices;
     for (const auto& device : devices) {
-      if (device->GetFullDeviceName() == deviceItem.name) {
-        if (deviceItem.vendor.empty() || (deviceItem.vendor == DeviceVendor::GetCanonicalVendorName(device->GetEffectiveAttribute("Dvendor")))) {
-          matchedDevices.push_back(device);
-        }
+      if (deviceItem.vendor.empty() || (deviceItem.vendor == DeviceVendor::GetCanonicalVendorName(device->GetEffectiveAttribute("Dvendor")))) {
+        matchedDevices.push_back(device);
       }
     }
     for (const auto& item : matchedDevices) {
@@ -1550,7 +1615,28 @@ vector<string> ProjMgrWorker::FindMatchingPackIdsInCbuildPack(const PackItem& ne
   return {matches[0]};
 }
 
+/**
+ * @brief Same as FindMatchingPackIdsInCbuildPack with the resolved items of a cbuild-pack.yml file.
+ * Contexts of a solution share the cbuild-pack.yml file, each needle is matched once per file.
+ *
+ * @param needle The loosely defined pack id
+ * @param cbuildPack The cbuild-pack.yml file
+ * @return The list of matched resolved packIds
+ */
+vector<string> ProjMgrWorker::FindMatchingPackIdsInCbuildPack(const PackItem& needle, const CbuildPackItem& cbuildPack) {
+  if (cbuildPack.path.empty()) {
+    return FindMatchingPackIdsInCbuildPack(needle, cbuildPack.packs);
+  }
+  const auto key = make_pair(cbuildPack.path, needle.pack);
+  auto it = m_cbuildPackMatches.find(key);
+  if (it == m_cbuildPackMatches.end()) {
+    it = m_cbuildPackMatches.emplace(key, FindMatchingPackIdsInCbuildPack(needle, cbuildPack.packs)).first;
+  }
+  return it->second;
+}
+
 bool ProjMgrWorker::ProcessPackages(ContextItem& context, const string& packRoot) {
+  TraceSpan span("ProjMgrWorker::ProcessPackages", "projmgr", context.name);
   vector<PackItem> packRequirements;
 
   // Solution package requirements
@@ -1588,7 +1674,8 @@ void ProjMgrWorker::InsertPackRequirements(const vector<PackItem>& src, vector<P
  */
 bool ProjMgrWorker::AddPackRequirements(ContextItem& context, const vector<PackItem>& packRequirements) {
   const bool ignoreCBuildPack = m_loadPacksPolicy == LoadPacksPolicy::ALL || m_loadPacksPolicy == LoadPacksPolicy::LATEST;
-  const vector<ResolvedPackItem>& resolvedPacks = context.csolution && !ignoreCBuildPack ? context.csolution->cbuildPack.packs : vector<ResolvedPackItem>();
+  const CbuildPackItem noCbuildPack;
+  const CbuildPackItem& cbuildPack = context.csolution && !ignoreCBuildPack ? context.csolution->cbuildPack : noCbuildPack;
  // Filter context specific package requirements
   vector<PackItem> packages;
   for (const auto& packItem : packRequirements) {
@@ -1606,7 +1693,7 @@ bool ProjMgrWorker::AddPackRequirements(ContextItem& context, const vector<PackI
         m_packMetadata[RteUtils::RemoveSuffixByString(packageEntry.pack, "+")] = specifiedMetadata;
       }
       // System wide package
-      vector<string> matchedPackIds = FindMatchingPackIdsInCbuildPack(packageEntry, resolvedPacks);
+      vector<string> matchedPackIds = FindMatchingPackIdsInCbuildPack(packageEntry, cbuildPack);
       if (matchedPackIds.size()) {
         // Cbuild pack content matches, so use it
         for (const auto& resolvedPackId : matchedPackIds) {
@@ -1622,12 +1709,8 @@ bool ProjMgrWorker::AddPackRequirements(ContextItem& context, const vector<PackI
 
         // Resolve version range using installed/local packs
         if (!package.pack.name.empty() && !WildCards::IsWildcardPattern(package.pack.name)) {
-          XmlItem attributes({
-          {"name",    package.pack.name},
-          {"vendor",  package.pack.vendor},
-          {"version", ProjMgrUtils::ConvertToVersionRange(package.pack.version)},
-          });
-          auto pdsc = m_kernel->GetEffectivePdscFile(attributes);
+          const auto& pdsc = GetEffectivePdscFile(package.pack.vendor, package.pack.name,
+            ProjMgrUtils::ConvertToVersionRange(package.pack.version));
           // Only remember the version of the pack if we had it installed or local
           // Will be used when serializing the cbuild-pack.yml file later
           if (!pdsc.first.empty()) {
@@ -1675,7 +1758,7 @@ bool ProjMgrWorker::AddPackRequirements(ContextItem& context, const vector<PackI
 
   // In case there is no packs-list in the project files, reduce the scope to the locked pack list
   if (context.packRequirements.empty()) {
-    for (const auto& resolvedPack : resolvedPacks) {
+    for (const auto& resolvedPack : cbuildPack.packs) {
       PackageItem package;
       ProjMgrUtils::ConvertToPackInfo(resolvedPack.pack, package.pack);
       context.packRequirements.push_back(package);
@@ -1686,6 +1769,7 @@ bool ProjMgrWorker::AddPackRequirements(ContextItem& context, const vector<PackI
 }
 
 bool ProjMgrWorker::ProcessToolchain(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessToolchain", "projmgr", context.name);
   if (context.compiler.empty()) {
     // Use the default compiler if available
     if (context.cdefault && !context.cdefault->compiler.empty()) {
@@ -1739,6 +1823,7 @@ bool ProjMgrWorker::ProcessToolchain(ContextItem& context) {
 }
 
 bool ProjMgrWorker::ProcessComponents(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessComponents", "projmgr", context.name);
   bool error = false;
 
   if (!context.rteActiveTarget) {
@@ -2060,6 +2145,7 @@ bool ProjMgrWorker::GenerateRegionsHeader(ContextItem& context, string& generate
 }
 
 bool ProjMgrWorker::ProcessConfigFiles(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessConfigFiles", "projmgr", context.name);
   if (!context.rteActiveTarget) {
     ProjMgrLogger::Get().Error("missing RTE target", context.name);
     return false;
@@ -2189,6 +2275,7 @@ void ProjMgrWorker::SetDefaultLinkerScript(ContextItem& context) {
 }
 
 bool ProjMgrWorker::ProcessComponentFiles(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessComponentFiles", "projmgr", context.name);
   if (!context.rteActiveTarget) {
     ProjMgrLogger::Get().Error("missing RTE target", context.name);
     return false;
@@ -2433,6 +2520,7 @@ void ProjMgrWorker::ProcessExecutesDependencies() {
 }
 
 bool ProjMgrWorker::ProcessExecutes(ContextItem& context, bool solutionLevel) {
+  TraceSpan span("ProjMgrWorker::ProcessExecutes", "projmgr", context.name);
   const vector<ExecutesItem>& executes = solutionLevel ? m_parser->GetCsolution().executes : context.cproject->executes;
   const string& ref = solutionLevel ? m_parser->GetCsolution().directory : context.cproject->directory;
   const string& outDir = m_outputDir.empty() ? m_parser->GetCsolution().directory : m_outputDir;
@@ -2473,6 +2561,7 @@ bool ProjMgrWorker::IsPreIncludeByTarget(const RteTarget* activeTarget, const st
 }
 
 bool ProjMgrWorker::ValidateContext(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ValidateContext", "projmgr", context.name);
   context.validationResults.clear();
   map<const RteItem*, RteDependencyResult> results;
   context.rteActiveTarget->GetDepsResult(results, context.rteActiveTarget);
@@ -2501,6 +2590,7 @@ bool ProjMgrWorker::ValidateContext(ContextItem& context) {
 }
 
 bool ProjMgrWorker::ProcessGpdsc(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessGpdsc", "projmgr", context.name);
   // Read gpdsc
   const map<string, RteGpdscInfo*>& gpdscInfos = context.rteActiveProject->GetGpdscInfos();
   for (const auto& [file, info] : gpdscInfos) {
@@ -2616,6 +2706,7 @@ bool ProjMgrWorker::ProcessCompilerPrecedence(StringCollection& item, bool accep
 
 
 bool ProjMgrWorker::ProcessPrecedences(ContextItem& context, bool processDevice, bool rerun) {
+  TraceSpan span("ProjMgrWorker::ProcessPrecedences", "projmgr", context.name);
   // Notes: defines, includes and misc are additive. All other keywords overwrite previous settings.
   // The target-type and build-type definitions are additive, but an attempt to
   // redefine an already existing type results in an error.
@@ -3063,6 +3154,7 @@ bool ProjMgrWorker::ProcessProcessorOptions(ContextItem& context) {
 }
 
 bool ProjMgrWorker::ProcessLinkerOptions(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessLinkerOptions", "projmgr", context.name);
   // clear processing lists
   context.linker.scriptList.clear();
   context.linker.regionsList.clear();
@@ -3138,6 +3230,7 @@ bool ProjMgrWorker::ProcessLinkerOptions(ContextItem& context, const LinkerItem&
 }
 
 bool ProjMgrWorker::ProcessSequencesRelatives(ContextItem & context, bool rerun) {
+  TraceSpan span("ProjMgrWorker::ProcessSequencesRelatives", "projmgr", context.name);
   if (!rerun) {
     // directories
     const string ref = m_outputDir.empty() ? context.csolution->directory : m_outputDir;
@@ -3348,6 +3441,7 @@ bool ProjMgrWorker::ProcessSequenceRelative(ContextItem& context, string& item,
 }
 
 bool ProjMgrWorker::ProcessGroups(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessGroups", "projmgr", context.name);
   // Add cproject groups
   for (const auto& group : context.cproject->groups) {
     if (!AddGroup(group, context.groups, context, context.cproject->directory)) {
@@ -3647,6 +3741,7 @@ void ProjMgrWorker::PrintMissingFilters(void) {
 }
 
 bool ProjMgrWorker::ProcessContext(ContextItem& context, bool loadGenFiles, bool resolveDependencies, bool updateRteFiles) {
+  TraceSpan span("ProjMgrWorker::ProcessContext", "projmgr", context.name);
   bool ret = true;
   ret &= LoadPacks(context);
   context.rteActiveProject->SetAttribute("update-rte-files", updateRteFiles ? "1" : "0");
@@ -3789,7 +3884,7 @@ bool ProjMgrWorker::ListPacks(vector<string>&packs, bool bListMissingPacksOnly,
       ProjMgrLogger::Get().Error("no pack was found with filter '" + filter + "'");
       return false;
     }
-    packsVec = filteredPacks;
+    packsVec.swap(filteredPacks);
   }
   packs.assign(packsVec.begin(), packsVec.end());
   return reqOk;
@@ -3802,13 +3897,13 @@ bool ProjMgrWorker::ListBoards(vector<string>& boards, const string& filter) {
     if (!LoadPacks(context)) {
       return false;
     }
-    const RteBoardMap& availableBoards = context.rteFilteredModel->GetBoards();
-    for (const auto& [_, board] : availableBoards) {
-      const string& boardVendor = board->GetVendorString();
-      const string& boardName = board->GetName();
-      const string& boardRevision = board->GetRevision();
-      const string& boardPack = board->GetPackageID(true);
-      boardsSet.insert(boardVendor + "::" + boardName + (!boardRevision.empty() ? ":" + boardRevision : "") + " (" + boardPack + ")");
+    for (const auto& [boardName, boardList] : context.rteFilteredModel->GetBoardNameIndex()) {
+      for (const auto& board : boardList) {
+        const string& boardVendor = board->GetVendorString();
+        const string& boardRevision = board->GetRevision();
+        const string& boardPack = board->GetPackageID(true);
+        boardsSet.insert(boardVendor + "::" + boardName + (!boardRevision.empty() ? ":" + boardRevision : "") + " (" + boardPack + ")");
+      }
     }
   }
   if (boardsSet.empty()) {
@@ -3823,7 +3918,7 @@ bool ProjMgrWorker::ListBoards(vector<string>& boards, const string& filter) {
       ProjMgrLogger::Get().Error("no board was found with filter '" + filter + "'");
       return false;
     }
-    boardsVec = matchedBoards;
+    boardsVec.swap(matchedBoards);
   }
   boards.assign(boardsVec.begin(), boardsVec.end());
   return true;
@@ -3836,19 +3931,18 @@ bool ProjMgrWorker::ListDevices(vector<string>& devices, const string& filter) {
     if (!LoadPacks(context)) {
       return false;
     }
-    list<RteDevice*> filteredModelDevices;
-    context.rteFilteredModel->GetDevices(filteredModelDevices, "", "", RteDeviceItem::VARIANT);
-    for (const auto& deviceItem : filteredModelDevices) {
-      const string& deviceVendor = deviceItem->GetVendorName();
-      const string& deviceName = deviceItem->GetFullDeviceName();
-      const string& devicePack = deviceItem->GetPackageID();
-      if (deviceItem->GetProcessorCount() > 1) {
-        const auto& processors = deviceItem->GetProcessors();
-        for (const auto& processor : processors) {
-          devicesSet.insert(deviceVendor + "::" + deviceName + ":" + processor.first + " (" + devicePack + ")");
+    for (const auto& [deviceName, deviceList] : context.rteFilteredModel->GetDeviceNameIndex()) {
+      for (const auto& deviceItem : deviceList) {
+        const string& deviceVendor = deviceItem->GetVendorName();
+        const string& devicePack = deviceItem->GetPackageID();
+        if (deviceItem->GetProcessorCount() > 1) {
+          const auto& processors = deviceItem->GetProcessors();
+          for (const auto& processor : processors) {
+            devicesSet.insert(deviceVendor + "::" + deviceName + ":" + processor.first + " (" + devicePack + ")");
+          }
+        } else {
+          devicesSet.insert(deviceVendor + "::" + deviceName + " (" + devicePack + ")");
         }
-      } else {
-        devicesSet.insert(deviceVendor + "::" + deviceName + " (" + devicePack + ")");
       }
     }
   }
@@ -3864,7 +3958,7 @@ bool ProjMgrWorker::ListDevices(vector<string>& devices, const string& filter) {
       ProjMgrLogger::Get().Error("no device was found with filter '" + filter + "'");
       return false;
     }
-    devicesVec = matchedDevices;
+    devicesVec.swap(matchedDevices);
   }
   devices.assign(devicesVec.begin(), devicesVec.end());
   return true;
@@ -3873,7 +3967,6 @@ bool ProjMgrWorker::ListDevices(vector<string>& devices, const string& filter) {
 bool ProjMgrWorker::ListComponents(vector<string>& components, const string& filter) {
   RteCondition::SetVerboseFlags(m_verbose ? VERBOSE_DEPENDENCY : m_debug ? VERBOSE_FILTER | VERBOSE_DEPENDENCY : 0);
   RteComponentMap componentMap;
-  set<string> componentIds;
   for (const auto& selectedContext : m_selectedContexts) {
     ContextItem& context = m_contexts[selectedContext];
     if (!LoadPacks(context)) {
@@ -3887,7 +3980,7 @@ bool ProjMgrWorker::ListComponents(vector<string>& components, const string& fil
     if (!SetTargetAttributes(context, context.targetAttributes)) {
       return false;
     }
-    RteComponentMap installedComponents = context.rteActiveTarget->GetFilteredComponents();
+    const RteComponentMap& installedComponents = context.rteActiveTarget->GetFilteredComponents();
     if (installedComponents.empty()) {
       if (!selectedContext.empty()) {
         ProjMgrLogger::Get().Error("no component was found for device '" + context.device + "'");
@@ -3897,13 +3990,15 @@ bool ProjMgrWorker::ListComponents(vector<string>& components, const string& fil
       }
       return false;
     }
-    for (auto& component : installedComponents) {
-      const string& componentId = component.second->GetComponentID(true);
-      componentIds.insert(componentId);
-      componentMap[componentId] = component.second;
+    for (const auto& [_, component] : installedComponents) {
+      componentMap[component->GetComponentID(true)] = component;
     }
   }
-  vector<string> componentIdsVec(componentIds.begin(), componentIds.end());
+  vector<string> componentIdsVec;
+  componentIdsVec.reserve(componentMap.size());
+  for (const auto& [componentId, _] : componentMap) {
+    componentIdsVec.push_back(componentId);
+  }
   if (!filter.empty()) {
     vector<string> filteredIds;
     RteUtils::ApplyFilter(componentIdsVec, RteUtils::SplitStringToSet(filter), filteredIds);
@@ -3911,10 +4006,11 @@ bool ProjMgrWorker::ListComponents(vector<string>& components, const string& fil
       ProjMgrLogger::Get().Error("no component was found with filter '" + filter + "'");
       return false;
     }
-    componentIdsVec = filteredIds;
+    componentIdsVec.swap(filteredIds);
   }
+  components.reserve(components.size() + componentIdsVec.size());
   for (const auto& componentId : componentIdsVec) {
-    components.push_back(componentId + " (" + componentMap[componentId]->GetPackageID() + ")");
+    components.push_back(componentId + " (" + componentMap.at(componentId)->GetPackageID() + ")");
   }
   return true;
 }
@@ -3939,7 +4035,7 @@ bool ProjMgrWorker::ListConfigs(vector<string>& configFiles, const string& filte
       ProjMgrLogger::Get().Error("no unresolved dependency was found with filter '" + filter + "'");
       return false;
     }
-    configVec = filteredConfigs;
+    configVec.swap(filteredConfigs);
   }
   configFiles.assign(configVec.begin(), configVec.end());
   return true;
@@ -3971,7 +4067,7 @@ bool ProjMgrWorker::ListDependencies(vector<string>& dependencies, const string&
       ProjMgrLogger::Get().Error("no unresolved dependency was found with filter '" + filter + "'");
       return false;
     }
-    dependenciesVec = filteredDependencies;
+    dependenciesVec.swap(filteredDependencies);
   }
   dependencies.assign(dependenciesVec.begin(), dependenciesVec.end());
   return true;
@@ -4003,7 +4099,7 @@ bool ProjMgrWorker::ListContexts(vector<string>& contexts, const string& filter,
       ProjMgrLogger::Get().Error("no context was found with filter '" + filter + "'");
       return false;
     }
-    contextsVec = filteredContexts;
+    contextsVec.swap(filteredContexts);
   }
   contexts.assign(contextsVec.begin(), contextsVec.end());
 
@@ -4432,9 +4528,17 @@ bool ProjMgrWorker::ParseContextSelection(
       return false;
     }
 
-    // Parse context layers
+    // Parse context layers, the layer files of all selected contexts are loaded and validated concurrently in advance
+    map<string, StrVec> contextLayerFiles;
+    StrVec clayerFiles;
+    for (const auto& context : m_selectedContexts) {
+      StrVec& layerFiles = contextLayerFiles[context];
+      ResolveContextLayers(m_contexts[context], layerFiles);
+      clayerFiles.insert(clayerFiles.end(), layerFiles.begin(), layerFiles.end());
+    }
+    m_parser->PreloadFiles(clayerFiles, m_checkSchema);
     for (const auto& context : m_selectedContexts) {
-      if (!ParseContextLayers(m_contexts[context])) {
+      if (!ParseContextLayerFiles(m_contexts[context], contextLayerFiles[context])) {
         return false;
       }
     }
@@ -4675,6 +4779,7 @@ StrSet ProjMgrWorker::GetValidSets(ContextItem& context, const string& clayer) {
 }
 
 bool ProjMgrWorker::ProcessOutputFilenames(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessOutputFilenames", "projmgr", context.name);
   // get base name and output types from project and project setups
   context.outputTypes = {};
   context.cproject->output.baseName =
@@ -4987,6 +5092,7 @@ bool ProjMgrWorker::ExecuteExtGenerator(std::string& generatorId) {
 }
 
 bool ProjMgrWorker::ProcessGeneratedLayers(ContextItem& context) {
+  TraceSpan span("ProjMgrWorker::ProcessGeneratedLayers", "projmgr", context.name);
   bool success;
   ClayerItem* cgen = m_extGenerator->GetGeneratorImport(context.name, success);
   if (!success) {
@@ -5188,7 +5294,8 @@ bool ProjMgrWorker::CheckMissingFiles() {
 void ProjMgrWorker::CollectUnusedPacks() {
   for (const auto& contextName : m_selectedContexts) {
     auto& context = m_contexts[contextName];
-    if (context.packRequirements.empty()) {
+    if (context.packRequirements.empty() || !context.rteFilteredModel) {
+      // skip contexts without requirements or not processed in this run
       continue;
     }
     context.unusedPacks.clear();
@@ -11,8 +11,10 @@
 #include "ProjMgrYamlSchemaChecker.h"
 #include "ProjMgrWorker.h"
 #include "ProjMgrUtils.h"
+#include "RteFileWriter.h"
 #include "RteFsUtils.h"
 #include "RteItem.h"
+#include "Tracer.h"
 
 #include <filesystem>
 #include <fstream>
@@ -79,7 +81,7 @@ private:
   ProjMgrYamlCbuildIdx(
     YAML::Node node, const vector<ContextItem*>& processedContexts,
     ProjMgrParser& parser, ProjMgrWorker& worker, const string& directory, const set<string>& failedContexts,
-    const map<string, ExecutesItem>& executes, bool checkSchema);
+    const map<string, ExecutesItem>& executes, const map<string, YAML::Node>& cachedCbuilds, bool checkSchema);
 
   void SetVariablesNode(YAML::Node node, ProjMgrParser& parser, const ContextItem* context, const map<string, map<string, set<const ConnectItem*>>>& layerTypes);
 };
@@ -215,7 +217,7 @@ ProjMgrYamlBase::ProjMgrYamlBase(bool useAbsolutePaths, bool checkSchema) : m_us
 
 ProjMgrYamlCbuildIdx::ProjMgrYamlCbuildIdx(YAML::Node node,
   const vector<ContextItem*>& processedContexts, ProjMgrParser& parser, ProjMgrWorker& worker, const string& directory, const set<string>& failedContexts, 
-  const map<string, ExecutesItem>& executes, bool checkSchema) : ProjMgrYamlBase(false, checkSchema)
+  const map<string, ExecutesItem>& executes, const map<string, YAML::Node>& cachedCbuilds, bool checkSchema) : ProjMgrYamlBase(false, checkSchema)
 {
   error_code ec;
   SetNodeValue(node[YAML_GENERATED_BY], ORIGINAL_FILENAME + string(" version ") + VERSION_STRING);
@@ -309,6 +311,12 @@ ProjMgrYamlCbuildIdx::ProjMgrYamlCbuildIdx(YAML::Node node,
 
   for (const auto& context : processedContexts) {
     if (context) {
+      // reuse entry of a context skipped as unchanged
+      const auto& cached = cachedCbuilds.find(context->name);
+      if (cached != cachedCbuilds.end()) {
+        node[YAML_CBUILDS].push_back(cached->second);
+        continue;
+      }
       error_code ec;
       YAML::Node cbuildNode;
       const string& filename = context->directories.cprj + "/" + context->name + ".cbuild.yml";
@@ -1023,6 +1031,7 @@ bool ProjMgrYamlBase::NeedRebuild(const string& filename, const YAML::Node& newF
 }
 
 bool ProjMgrYamlBase::WriteFile(YAML::Node& rootNode, const std::string& filename, const std::string& context, bool allowUpdate) {
+  TraceSpan span("ProjMgrYamlBase::WriteFile", "projmgr", filename);
   // Compare yaml contents
   if (RteFsUtils::IsDirectory(filename)) {
     ProjMgrLogger::Get().Error("file cannot be written", context, filename);
@@ -1046,18 +1055,13 @@ bool ProjMgrYamlBase::WriteFile(YAML::Node& rootNode, const std::string& filenam
       ProjMgrLogger::Get().Error("destination directory cannot be created", context, filename);
       return false;
     }
-    ofstream fileStream(filename);
-    if (!fileStream) {
-      ProjMgrLogger::Get().Error("file cannot be written", context, filename);
-      return false;
-    }
     YAML::Emitter emitter;
     emitter.SetNullFormat(YAML::EmptyNull);
     emitter << rootNode;
-    fileStream << emitter.c_str();
-    fileStream << endl;
-    fileStream << flush;
-    fileStream.close();
+    if (!RteFileWriter::WriteFile(filename, string(emitter.c_str()) + '\n', true)) {
+      ProjMgrLogger::Get().Error("file cannot be written", context, filename);
+      return false;
+    }
     ProjMgrLogger::Get().Info("file generated successfully", context, filename);
 
     // Check generated file schema
@@ -1073,15 +1077,37 @@ bool ProjMgrYamlBase::WriteFile(YAML::Node& rootNode, const std::string& filenam
 
 bool ProjMgrYamlEmitter::GenerateCbuildIndex(ProjMgrParser& parser, ProjMgrWorker& worker,
   const vector<ContextItem*>& contexts, const string& outputDir, const set<string>& failedContexts,
-  const map<string, ExecutesItem>& executes, bool checkSchema) {
+  const map<string, ExecutesItem>& executes, bool checkSchema, const set<string>& cachedContexts) {
+  TraceSpan span("ProjMgrYamlEmitter::GenerateCbuildIndex", "projmgr");
 
   // generate cbuild-idx.yml
   const string& directory = outputDir.empty() ? parser.GetCsolution().directory : RteFsUtils::AbsolutePath(outputDir).generic_string();
   const string& filename = directory + "/" + parser.GetCsolution().name + ".cbuild-idx.yml";
 
+  // collect previous entries of cached contexts
+  map<string, YAML::Node> cachedCbuilds;
+  if (!cachedContexts.empty() && RteFsUtils::Exists(filename)) {
+    try {
+      const YAML::Node& previous = YAML::LoadFile(filename);
+      for (const auto& cbuildNode : previous[YAML_BUILD_IDX][YAML_CBUILDS]) {
+        const string& cbuild = RteUtils::ExtractFileName(cbuildNode[YAML_CBUILD].as<string>(""));
+        const string& contextName = RteUtils::RemoveSuffixByString(cbuild, ".cbuild.yml");
+        if (cachedContexts.find(contextName) != cachedContexts.end()) {
+          YAML::Node cachedNode = YAML::Clone(cbuildNode);
+          cachedNode.remove(YAML_REBUILD);
+          cachedCbuilds[contextName] = cachedNode;
+        }
+      }
+    }
+    catch (YAML::Exception&) {
+      ProjMgrLogger::Get().Error("file cannot be read", "", filename);
+      return false;
+    }
+  }
+
   YAML::Node rootNode;
   ProjMgrYamlCbuildIdx cbuild(
-    rootNode[YAML_BUILD_IDX], contexts, parser, worker, directory, failedContexts, executes, checkSchema);
+    rootNode[YAML_BUILD_IDX], contexts, parser, worker, directory, failedContexts, executes, cachedCbuilds, checkSchema);
 
   // set rebuild flags
   if (cbuild.NeedRebuild(filename, rootNode)) {
@@ -1101,6 +1127,7 @@ bool ProjMgrYamlEmitter::GenerateCbuildIndex(ProjMgrParser& parser, ProjMgrWorke
 bool ProjMgrYamlEmitter::GenerateCbuild(ContextItem* context, bool checkSchema,
   const string& generatorId, const string& generatorPack, bool ignoreRteFileMissing)
 {
+  TraceSpan span("ProjMgrYamlEmitter::GenerateCbuild", "projmgr", context->name);
   // generate cbuild.yml or cbuild-gen.yml for each context
   context->directories.cbuild = context->directories.cprj;
   string tmpDir = context->directories.intdir;
@@ -1131,6 +1158,7 @@ bool ProjMgrYamlEmitter::GenerateCbuild(ContextItem* context, bool checkSchema,
 bool ProjMgrYamlEmitter::GenerateCbuildSet(const std::vector<string> selectedContexts,
   const string& selectedCompiler, const string& cbuildSetFile, bool checkSchema, bool ignoreRteFileMissing)
 {
+  TraceSpan span("ProjMgrYamlEmitter::GenerateCbuildSet", "projmgr");
   YAML::Node rootNode;
   ProjMgrYamlCbuild cbuild(rootNode[YAML_CBUILD_SET], selectedContexts, selectedCompiler, checkSchema, ignoreRteFileMissing);
 
@@ -1172,6 +1200,7 @@ ProjMgrYamlCbuild::ProjMgrYamlCbuild(YAML::Node node, const vector<ContextItem*>
 
 bool ProjMgrYamlEmitter::GenerateCbuildGenIndex(ProjMgrParser& parser, const vector<ContextItem*> siblings,
   const string& type, const string& output, const string& gendir, bool checkSchema) {
+  TraceSpan span("ProjMgrYamlEmitter::GenerateCbuildGenIndex", "projmgr");
   // generate cbuild-gen-idx.yml as input for external generator
   RteFsUtils::CreateDirectories(output);
   const string& filename = output + "/" + parser.GetCsolution().name + ".cbuild-gen-idx.yml";
@@ -1182,6 +1211,7 @@ bool ProjMgrYamlEmitter::GenerateCbuildGenIndex(ProjMgrParser& parser, const vec
 }
 
 bool ProjMgrYamlEmitter::GenerateCbuildPack(ProjMgrParser& parser, const vector<ContextItem*> contexts, bool keepExistingPackContent, bool cbuildPackFrozen, bool checkSchema) {
+  TraceSpan span("ProjMgrYamlEmitter::GenerateCbuildPack", "projmgr");
   // generate cbuild-pack.yml
   const string& filename = parser.GetCsolution().directory + "/" + parser.GetCsolution().name + ".cbuild-pack.yml";
 
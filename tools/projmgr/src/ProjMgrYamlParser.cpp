@@ -9,13 +9,22 @@
 #include "ProjMgrUtils.h"
 #include "ProjMgrYamlSchemaChecker.h"
 
+#include "JobPool.h"
 #include "RteFsUtils.h"
 #include <regex>
 #include <string>
 
 using namespace std;
 
-ProjMgrYamlParser::ProjMgrYamlParser(void) {
+ProjMgrYamlParser::ProjMgrYamlParser(void) :
+  m_documents(nullptr)
+{
+  // Reserved
+}
+
+ProjMgrYamlParser::ProjMgrYamlParser(map<string, shared_ptr<YamlDocument>>& documents) :
+  m_documents(&documents)
+{
   // Reserved
 }
 
@@ -26,15 +35,14 @@ ProjMgrYamlParser::~ProjMgrYamlParser(void) {
 bool ProjMgrYamlParser::ParseCdefault(const string& input,
   CdefaultItem& cdefault, bool checkSchema) {
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(input)) {
+    // Load file and validate its schema
+    YAML::Node root;
+    if (!LoadFile(input, checkSchema, root)) {
       return false;
     }
 
     cdefault.path = RteFsUtils::MakePathCanonical(input);
 
-    const YAML::Node& root = YAML::LoadFile(input);
     if (!ValidateCdefault(input, root)) {
       return false;
     }
@@ -68,9 +76,9 @@ bool ProjMgrYamlParser::ParseCsolution(const string& input,
   }
 
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(input)) {
+    // Load file and validate its schema
+    YAML::Node root;
+    if (!LoadFile(input, checkSchema, root)) {
       return false;
     }
 
@@ -78,7 +86,6 @@ bool ProjMgrYamlParser::ParseCsolution(const string& input,
     csolution.directory = RteFsUtils::ParentPath(csolution.path);
     csolution.name = fs::path(input).stem().stem().generic_string();
 
-    const YAML::Node& root = YAML::LoadFile(input);
     if (!ValidateCsolution(input, root)) {
       return false;
     }
@@ -122,9 +129,9 @@ bool ProjMgrYamlParser::ParseCsolution(const string& input,
 bool ProjMgrYamlParser::ParseCbuildPack(const string& input,
   CbuildPackItem& cbuildPack, bool checkSchema) {
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(input)) {
+    // Load file and validate its schema
+    YAML::Node root;
+    if (!LoadFile(input, checkSchema, root)) {
       return false;
     }
 
@@ -132,7 +139,6 @@ bool ProjMgrYamlParser::ParseCbuildPack(const string& input,
     cbuildPack.directory = RteFsUtils::ParentPath(cbuildPack.path);
     cbuildPack.name = fs::path(input).stem().stem().stem().generic_string();
 
-    const YAML::Node& root = YAML::LoadFile(input);
     if (!ValidateCbuildPack(input, root)) {
       return false;
     }
@@ -153,13 +159,12 @@ bool ProjMgrYamlParser::ParseCproject(const string& input,
   bool single, bool checkSchema) {
   CprojectItem cproject;
   try {
-    // Validate file schema
-    if (checkSchema &&
-      !ProjMgrYamlSchemaChecker().Validate(input)) {
+    // Load file and validate its schema
+    YAML::Node root;
+    if (!LoadFile(input, checkSchema, root)) {
       return false;
     }
 
-    const YAML::Node& root = YAML::LoadFile(input);
     if (!ValidateCproject(input, root)) {
       return false;
     }
@@ -221,14 +226,12 @@ bool ProjMgrYamlParser::ParseClayer(const string& input,
   }
   ClayerItem clayer;
   try {
-    // Validate file schema
-    if (checkSchema) {
-      if (!ProjMgrYamlSchemaChecker().Validate(input)) {
-        return false;
-      }
+    // Load file and validate its schema
+    YAML::Node root;
+    if (!LoadFile(input, checkSchema, root)) {
+      return false;
     }
 
-    const YAML::Node& root = YAML::LoadFile(input);
     const bool cgen = fs::path(input).stem().extension().generic_string() == ".cgen";
     if (!cgen && !ValidateClayer(input, root)) {
       return false;
@@ -275,13 +278,13 @@ bool ProjMgrYamlParser::ParseClayer(const string& input,
 }
 
 bool ProjMgrYamlParser::ParseCbuildSet(const string& input, CbuildSetItem& cbuildSet, bool checkSchema) {
-  // Validate file schema
-  if (!ProjMgrYamlSchemaChecker().Validate(input)) {
+  // Load file and validate its schema
+  YAML::Node root;
+  if (!LoadFile(input, true, root)) {
     return false;
   }
 
   try {
-    const YAML::Node& root = YAML::LoadFile(input);
     if (checkSchema && !ValidateCbuildSet(input, root)) {
       return false;
     }
@@ -305,6 +308,95 @@ bool ProjMgrYamlParser::ParseCbuildSet(const string& input, CbuildSetItem& cbuil
   return true;
 }
 
+void ProjMgrYamlParser::PreloadFiles(const vector<string>& files, bool checkSchema) {
+  if (!m_documents) {
+    return;
+  }
+  // schemas are searched upfront, loading and validating runs concurrently and does not log
+  vector<pair<string, shared_ptr<YamlDocument>>> jobs;
+  for (const auto& file : set<string>(files.begin(), files.end())) {
+    if (m_documents->find(file) != m_documents->end()) {
+      continue;
+    }
+    auto document = make_shared<YamlDocument>();
+    document->checkSchema = checkSchema;
+    if (checkSchema) {
+      document->schemaFile = ProjMgrYamlSchemaChecker().FindSchema(file);
+    }
+    jobs.push_back({ file, document });
+  }
+  JobPool::Run(jobs.size(), [&jobs](size_t i) {
+    ReadDocument(jobs[i].first, *jobs[i].second);
+  });
+  for (const auto& [file, document] : jobs) {
+    (*m_documents)[file] = document;
+  }
+}
+
+bool ProjMgrYamlParser::LoadFile(const string& input, bool checkSchema, YAML::Node& root) {
+  // take over document loaded in advance, otherwise load it now
+  shared_ptr<YamlDocument> document;
+  if (m_documents) {
+    const auto& it = m_documents->find(input);
+    if ((it != m_documents->end()) && (it->second->checkSchema == checkSchema)) {
+      document = it->second;
+      m_documents->erase(it);
+    }
+  }
+  if (!document) {
+    document = make_shared<YamlDocument>();
+    document->checkSchema = checkSchema;
+    if (checkSchema && RteFsUtils::Exists(input)) {
+      document->schemaFile = ProjMgrYamlSchemaChecker().FindSchema(input);
+    }
+    ReadDocument(input, *document);
+  }
+  for (const auto& err : document->errors) {
+    if (err.m_severity == RteError::SevWARNING) {
+      ProjMgrLogger::Get().Warn(err.m_msg, "", err.m_file, err.m_line, err.m_col);
+    } else {
+      ProjMgrLogger::Get().Error(err.m_msg, "", err.m_file, err.m_line, err.m_col);
+    }
+  }
+  root = document->root;
+  return document->valid;
+}
+
+void ProjMgrYamlParser::ReadDocument(const string& input, YamlDocument& document) {
+  // the file is loaded once, the same node tree is validated and parsed
+  if (document.checkSchema && !RteFsUtils::Exists(input)) {
+    document.errors.push_back(RteError(input, "file doesn't exist"));
+    return;
+  }
+  try {
+    document.root = YAML::LoadFile(input);
+  }
+  catch (YAML::Exception& e) {
+    document.errors.push_back(RteError(input, document.checkSchema ?
+      "schema check failed, verify syntax" : e.msg, e.mark.line + 1, e.mark.column + 1));
+    return;
+  }
+  if (!document.checkSchema) {
+    document.valid = true;
+    return;
+  }
+  if (document.schemaFile.empty()) {
+    document.errors.push_back(RteError(RteError::SevWARNING, input, "yaml schemas were not found, file cannot be validated"));
+    document.valid = true;
+    return;
+  }
+  ProjMgrYamlSchemaChecker schemaChecker;
+  try {
+    document.valid = schemaChecker.ValidateData(document.root, input, document.schemaFile);
+  }
+  catch (exception& e) {
+    document.errors.push_back(RteError(input, e.what()));
+    return;
+  }
+  const auto& errors = schemaChecker.GetErrors();
+  document.errors.insert(document.errors.end(), errors.begin(), errors.end());
+}
+
 // EnsurePortability checks the presence of backslash, case inconsistency and absolute path
 // It clears the string 'value' when it is an absolute path
 void ProjMgrYamlParser::EnsurePortability(const string& file, const YAML::Mark& mark, const string& key, string& value) {
@@ -6572,3 +6572,64 @@ TEST_F(ProjMgrUnitTests, InvalidContextSet) {
   auto errStr = streamRedirect.GetErrorString();
   EXPECT_NE(string::npos, errStr.find("unknown selected context(s):\n  unknown1.debug+target\n  unknown2.release+target"));
 }
+
+TEST_F(ProjMgrUnitTests, ConvertUnchangedContexts) {
+  StdStreamRedirect streamRedirect;
+  // work on a copy of the inputs: the test modifies a layer
+  const string& inputDir = testoutput_folder + "/ContextCache/input";
+  const string& outputDir = testoutput_folder + "/ContextCache/output";
+  RteFsUtils::RemoveDir(testoutput_folder + "/ContextCache");
+  ASSERT_TRUE(RteFsUtils::CopyTree(testinput_folder + "/TestLayers/variables", inputDir + "/variables"));
+  for (const auto& file : { "variables.csolution.yml", "variables.cproject.yml" }) {
+    ASSERT_TRUE(RteFsUtils::CopyCheckFile(testinput_folder + "/TestLayers/" + file, inputDir + "/" + file, false));
+  }
+  const string& csolution = inputDir + "/variables.csolution.yml";
+  const string& clayer = inputDir + "/variables/target1.clayer.yml";
+  char* argv[7];
+  argv[1] = (char*)"convert";
+  argv[2] = (char*)csolution.c_str();
+  argv[3] = (char*)"-o";
+  argv[4] = (char*)outputDir.c_str();
+  argv[5] = (char*)"-v";
+  argv[6] = (char*)"--force";
+
+  auto countSkipped = [&]() {
+    const string& outStr = streamRedirect.GetOutString();
+    int count = 0;
+    for (size_t pos = outStr.find("processing skipped"); pos != string::npos; pos = outStr.find("processing skipped", pos + 1)) {
+      count++;
+    }
+    streamRedirect.ClearStringStreams();
+    return count;
+  };
+
+  // first run converts all contexts and records their fingerprints
+  EXPECT_EQ(0, RunProjMgr(6, argv, m_envp));
+  EXPECT_EQ(0, countSkipped());
+  EXPECT_TRUE(RteFsUtils::Exists(outputDir + "/variables.cbuild-cache.yml"));
+  string cbuildIdx, cachedCbuildIdx;
+  EXPECT_TRUE(RteFsUtils::ReadFile(outputDir + "/variables.cbuild-idx.yml", cbuildIdx));
+
+  // unchanged contexts reuse their outputs
+  EXPECT_EQ(0, RunProjMgr(6, argv, m_envp));
+  EXPECT_EQ(4, countSkipped());
+  EXPECT_TRUE(RteFsUtils::ReadFile(outputDir + "/variables.cbuild-idx.yml", cachedCbuildIdx));
+  EXPECT_EQ(cbuildIdx, cachedCbuildIdx);
+
+  // modified layer is converted for the contexts using it only
+  ofstream clayerFile(clayer, ios::app);
+  clayerFile << "# modified" << endl;
+  clayerFile.close();
+  EXPECT_EQ(0, RunProjMgr(6, argv, m_envp));
+  EXPECT_EQ(2, countSkipped());
+
+  // removed output is generated again
+  RteFsUtils::RemoveFile(outputDir + "/variables.BuildType2+TargetType2.cbuild.yml");
+  EXPECT_EQ(0, RunProjMgr(6, argv, m_envp));
+  EXPECT_EQ(3, countSkipped());
+  EXPECT_TRUE(RteFsUtils::Exists(outputDir + "/variables.BuildType2+TargetType2.cbuild.yml"));
+
+  // forced run converts all contexts
+  EXPECT_EQ(0, RunProjMgr(7, argv, m_envp));
+  EXPECT_EQ(0, countSkipped());
+}
@@ -1729,6 +1729,43 @@ TEST_F(ProjMgrWorkerUnitTests, FindMatchingPacksInCbuildPack) {
   EXPECT_EQ(matches[1], pack6.pack);
 }
 
+TEST_F(ProjMgrWorkerUnitTests, AddPackRequirementsFromCbuildPack) {
+  CsolutionItem csolution;
+  csolution.cbuildPack.path = testinput_folder + "/TestSolution/first.cbuild-pack.yml";
+  csolution.cbuildPack.packs = {{"ARM::RteTest_DFP@0.1.0", {"ARM::RteTest_DFP"}}, {"ARM::RteTest@0.1.0", {"ARM::RteTest"}}};
+  const vector<PackItem> packRequirements = {{"ARM::RteTest_DFP"}, {"ARM"}};
+
+  // Contexts sharing the cbuild-pack.yml file resolve the same packs, the vendor filter is added last
+  for (const char* name : { "first1", "first2" }) {
+    ContextItem context;
+    context.name = name;
+    context.csolution = &csolution;
+    EXPECT_TRUE(AddPackRequirements(context, packRequirements));
+    ASSERT_EQ(4, context.packRequirements.size());
+    EXPECT_EQ("RteTest_DFP", context.packRequirements[0].pack.name);
+    EXPECT_EQ("0.1.0", context.packRequirements[0].pack.version);
+    EXPECT_EQ("RteTest_DFP", context.packRequirements[1].pack.name);
+    EXPECT_EQ("RteTest", context.packRequirements[2].pack.name);
+    EXPECT_EQ("0.1.0", context.packRequirements[2].pack.version);
+    EXPECT_EQ("ARM", context.packRequirements[3].pack.vendor);
+    EXPECT_TRUE(context.packRequirements[3].pack.name.empty());
+  }
+
+  // Another cbuild-pack.yml file loaded into the same solution item resolves its own packs
+  csolution.cbuildPack.path = testinput_folder + "/TestSolution/second.cbuild-pack.yml";
+  csolution.cbuildPack.packs = {{"ARM::RteTest_DFP@0.2.0", {"ARM::RteTest_DFP"}}};
+  ContextItem context;
+  context.name = "second";
+  context.csolution = &csolution;
+  EXPECT_TRUE(AddPackRequirements(context, packRequirements));
+  ASSERT_EQ(3, context.packRequirements.size());
+  EXPECT_EQ("RteTest_DFP", context.packRequirements[0].pack.name);
+  EXPECT_EQ("0.2.0", context.packRequirements[0].pack.version);
+  EXPECT_EQ("RteTest_DFP", context.packRequirements[1].pack.name);
+  EXPECT_EQ("0.2.0", context.packRequirements[1].pack.version);
+  EXPECT_EQ("ARM", context.packRequirements[2].pack.vendor);
+}
+
 TEST_F(ProjMgrWorkerUnitTests, PrintContextErrors) {
   StdStreamRedirect streamRedirect;
   string context1("project.build+target1"), context2("project.build+target2");
@@ -42,3 +42,31 @@ TEST_F(ProjMgrYamlParserUnitTests, ValidateCbuildSet) {
   invalidRoot["processor"] = "invalid";
   EXPECT_FALSE(ValidateCbuildSet(cbuildSetFile, invalidRoot));
 }
+
+TEST_F(ProjMgrYamlParserUnitTests, PreloadFiles) {
+  const string& validFile = testinput_folder + "/TestProject/test.cproject.yml";
+  const string& invalidFile = testinput_folder + "/TestProject/test_schema_validation_failed.cproject.yml";
+
+  // reference parsing without loading files in advance
+  StdStreamRedirect streamRedirect;
+  ProjMgrParser reference;
+  EXPECT_TRUE(reference.ParseCproject(validFile, true));
+  EXPECT_FALSE(reference.ParseCproject(invalidFile, true));
+  const string& referenceErrors = streamRedirect.GetErrorString();
+  EXPECT_FALSE(referenceErrors.empty());
+
+  // errors of preloaded files are reported when parsing them
+  streamRedirect.ClearStringStreams();
+  ProjMgrParser parser;
+  parser.PreloadFiles({ validFile, invalidFile, validFile }, true);
+  EXPECT_TRUE(streamRedirect.GetErrorString().empty());
+  EXPECT_TRUE(parser.ParseCproject(validFile, true));
+  EXPECT_FALSE(parser.ParseCproject(invalidFile, true));
+  EXPECT_EQ(referenceErrors, streamRedirect.GetErrorString());
+
+  const CprojectItem& cproject = parser.GetCprojects().at(validFile);
+  const CprojectItem& referenceCproject = reference.GetCprojects().at(validFile);
+  EXPECT_EQ(referenceCproject.name, cproject.name);
+  EXPECT_EQ(referenceCproject.components.size(), cproject.components.size());
+  EXPECT_EQ(referenceCproject.groups.size(), cproject.groups.size());
+}
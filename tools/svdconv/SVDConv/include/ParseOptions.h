@@ -51,6 +51,10 @@ protected:
   bool SetShowMissingEnums();
   bool SetCreateFolder();
   bool SetSuppressPath();
+  bool SetBatchInput(const std::string& batchInput);
+  bool SetJobs(const std::string& jobs);
+  bool SetSummaryFile(const std::string& summaryFile);
+  bool SetTraceFile(const std::string& traceFile);
 
 
   bool ParseOptGenerate(const std::string& opt);
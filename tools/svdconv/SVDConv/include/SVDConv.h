@@ -11,6 +11,8 @@
 
 #include <string>
 #include <set>
+#include <list>
+#include <vector>
 
 
 typedef enum SvdErr_t
@@ -24,6 +26,30 @@ typedef enum SvdErr_t
 } SVD_ERR;
 
 
+/**
+ * @brief processing phase of one SVD file
+*/
+struct SvdConvPhase {
+  std::string name;
+  uint32_t    time;      // ms
+  bool        success;
+};
+
+/**
+ * @brief one SVD file of a batch and its results
+*/
+struct SvdConvJob {
+  std::string svdFile;
+  std::string outDir;
+  std::string logFile;
+  SVD_ERR     result = SVD_ERR_SUCCESS;
+  int         errCnt = 0;
+  int         warnCnt = 0;
+  uint32_t    time = 0;   // ms
+  std::list<SvdConvPhase> phases;
+};
+
+
 class SvdConv {
 public:
   SvdConv();
@@ -31,12 +57,19 @@ public:
 
   int Check(int argc, const char* argv[], const char* envp[]);
   SVD_ERR CheckSvdFile();
+  SVD_ERR CheckSvdFile(SvdOptions& options, SvdConvJob& job);
+  SVD_ERR CheckSvdBatch();
 
 protected:
   bool InitMessageTable();
+  bool CollectBatchJobs(std::vector<SvdConvJob>& jobs);
+  void RunBatchJob(SvdConvJob& job);
+  bool WriteBatchSummary(const std::vector<SvdConvJob>& jobs, const std::string& fileName);
 
 private:
   SvdOptions m_svdOptions;
+  int m_batchErrCnt;
+  int m_batchWarnCnt;
 
   static const MsgTable msgTable;
   static const MsgTableStrict msgStrictTable;
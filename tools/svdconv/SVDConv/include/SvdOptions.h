@@ -43,11 +43,23 @@ public:
   const std::string& GetProgramName();
   const std::string& GetLogPath();
 
+  bool SetBatchInput(const std::string& batchInput);
+  const std::string& GetBatchInput() const            { return m_batchInput;          }
+  bool IsBatchMode() const                            { return !m_batchInput.empty(); }
+  bool SetJobs(uint32_t jobs);
+  uint32_t GetJobs() const                            { return m_jobs;                }
+  bool SetSummaryFile(const std::string& summaryFile);
+  const std::string& GetSummaryFile() const           { return m_summaryFile;         }
+  bool SetTraceFile(const std::string& traceFile);
+  const std::string& GetTraceFile() const             { return m_traceFile;           }
+  void ClearInputOutput();
+
 
   void SetGenerateHeader        (bool bGenerateHeader           = true)   { m_bGenerateHeader         = bGenerateHeader         ; }
   void SetGeneratePartition     (bool bGeneratePartition        = true)   { m_bGeneratePartition      = bGeneratePartition      ; }
   void SetGenerateSfd           (bool bGenerateSfd              = true)   { m_bGenerateSfd            = bGenerateSfd            ; }
   void SetGenerateSfr           (bool bGenerateSfr              = true)   { m_bGenerateSfr            = bGenerateSfr            ; }
+  void SetGenerateRegDb         (bool bGenerateRegDb            = true)   { m_bGenerateRegDb          = bGenerateRegDb          ; }
   void SetCreateFields          (bool bCreateFields             = true)   { n_bCreateFields           = bCreateFields           ; }
   void SetCreateFieldsAnsiC     (bool bCreateFieldsAnsiC        = true)   { n_bCreateFieldsAnsiC      = bCreateFieldsAnsiC      ; }
   void SetCreateMacros          (bool bCreateMacros             = true)   { m_bCreateMacros           = bCreateMacros           ; }
@@ -69,6 +81,7 @@ public:
   bool IsGeneratePartition      () const  { return m_bGeneratePartition      ; }
   bool IsGenerateSfd            () const  { return m_bGenerateSfd            ; }
   bool IsGenerateSfr            () const  { return m_bGenerateSfr            ; }
+  bool IsGenerateRegDb          () const  { return m_bGenerateRegDb          ; }
   bool IsCreateFields           () const  { return n_bCreateFields           ; }
   bool IsCreateFieldsAnsiC      () const  { return n_bCreateFieldsAnsiC      ; }
   bool IsCreateMacros           () const  { return m_bCreateMacros           ; }
@@ -96,6 +109,7 @@ private:
   bool m_bGeneratePartition = false;
   bool m_bGenerateSfd = false;
   bool m_bGenerateSfr = false;
+  bool m_bGenerateRegDb = false;
   bool n_bCreateFields = false;
   bool n_bCreateFieldsAnsiC = false;
   bool m_bCreateMacros = false;
@@ -114,6 +128,10 @@ private:
   std::string m_programName;
   std::string m_outputDir;
   std::string m_outfileOverride;
+  std::string m_batchInput;
+  std::string m_summaryFile;
+  std::string m_traceFile;
+  uint32_t    m_jobs = 0;
 };
 
 #endif // PACKOPTIONS_H
@@ -137,6 +137,9 @@ bool ParseOptions::ParseOptGenerate(const string& opt)
     m_options.SetGenerateSfd();
     m_options.SetGenerateSfr();
   }
+  else if(opt == "regdb") {
+    m_options.SetGenerateRegDb();
+  }
   else if(opt == "peripheralMap") {
     m_options.SetGenerateMapPeripheral();
   }
@@ -264,6 +267,55 @@ bool ParseOptions::SetSuppressPath()
   return true;
 }
 
+/**
+ * @brief option "batch"
+ * @param batchInput list file or wildcard pattern of SVD files
+ * @return passed / failed
+*/
+bool ParseOptions::SetBatchInput(const string& batchInput)
+{
+  return m_options.SetBatchInput(batchInput);
+}
+
+/**
+ * @brief option "j,jobs"
+ * @param jobs number of parallel jobs, checking batch files or constructing peripherals
+ * @return passed / failed
+*/
+bool ParseOptions::SetJobs(const string& jobs)
+{
+  uint32_t num = 0;
+  try {
+    num = stoul(jobs);
+  }
+  catch(const exception&) {
+    LogMsg("M120");
+    return false;
+  }
+
+  return m_options.SetJobs(num);
+}
+
+/**
+ * @brief option "summary"
+ * @param summaryFile batch summary file name
+ * @return passed / failed
+*/
+bool ParseOptions::SetSummaryFile(const string& summaryFile)
+{
+  return m_options.SetSummaryFile(summaryFile);
+}
+
+/**
+ * @brief option "trace"
+ * @param traceFile trace event file name
+ * @return passed / failed
+*/
+bool ParseOptions::SetTraceFile(const string& traceFile)
+{
+  return m_options.SetTraceFile(traceFile);
+}
+
 /**
  * @brief parses all options
  * @param argc command line
@@ -406,7 +458,7 @@ ParseOptions::Result ParseOptions::ParseOpts(int argc, const char* argv[])
     options.add_options()
       ( "input"                 , "Input PDSC"                                                , cxxopts::value<std::string>()->default_value(""))
       ( "o,outdir"              , "Output directory"                                          , cxxopts::value<string>() )
-      ( "generate"              , "Generate header, partition or SDF/SFR file"                , cxxopts::value<std::vector<std::string>>() )
+      ( "generate"              , "Generate header, partition, SDF/SFR or register database" , cxxopts::value<std::vector<std::string>>() )
       ( "fields"                , "Specify field generation: enum/macro/struct/struct-ansic"  , cxxopts::value<std::vector<std::string>>() )
       ( "suppress-path"         , "Suppress inFile path on check output"                      , cxxopts::value<bool>()->default_value("false") )
       ( "create-folder"         , "Always create required folders"                            , cxxopts::value<bool>()->default_value("false") )
@@ -423,6 +475,10 @@ ParseOptions::Result ParseOptions::ParseOpts(int argc, const char* argv[])
       ( "quiet"                 , "No output on console"                                      , cxxopts::value<bool>()->default_value("false") )
       ( "debug"                 , "Add information to generated files: struct/header/sfd/break" , cxxopts::value<std::vector<std::string>>() )
       ( "n"                     , "SFD Output file name"                                      , cxxopts::value<string>() )
+      ( "batch"                 , "Convert all SVD files of a list file or wildcard pattern"  , cxxopts::value<string>() )
+      ( "j,jobs"                , "Number of parallel jobs: batch files or peripherals"       , cxxopts::value<string>() )
+      ( "summary"               , "Batch summary file (JSON)"                                 , cxxopts::value<string>() )
+      ( "trace"                 , "Write Chrome trace event file (JSON) of processing phases" , cxxopts::value<string>() )
       ( "V,version"               , "Show program version")
       ( "h,help"                , "Print usage")
       ;
@@ -507,6 +563,26 @@ ParseOptions::Result ParseOptions::ParseOpts(int argc, const char* argv[])
         bOk = false;
       }
     }
+    if(parseResult.count("batch")) {
+      if(!SetBatchInput(parseResult["batch"].as<string>())) {
+        bOk = false;
+      }
+    }
+    if(parseResult.count("jobs")) {
+      if(!SetJobs(parseResult["jobs"].as<string>())) {
+        bOk = false;
+      }
+    }
+    if(parseResult.count("summary")) {
+      if(!SetSummaryFile(parseResult["summary"].as<string>())) {
+        bOk = false;
+      }
+    }
+    if(parseResult.count("trace")) {
+      if(!SetTraceFile(parseResult["trace"].as<string>())) {
+        bOk = false;
+      }
+    }
     if(parseResult.count("outdir")) {
       if(!SetOutputDirectory(parseResult["outdir"].as<string>())) {
         bOk = false;
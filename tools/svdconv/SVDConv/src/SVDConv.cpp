@@ -9,24 +9,39 @@
 #include "ErrLog.h"
 #include "ErrOutputterSaveToStdoutOrFile.h"
 #include "SvdModel.h"
+#include "SvdModelBuilder.h"
 #include "SvdDevice.h"
 #include "SvdGenerator.h"
 #include "RteFsUtils.h"
+#include "RteFileWriter.h"
 #include "CrossPlatformUtils.h"
 #include "ProductInfo.h"
 #include "ParseOptions.h"
+#include "RteUtils.h"
+#include "JobPool.h"
+#include "Tracer.h"
 
 #include <ostream>
+#include <fstream>
+#include <sstream>
 #include <string>
 #include <set>
 #include <list>
 #include <map>
+#include <algorithm>
+#include <chrono>
 #include <csignal>
 
 using namespace std;
 
-SvdModel* m_svdModel;
 
+/**
+ * @brief wall clock in ms, process CPU time would add up the time of concurrent batch jobs
+*/
+static uint32_t ClockInMsec()
+{
+  return (uint32_t)chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
 
 /**
  * @brief exception handler for other than C++/STL exceptions
@@ -75,7 +90,9 @@ void Sighandler(int signum)
 /**
  * @brief class SvdConv constructor
 */
-SvdConv::SvdConv()
+SvdConv::SvdConv() :
+  m_batchErrCnt(0),
+  m_batchWarnCnt(0)
 {
   ErrLog::Get()->SetOutputter(new ErrOutputterSaveToStdoutOrFile());
   InitMessageTable();
@@ -149,7 +166,16 @@ int SvdConv::Check(int argc, const char* argv[], const char* envp[])
     ErrLog::Get()->CheckSuppressMessages();
     LogMsg("M061");  // Checking Package Description
 
-    CheckSvdFile();
+    TraceFile traceFile(m_svdOptions.GetTraceFile(), [](const string& fileName) { LogMsg("M130", NAME(fileName)); });
+
+    if(m_svdOptions.IsBatchMode()) {
+      CheckSvdBatch();
+    }
+    else {
+      CheckSvdFile();
+    }
+
+    traceFile.Stop();
   }
   catch(std::exception& e) {
     string criticalErrMsg = "STL exception occurred: ";
@@ -167,8 +193,8 @@ int SvdConv::Check(int argc, const char* argv[], const char* envp[])
     return 2;
   }
 
-  int errCnt  = ErrLog::Get()->GetErrCnt();
-  int warnCnt = ErrLog::Get()->GetWarnCnt();
+  int errCnt  = ErrLog::Get()->GetErrCnt() + m_batchErrCnt;
+  int warnCnt = ErrLog::Get()->GetWarnCnt() + m_batchWarnCnt;
 
   LogMsg("M016");
   LogMsg("M022", ERR(errCnt), WARN(warnCnt));
@@ -189,16 +215,37 @@ int SvdConv::Check(int argc, const char* argv[], const char* envp[])
 
 SVD_ERR SvdConv::CheckSvdFile()
 {
-  uint32_t tAll = CrossPlatformUtils::ClockInMsec();
+  SvdConvJob job;
+
+  return CheckSvdFile(m_svdOptions, job);
+}
+
+/**
+ * @brief reads, checks and converts one SVD file
+ * @param options options for this file
+ * @param job receives the phase timings
+ * @return SVD_ERR_SUCCESS or error code
+*/
+SVD_ERR SvdConv::CheckSvdFile(SvdOptions& options, SvdConvJob& job)
+{
+  TraceSpan fileSpan("SvdConv::CheckSvdFile", "svdconv", options.GetSvdFullpath());
+  uint32_t tAll = ClockInMsec();
 
   SVD_ERR svdRes = SVD_ERR_SUCCESS;
   XMLTreeSlim* xmlTree;
-  const string& path = m_svdOptions.GetSvdFullpath();
+  SvdModel* svdModel;
+  const string& path = options.GetSvdFullpath();
 
   const string version = VERSION_STRING;
   const string descr = PRODUCT_NAME;
   const string copyright = COPYRIGHT_NOTICE;
 
+  auto logPhase = [&job](const string& name, bool success, uint32_t time) {
+    if(success) { LogMsg("M040", NAME(name), TIME(time)); }
+    else        { LogMsg("M111", NAME(name));             }
+    job.phases.push_back({ name, time, success });
+  };
+
   LogMsg("M051", PATH(path));
   if(!RteFsUtils::Exists(path)) {
     LogMsg("M123", PATH(path));
@@ -206,175 +253,396 @@ SVD_ERR SvdConv::CheckSvdFile()
     return svdRes;
   }
 
-  xmlTree = new XMLTreeSlim();
-  xmlTree->AddFileName(path);
-
-  // ----------------------  Read XML  ----------------------
-  uint32_t t1 = CrossPlatformUtils::ClockInMsec();
-	bool success = xmlTree->ParseAll();
-  uint32_t t2 = CrossPlatformUtils::ClockInMsec() - t1;
-
-  if(success) { LogMsg("M040", NAME("Reading SVD File"), TIME(t2)); }
-	else        { LogMsg("M111", NAME("Reading SVD File"));           }
-
-  // ----------------------  Construct Model  ----------------------
-  if (m_svdOptions.IsUnderTest()) {
-    string inFile = m_svdOptions.GetSvdFileName();
+  // ----------------------  Read XML and Construct Model  ----------------------
+  string logFileName;
+  if (options.IsUnderTest()) {
+    string inFile = options.GetSvdFileName();
     try {
       const fs::path inPath = inFile;
       const auto inFilename = inPath.filename();
-      const auto fnString = inFilename.string();
-     ErrLog::Get()->SetFileName(fnString);
+      logFileName = inFilename.string();
     }
     catch (const fs::filesystem_error&) {
-     ErrLog::Get()->SetFileName(inFile);
+      logFileName = inFile;
     }
   }
-  else if (m_svdOptions.IsSuppressPath()) {
-    string inFile = m_svdOptions.GetSvdFileName();
-   ErrLog::Get()->SetFileName(inFile);
+  else if (options.IsSuppressPath()) {
+    logFileName = options.GetSvdFileName();
   }
   else {
-   ErrLog::Get()->SetFileName(path);
+    logFileName = path;
   }
 
-  t1 = CrossPlatformUtils::ClockInMsec();
-  m_svdModel = new SvdModel(0);
-  m_svdModel->SetInputFileName(path);
-  m_svdModel->SetShowMissingEnums();
-  success = m_svdModel->Construct(xmlTree);
-  t2 = CrossPlatformUtils::ClockInMsec() - t1;
+  svdModel = new SvdModel(0);
+  svdModel->SetInputFileName(path);
+  svdModel->SetShowMissingEnums();
 
-  if(success) { LogMsg("M040", NAME("Constructing Model"), TIME(t2)); }
-	else        { LogMsg("M111", NAME("Constructing Model"));           }
+  // the model is constructed while reading, XML elements are released as soon as they are processed
+  SvdModelBuilder modelBuilder(svdModel);
+  modelBuilder.SetLogFileName(logFileName);
+  modelBuilder.SetJobs(options.GetJobs());
+  xmlTree = new XMLTreeSlim(&modelBuilder);
+  xmlTree->AddFileName(path);
 
-  // ----------------------  Delete XML Tree  ----------------------
-  t1 = CrossPlatformUtils::ClockInMsec();
-  delete xmlTree;
-  t2 = CrossPlatformUtils::ClockInMsec() - t1;
+  uint32_t t1 = ClockInMsec();
+  bool success = true;
+  {
+    TraceSpan span("Reading SVD File and Constructing Model", "svdconv");
+    success = xmlTree->ParseAll();
+    ErrLog::Get()->SetFileName(logFileName);
+    if(!modelBuilder.Finish()) {
+      success = false;
+    }
+    delete xmlTree;
+  }
+  uint32_t t2 = ClockInMsec() - t1;
 
-  if(success) { LogMsg("M040", NAME("Deleting XML Tree"), TIME(t2));  }
-	else        { LogMsg("M111", NAME("Deleting XML Tree"));            }
+  logPhase("Reading SVD File and Constructing Model", success, t2);
 
   // ----------------------  Calculate Model  ----------------------
-  t1 = CrossPlatformUtils::ClockInMsec();
-  success = m_svdModel->CalculateModel();
-  t2 = CrossPlatformUtils::ClockInMsec() - t1;
+  t1 = ClockInMsec();
+  {
+    TraceSpan span("Calculating Model", "svdconv");
+    success = svdModel->CalculateModel();
+  }
+  t2 = ClockInMsec() - t1;
 
-  if(success) { LogMsg("M040", NAME("Calculating Model"), TIME(t2));  }
-	else        { LogMsg("M111", NAME("Calculating Model"));            }
+  logPhase("Calculating Model", success, t2);
   // ----------------------  Validate Model  ----------------------
-  t1 = CrossPlatformUtils::ClockInMsec();
-	success = m_svdModel->Validate();
-  t2 = CrossPlatformUtils::ClockInMsec() - t1;
+  t1 = ClockInMsec();
+  {
+    TraceSpan span("Validating Model", "svdconv");
+    success = svdModel->Validate();
+  }
+  t2 = ClockInMsec() - t1;
 
-  if(success) { LogMsg("M040", NAME("Validating Model"), TIME(t2)); }
-	else        { LogMsg("M111", NAME("Validating Model"));           }
+  logPhase("Validating Model", success, t2);
 
   // ----------------------  GetModel: device  ----------------------
-  SvdDevice  *device = m_svdModel->GetDevice();
+  SvdDevice  *device = svdModel->GetDevice();
 
-  if(device && m_svdOptions.IsCreateFields() && !m_svdOptions.IsCreateFieldsAnsiC()) {     // if fields are generated, we have annon unions
+  if(device && options.IsCreateFields() && !options.IsCreateFieldsAnsiC()) {     // if fields are generated, we have annon unions
     device->SetHasAnnonUnions();
   }
 
   // ----------------------  Create Generator  ----------------------
-  SvdGenerator *generator = new SvdGenerator(m_svdOptions);
-  string outDir = m_svdOptions.GetOutputDirectory();
+  SvdGenerator *generator = new SvdGenerator(options);
+  string outDir = options.GetOutputDirectory();
 
   // ----------------------  Generate Listings  ----------------------
-  if(m_svdOptions.IsGenerateMap()) {
-    t1 = CrossPlatformUtils::ClockInMsec();
+  if(options.IsGenerateMap()) {
+    TraceSpan span("Generate Listing File", "svdconv");
+    t1 = ClockInMsec();
 
     if(device) {
       generator->SetSvdFileName(path);
       generator->SetProgramInfo(version, descr, copyright);
 
-      if(m_svdOptions.IsGenerateMapPeripheral()) {
+      if(options.IsGenerateMapPeripheral()) {
         success = generator->PeripheralListing  (device, outDir);
       }
-      if(m_svdOptions.IsGenerateMapRegister()) {
+      if(options.IsGenerateMapRegister()) {
         success = generator->RegisterListing    (device, outDir);
       }
-      if(m_svdOptions.IsGenerateMapField()) {
+      if(options.IsGenerateMapField()) {
         success = generator->FieldListing       (device, outDir);
       }
     }
-    t2 = CrossPlatformUtils::ClockInMsec() - t1;
+    t2 = ClockInMsec() - t1;
 
-    if(success) { LogMsg("M040", NAME("Generate Listing File"), TIME(t2));}
-	  else        { LogMsg("M111", NAME("Generate Listing File"));          }
+    logPhase("Generate Listing File", success, t2);
   }
 
   // ----------------------  Generate CMSIS Headerfile  ----------------------
-  if(m_svdOptions.IsGenerateHeader()) {
-    t1 = CrossPlatformUtils::ClockInMsec();
+  if(options.IsGenerateHeader()) {
+    TraceSpan span("Generate CMSIS Headerfile", "svdconv");
+    t1 = ClockInMsec();
     if(device) {
       generator->SetSvdFileName(path);
       generator->SetProgramInfo(version, descr, copyright);
       success = generator->CmsisHeaderFile(device, outDir);
     }
-    t2 = CrossPlatformUtils::ClockInMsec() - t1;
+    t2 = ClockInMsec() - t1;
 
-    if(success) { LogMsg("M040", NAME("Generate CMSIS Headerfile"), TIME(t2)); }
-	  else        { LogMsg("M111", NAME("Generate CMSIS Headerfile"));           }
+    logPhase("Generate CMSIS Headerfile", success, t2);
   }
 
   // ----------------------  Generate CMSIS Partitionfile  ----------------------
-  if(m_svdOptions.IsGeneratePartition()) {
-    t1 = CrossPlatformUtils::ClockInMsec();
+  if(options.IsGeneratePartition()) {
+    TraceSpan span("Generate CMSIS Partitionfile", "svdconv");
+    t1 = ClockInMsec();
     if(device) {
       generator->SetSvdFileName(path);
       generator->SetProgramInfo(version, descr, copyright);
       success = generator->CmsisPartitionFile(device, outDir);
     }
-    t2 = CrossPlatformUtils::ClockInMsec() - t1;
+    t2 = ClockInMsec() - t1;
 
-    if(success) { LogMsg("M040", NAME("Generate CMSIS Partitionfile"), TIME(t2)); }
-	  else        { LogMsg("M111", NAME("Generate CMSIS Partitionfile"));           }
+    logPhase("Generate CMSIS Partitionfile", success, t2);
   }
 
   // ----------------------  Generate SFD File  ----------------------
-  if(m_svdOptions.IsGenerateSfd()) {
-    t1 = CrossPlatformUtils::ClockInMsec();
+  if(options.IsGenerateSfd()) {
+    TraceSpan span("Generate System Viewer SFD File", "svdconv");
+    t1 = ClockInMsec();
     if(device) {
       generator->SetSvdFileName(path);
       generator->SetProgramInfo(version, descr, copyright);
       success = generator->SfdFile(device, outDir);
     }
-    t2 = CrossPlatformUtils::ClockInMsec() - t1;
+    t2 = ClockInMsec() - t1;
 
-    if(success) { LogMsg("M040", NAME("Generate System Viewer SFD File"), TIME(t2)); }
-	  else        { LogMsg("M111", NAME("Generate System Viewer SFD File"));           }
+    logPhase("Generate System Viewer SFD File", success, t2);
   }
 
   // ----------------------  Generate SFR File  ----------------------
-  if(m_svdOptions.IsGenerateSfr()) {
-    t1 = CrossPlatformUtils::ClockInMsec();
+  if(options.IsGenerateSfr()) {
+    TraceSpan span("Generate System Viewer SFR File", "svdconv");
+    t1 = ClockInMsec();
     if(device) {
       generator->SetSvdFileName(path);
       generator->SetProgramInfo(version, descr, copyright);
       success = generator->SfrFile(device, outDir);
     }
-    t2 = CrossPlatformUtils::ClockInMsec() - t1;
+    t2 = ClockInMsec() - t1;
+
+    logPhase("Generate System Viewer SFR File", success, t2);
+  }
+
+  // ----------------------  Generate Register Database  ----------------------
+  if(options.IsGenerateRegDb()) {
+    TraceSpan span("Generate Register Database", "svdconv");
+    t1 = ClockInMsec();
+    if(device) {
+      generator->SetSvdFileName(path);
+      generator->SetProgramInfo(version, descr, copyright);
+      success = generator->RegisterDbFile(device, outDir);
+    }
+    t2 = ClockInMsec() - t1;
 
-    if(success) { LogMsg("M040", NAME("Generate System Viewer SFR File"), TIME(t2)); }
-	  else        { LogMsg("M111", NAME("Generate System Viewer SFR File"));           }
+    logPhase("Generate Register Database", success, t2);
   }
 
   // ----------------------  Delete Generator  ----------------------
   delete generator;
 
   // ----------------------  Delete Model  ----------------------
-  t1 = CrossPlatformUtils::ClockInMsec();
-  delete m_svdModel;
-  t2 = CrossPlatformUtils::ClockInMsec() - t1;
+  t1 = ClockInMsec();
+  {
+    TraceSpan span("Deleting Model", "svdconv");
+    delete svdModel;
+  }
+  t2 = ClockInMsec() - t1;
 
-  if(success) { LogMsg("M040", NAME("Deleting Model"), TIME(t2)); }
-	else        { LogMsg("M111", NAME("Deleting Model"));           }
+  logPhase("Deleting Model", success, t2);
 
-  t2 = CrossPlatformUtils::ClockInMsec() - tAll;
+  t2 = ClockInMsec() - tAll;
   LogMsg("M041", TIME(t2));
 
   return svdRes;
 }
+
+/**
+ * @brief converts all SVD files of a batch, each file in its own ErrLog context
+ * @return SVD_ERR_SUCCESS or error code
+*/
+SVD_ERR SvdConv::CheckSvdBatch()
+{
+  uint32_t tAll = ClockInMsec();
+
+  vector<SvdConvJob> jobs;
+  if(!CollectBatchJobs(jobs)) {
+    return SVD_ERR_NOT_FOUND;
+  }
+
+  // the XML reader adds its messages when the first reader is created: complete the shared
+  // message tables before jobs start, from then on they are only read
+  {
+    XMLTreeSlim xmlTree;
+  }
+
+  const size_t nThreads = JobPool::Run(jobs.size(), [this, &jobs](size_t i) {
+    RunBatchJob(jobs[i]);
+  }, m_svdOptions.GetJobs());
+
+  // report in input order, independent of job scheduling
+  SVD_ERR svdRes = SVD_ERR_SUCCESS;
+  for(const auto& job : jobs) {
+    LogMsg("M025", PATH(job.svdFile), ERR(job.errCnt), WARN(job.warnCnt), TIME(job.time));
+    m_batchErrCnt  += job.errCnt;
+    m_batchWarnCnt += job.warnCnt;
+    if(job.result != SVD_ERR_SUCCESS) {
+      svdRes = job.result;
+    }
+  }
+  LogMsg("M026", NUM((unsigned)jobs.size()), NUM2((unsigned)nThreads), TIME(ClockInMsec() - tAll));
+
+  string summaryFile = m_svdOptions.GetSummaryFile();
+  if(summaryFile.empty()) {
+    string outDir = m_svdOptions.GetOutputDirectory();
+    summaryFile = (outDir.empty() ? string(".") : outDir) + "/svdconv_summary.json";
+  }
+  if(!WriteBatchSummary(jobs, summaryFile)) {
+    LogMsg("M130", NAME(summaryFile));
+  }
+
+  return svdRes;
+}
+
+/**
+ * @brief collects the SVD files of a list file or wildcard pattern.
+ *        List file lines: <SVD file> [<output directory>], '#' starts a comment,
+ *        relative paths are relative to the list file.
+ *        Without output directory a subdirectory of -o named after the SVD file is used.
+ * @param jobs receives one job per SVD file
+ * @return passed / failed
+*/
+bool SvdConv::CollectBatchJobs(vector<SvdConvJob>& jobs)
+{
+  const string& batchInput = m_svdOptions.GetBatchInput();
+  string outDir = m_svdOptions.GetOutputDirectory();
+  if(outDir.empty()) {
+    outDir = RteFsUtils::GetCurrentFolder(false);
+  }
+
+  auto addJob = [&jobs, &outDir](const string& svdFile, const string& jobOutDir) {
+    SvdConvJob job;
+    job.svdFile = RteFsUtils::AbsolutePath(svdFile).generic_string();
+    const string baseName = RteUtils::ExtractFileBaseName(job.svdFile);
+    job.outDir = jobOutDir.empty() ? outDir + "/" + baseName : RteFsUtils::AbsolutePath(jobOutDir).generic_string();
+    job.logFile = job.outDir + "/" + baseName + ".log";
+    jobs.push_back(job);
+  };
+
+  if(RteFsUtils::IsRegularFile(batchInput) && !RteUtils::EqualNoCase(RteUtils::ExtractFileExtension(batchInput), "svd")) {
+    ifstream listFile(batchInput);
+    if(!listFile.is_open()) {
+      LogMsg("M123", PATH(batchInput));
+      return false;
+    }
+
+    const string listDir = RteUtils::ExtractFilePath(RteFsUtils::AbsolutePath(batchInput).generic_string(), true);
+    ParseOptions parseOptions(m_svdOptions);
+    string line;
+    while(getline(listFile, line)) {
+      vector<string> entries;
+      parseOptions.ParseOptsFileLine(line, entries);
+      if(entries.empty()) {
+        continue;
+      }
+      for(auto& entry : entries) {
+        entry = RteUtils::BackSlashesToSlashes(RteUtils::RemoveQuotes(entry));
+        if(!fs::path(entry).is_absolute()) {
+          entry = listDir + entry;
+        }
+      }
+      addJob(entries[0], entries.size() > 1 ? entries[1] : RteUtils::EMPTY_STRING);
+    }
+  }
+  else {
+    string dir = RteUtils::ExtractFilePath(batchInput, false);
+    if(dir.empty()) {
+      dir = ".";
+    }
+    list<string> svdFiles;
+    RteFsUtils::GrepFileNames(svdFiles, dir, RteUtils::ExtractFileName(batchInput));
+    svdFiles.sort();
+    for(const auto& svdFile : svdFiles) {
+      addJob(svdFile, RteUtils::EMPTY_STRING);
+    }
+  }
+
+  if(jobs.empty()) {
+    LogMsg("M133", PATH(batchInput));
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief converts one SVD file of a batch, messages are written to the job's log file
+ * @param job SVD file, receives the results
+*/
+void SvdConv::RunBatchJob(SvdConvJob& job)
+{
+  uint32_t tJob = ClockInMsec();
+
+  ErrOutputter* errOutputter = new ErrOutputterSaveToStdoutOrFile();
+  errOutputter->SetLogFileName(job.logFile);
+  ErrLogContext errLog(errOutputter);
+  errLog.SetQuietMode(false);           // quiet mode suppresses console output, the job log is a file
+  errLog.Activate();
+
+  try {
+    SvdOptions options = m_svdOptions;
+    options.ClearInputOutput();
+    options.SetJobs(1);                 // files are checked in parallel, peripherals sequentially
+    RteFsUtils::CreateDirectories(job.outDir);
+
+    if(options.SetFileUnderTest(job.svdFile) && options.SetOutputDirectory(job.outDir)) {
+      job.result = CheckSvdFile(options, job);
+    }
+    else {
+      job.result = SVD_ERR_NOT_FOUND;
+    }
+  }
+  catch(std::exception& e) {
+    string criticalErrMsg = "STL exception occurred: ";
+    criticalErrMsg += e.what();
+    LogMsg("M104", MSG(criticalErrMsg));
+    job.result = SVD_ERR_INTERNAL_ERR;
+  }
+
+  job.errCnt  = errLog.GetErrCnt();
+  job.warnCnt = errLog.GetWarnCnt();
+  job.time    = ClockInMsec() - tJob;
+
+  LogMsg("M016");
+  LogMsg("M022", ERR(job.errCnt), WARN(job.warnCnt));
+
+  errLog.Save();                        // the destructor does not save in quiet mode
+  errLog.Deactivate();
+}
+
+/**
+ * @brief writes the batch results in JSON format
+ * @param jobs processed jobs
+ * @param fileName summary file
+ * @return passed / failed
+*/
+bool SvdConv::WriteBatchSummary(const vector<SvdConvJob>& jobs, const string& fileName)
+{
+  ostringstream summary;
+  summary << "{\n  \"errors\": " << m_batchErrCnt << ",\n  \"warnings\": " << m_batchWarnCnt << ",\n  \"files\": [";
+  for(auto it = jobs.begin(); it != jobs.end(); it++) {
+    const SvdConvJob& job = *it;
+    string status;
+    switch(job.result) {
+      case SVD_ERR_SUCCESS:   status = job.errCnt ? "error" : job.warnCnt ? "warning" : "ok"; break;
+      case SVD_ERR_NOT_FOUND: status = "not found"; break;
+      default:                status = "failed";    break;
+    }
+
+    summary << (it == jobs.begin() ? "\n" : ",\n");
+    summary << "    {\n";
+    summary << "      \"file\": \"" << Tracer::EscapeJson(job.svdFile) << "\",\n";
+    summary << "      \"outdir\": \"" << Tracer::EscapeJson(job.outDir) << "\",\n";
+    summary << "      \"log\": \"" << Tracer::EscapeJson(job.logFile) << "\",\n";
+    summary << "      \"status\": \"" << Tracer::EscapeJson(status) << "\",\n";
+    summary << "      \"errors\": " << job.errCnt << ",\n";
+    summary << "      \"warnings\": " << job.warnCnt << ",\n";
+    summary << "      \"time\": " << job.time << ",\n";
+    summary << "      \"phases\": [";
+    for(auto itp = job.phases.begin(); itp != job.phases.end(); itp++) {
+      summary << (itp == job.phases.begin() ? "\n" : ",\n");
+      summary << "        { \"name\": \"" << Tracer::EscapeJson(itp->name) << "\", \"time\": " << itp->time
+              << ", \"success\": " << (itp->success ? "true" : "false") << " }";
+    }
+    summary << (job.phases.empty() ? "]\n" : "\n      ]\n");
+    summary << "    }";
+  }
+  summary << (jobs.empty() ? "]\n" : "\n  ]\n") << "}\n";
+
+  return RteFileWriter::WriteFile(fileName, summary.str());
+}
@@ -14,6 +14,8 @@ const MsgTable SvdConv::msgTable = {
   { "M022", { MsgLevel::LEVEL_TEXT ,    CRLF_B,   "Found %ERR% Error(s) and %WARN% Warning(s)."                                 } },
   { "M023", { MsgLevel::LEVEL_TEXT ,    CRLF_B,   "\nPhase%CHECK%"                                                              } },
   { "M024", { MsgLevel::LEVEL_TEXT ,    CRLF_B,   "Arguments: %OPTS%"                                                           } },
+  { "M025", { MsgLevel::LEVEL_TEXT ,    CRLF_B,   "%PATH%: %ERR% Error(s) and %WARN% Warning(s), %TIME%ms."                     } },
+  { "M026", { MsgLevel::LEVEL_TEXT ,    CRLF_B,   "Batch: %NUM% SVD file(s) converted by %NUM2% job(s) in %TIME%ms."           } },
 
 
 // 40... Info Messages (INFO = verbose)
@@ -60,6 +62,7 @@ const MsgTable SvdConv::msgTable = {
   { "M130", { MsgLevel::LEVEL_ERROR,    CRLF_B,   "Cannot create file '%NAME%'"                                                 } },
   { "M131", { MsgLevel::LEVEL_ERROR,    CRLF_B,   ""                                                                            } },
   { "M132", { MsgLevel::LEVEL_ERROR,    CRLF_B,   "SfrCC2 report:\n%MSG%\nSfrCC2 report end.\n"                                 } },
+  { "M133", { MsgLevel::LEVEL_ERROR,    CRLF_B,   "No SVD files found for batch: '%PATH%'"                                     } },
 
 
 // 200... Validation Errors
@@ -38,7 +38,8 @@ SvdOptions::SvdOptions() :
   m_bNoCleanup(false),
   m_bDebugStruct(false),
   m_bDebugHeaderfile(false),
-  m_bDebugSfd(false)
+  m_bDebugSfd(false),
+  m_jobs(0)
 {
 }
 
@@ -346,6 +347,77 @@ const std::string& SvdOptions::GetOutputDirectory()
   return m_outputDir;
 }
 
+/**
+ * @brief sets the list file or wildcard pattern of SVD files to convert in batch mode
+ * @param batchInput list file name or pattern
+ * @return passed / failed
+*/
+bool SvdOptions::SetBatchInput(const string& batchInput)
+{
+  if(batchInput.empty() || !m_svdToCheck.empty()) {  // either one input file or a batch
+    LogMsg("M120");
+    return false;
+  }
+
+  m_batchInput = RteUtils::BackSlashesToSlashes(RteUtils::RemoveQuotes(batchInput));
+
+  return true;
+}
+
+/**
+ * @brief sets the number of jobs checking batch files or constructing peripherals in parallel, 0 for one per hardware thread
+ * @param jobs number of jobs
+ * @return passed / failed
+*/
+bool SvdOptions::SetJobs(uint32_t jobs)
+{
+  m_jobs = jobs;
+
+  return true;
+}
+
+/**
+ * @brief sets the file the batch summary is written to
+ * @param summaryFile file name
+ * @return passed / failed
+*/
+bool SvdOptions::SetSummaryFile(const string& summaryFile)
+{
+  if(summaryFile.empty()) {
+    return false;
+  }
+
+  m_summaryFile = RteUtils::BackSlashesToSlashes(RteUtils::RemoveQuotes(summaryFile));
+
+  return true;
+}
+
+/**
+ * @brief sets the file the trace events are written to
+ * @param traceFile file name
+ * @return passed / failed
+*/
+bool SvdOptions::SetTraceFile(const string& traceFile)
+{
+  if(traceFile.empty()) {
+    return false;
+  }
+
+  m_traceFile = RteUtils::BackSlashesToSlashes(RteUtils::RemoveQuotes(traceFile));
+
+  return true;
+}
+
+/**
+ * @brief clears input file, output directory and output file name, used to set up the options of a batch job
+*/
+void SvdOptions::ClearInputOutput()
+{
+  m_svdToCheck.clear();
+  m_outputDir.clear();
+  m_outfileOverride.clear();
+}
+
 void SvdOptions::SetQuietMode(bool bQuiet /* = true */)
 {
   ErrLog::Get()->SetQuietMode(bQuiet);
@@ -6,6 +6,8 @@
 #ifndef FileIo_H
 #define FileIo_H
 
+#include "RteFileWriter.h"
+
 #include <string>
 #include <map>
 #include <chrono>
@@ -22,6 +24,7 @@ public:
 
   bool                Create                    (const std::string &fileName);
   bool                Write                     (const std::string& text);
+  bool                Write                     (const char* text, size_t len);
   bool                WriteText                 (const std::string& text);
   bool                WriteChar                 (const char c);
   bool                WriteLine                 (const char *text, ...);
@@ -46,7 +49,7 @@ public:
   const std::string&  GetDeviceVersion          ()                                { return m_deviceVersion; }
 
 protected:
-  uint32_t            ConvertTab                (std::string& dest, const std::string& src);
+  uint32_t            ConvertTab                (std::string& dest, const char* src, size_t len);
   bool                CreateFileDescription     ();
 
   // see https://stackoverflow.com/questions/56788745/how-to-convert-stdfilesystemfile-time-type-to-a-string-using-gcc-9/58237530#58237530
@@ -58,6 +61,7 @@ protected:
 
 private:
   uint32_t      m_tabSpaceCnt;
+  uint32_t      m_lineCharCnt;
   std::string   m_fileName;
   std::string   m_svdFileName;
   std::string   m_versionString;
@@ -67,6 +71,7 @@ private:
   std::string   m_licenseText;
   std::string   m_deviceVersion;
   std::string   m_outFileStr;
+  RteFileWriter m_writer;         // opened once, replaces the file on Close()
 
   static const std::string genericLicenseText;
 };
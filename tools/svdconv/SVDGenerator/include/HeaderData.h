@@ -218,6 +218,7 @@ private:
   uint32_t            m_maxBitWidth;
   RegTreeNode*        m_rootNode;
   RegTreeNode         m_regTreeNodes[32];     // 32 placeholder
+  uint32_t            m_regTreeNodeCnt;
   StructUnion         m_structUnionStack[32];
 
   std::map<std::string, SvdEnum*> m_usedEnumValues;   // check enum names globally
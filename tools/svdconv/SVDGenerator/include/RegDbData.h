@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2010-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef RegDbData_H
+#define RegDbData_H
+
+#include "SvdRegDb.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+class SvdItem;
+class SvdDevice;
+class SvdPeripheral;
+class SvdCluster;
+class SvdRegister;
+class SvdField;
+
+/**
+ * @brief writes the compact register database (see SvdRegDb.h) of a calculated device
+*/
+class RegDbData {
+public:
+  RegDbData();
+  ~RegDbData();
+
+  bool      Create              (SvdItem *item, const std::string &fileName);
+
+protected:
+  bool      AddPeripherals      (SvdDevice *device);
+  bool      AddPeripheral       (SvdPeripheral *peripheral);
+  bool      AddRegisters        (SvdItem *container, uint32_t cluster, const std::string &prefix);
+  bool      AddCluster          (SvdCluster *cluster, uint32_t parent, const std::string &prefix);
+  bool      AddRegister         (SvdRegister *reg, uint32_t cluster, const std::string &prefix);
+  bool      AddFields           (SvdRegister *reg);
+  bool      AddEnums            (SvdField *field, SvdRegDb::Field &dbField);
+  uint32_t  AddString           (const std::string &text);
+  bool      Write               (const std::string &fileName);
+
+private:
+  std::vector<SvdRegDb::Peripheral>       m_peripherals;
+  std::vector<SvdRegDb::Cluster>          m_clusters;
+  std::vector<SvdRegDb::Register>         m_registers;
+  std::vector<SvdRegDb::Field>            m_fields;
+  std::vector<SvdRegDb::Enum>             m_enums;
+  uint32_t                                m_deviceName;
+  std::string                             m_strings;
+  std::unordered_map<std::string, uint32_t> m_stringOffsets;   // deduplicates names and descriptions
+};
+
+#endif // RegDbData_H
@@ -47,6 +47,7 @@ public:
   bool            PeripheralListing   (SvdDevice *device, const std::string &path);
   bool            RegisterListing     (SvdDevice *device, const std::string &path);
   bool            FieldListing        (SvdDevice *device, const std::string &path);
+  bool            RegisterDbFile      (SvdDevice *device, const std::string &path);
 
   bool                  SetOutPath          (const std::string &path)     { m_outPath = path; return true; }
   const std::string&    GetOutPath          ()                            { return m_outPath; }
@@ -65,6 +66,7 @@ public:
   std::string           GetPeripheralListFileName ();
   std::string           GetRegisterListFileName   ();
   std::string           GetFieldListFileName      ();
+  std::string           GetRegisterDbFileName     ();
 
 protected:
 
@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2010-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef SvdRegDb_H
+#define SvdRegDb_H
+
+/**
+ * Compact register database generated by svdconv --generate=regdb.
+ *
+ * The file is a little-endian image of the structures below, designed to be
+ * memory mapped and used in place: a Header followed by 8 byte aligned
+ * sections. Items refer to each other by array index and to names by offset
+ * into the string section (NUL terminated, offset 0 is the empty string).
+ * Dim arrays, clusters and derived items are expanded, addresses are absolute.
+ *
+ * This header is self-contained, debugger and trace tools include it to read
+ * the database without the SVD model:
+ *
+ *   SvdRegDb::Reader regDb;
+ *   if(regDb.Open("ARMCM3.regdb")) {
+ *     const auto reg = regDb.FindRegister(0x40000004);
+ *     for(const auto& field : regDb.GetFields(*reg)) { ... }
+ *   }
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SvdRegDb {
+
+static constexpr char     MAGIC[8] = { 'S', 'V', 'D', 'R', 'E', 'G', 'D', 'B' };
+static constexpr uint32_t VERSION  = 1;
+static constexpr uint32_t NONE     = 0xFFFFFFFF;     // no parent cluster, no enumerated values
+static constexpr uint32_t ALIGN    = 8;              // section alignment
+
+// values of SvdTypes::Access
+enum Access : uint8_t { ACCESS_UNDEF = 0, READONLY, WRITEONLY, READWRITE, WRITEONCE, READWRITEONCE };
+
+struct Section {
+  uint32_t offset;                    // from start of file
+  uint32_t count;                     // number of items, bytes for the string section
+};
+
+struct Header {
+  char     magic[8];
+  uint32_t version;
+  uint32_t fileSize;
+  uint32_t deviceName;
+  uint32_t reserved;
+  Section  peripherals;
+  Section  clusters;
+  Section  registers;
+  Section  fields;
+  Section  enums;
+  Section  addressIndex;              // uint32_t register indices sorted by address
+  Section  nameIndex;                 // uint32_t register indices sorted by full name
+  Section  strings;
+};
+
+struct Peripheral {
+  uint64_t address;
+  uint32_t name;
+  uint32_t description;
+  uint32_t firstCluster;
+  uint32_t clusterCount;
+  uint32_t firstRegister;             // registers of the peripheral including clusters are contiguous
+  uint32_t registerCount;
+};
+
+struct Cluster {
+  uint64_t address;
+  uint32_t name;
+  uint32_t description;
+  uint32_t peripheral;
+  uint32_t parent;                    // enclosing cluster or NONE
+};
+
+struct Register {
+  uint64_t address;
+  uint64_t resetValue;
+  uint64_t resetMask;
+  uint32_t name;
+  uint32_t fullName;                  // PERIPHERAL.CLUSTER.REGISTER
+  uint32_t description;
+  uint32_t peripheral;
+  uint32_t cluster;                   // enclosing cluster or NONE
+  uint32_t firstField;
+  uint32_t fieldCount;
+  uint8_t  bitWidth;
+  uint8_t  access;
+  uint16_t reserved;
+};
+
+struct Field {
+  uint32_t name;
+  uint32_t description;
+  uint32_t firstEnum;
+  uint32_t enumCount;
+  uint8_t  bitOffset;
+  uint8_t  bitWidth;
+  uint8_t  access;
+  uint8_t  reserved;
+};
+
+struct Enum {
+  uint64_t value;
+  uint32_t name;
+  uint32_t description;
+  uint8_t  isDefault;
+  uint8_t  reserved[7];
+};
+
+static_assert(sizeof(Header)     == 88, "SvdRegDb::Header layout");
+static_assert(sizeof(Peripheral) == 32, "SvdRegDb::Peripheral layout");
+static_assert(sizeof(Cluster)    == 24, "SvdRegDb::Cluster layout");
+static_assert(sizeof(Register)   == 56, "SvdRegDb::Register layout");
+static_assert(sizeof(Field)      == 20, "SvdRegDb::Field layout");
+static_assert(sizeof(Enum)       == 24, "SvdRegDb::Enum layout");
+
+/**
+ * @brief contiguous items of a mapped section, usable in range-based for loops
+*/
+template<typename T>
+class Range {
+public:
+  Range(const T* data = nullptr, size_t size = 0) : m_data(data), m_size(size) {}
+
+  const T* begin() const { return m_data; }
+  const T* end() const { return m_data + m_size; }
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  const T& operator[](size_t i) const { return m_data[i]; }
+
+private:
+  const T* m_data;
+  size_t   m_size;
+};
+
+/**
+ * @brief read-only view of a register database, memory mapped from file or attached to a buffer.
+ *        Opening validates the header and section bounds only, lookups do not copy any data.
+*/
+class Reader {
+public:
+  Reader() = default;
+  ~Reader() { Close(); }
+  Reader(const Reader&) = delete;
+  Reader& operator=(const Reader&) = delete;
+
+  /**
+   * @brief map a register database file
+   * @param fileName database file
+   * @return true if the file is mapped and valid
+  */
+  bool Open(const std::string& fileName) {
+    Close();
+#if defined(_WIN32)
+    m_file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(m_file == INVALID_HANDLE_VALUE) {
+      return false;
+    }
+    LARGE_INTEGER size;
+    if(!GetFileSizeEx(m_file, &size) || size.QuadPart < (LONGLONG)sizeof(Header)) {
+      Close();
+      return false;
+    }
+    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    m_mapped = m_mapping ? MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    m_mappedSize = (size_t)size.QuadPart;
+#else
+    const int fd = open(fileName.c_str(), O_RDONLY);
+    if(fd < 0) {
+      return false;
+    }
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(Header)) {
+      close(fd);
+      return false;
+    }
+    void* mapped = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    m_mapped = mapped != MAP_FAILED ? mapped : nullptr;
+    m_mappedSize = (size_t)st.st_size;
+#endif
+    if(!m_mapped || !Attach(m_mapped, m_mappedSize)) {
+      Close();
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * @brief use a register database in memory, the buffer must stay valid and 8 byte aligned
+   * @param data database image
+   * @param size size of the image
+   * @return true if the image is valid
+  */
+  bool Attach(const void* data, size_t size) {
+    m_data = nullptr;
+    m_size = 0;
+    if(!data || size < sizeof(Header) || (reinterpret_cast<uintptr_t>(data) % ALIGN) != 0) {
+      return false;
+    }
+    const auto header = static_cast<const Header*>(data);
+    if(memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION || header->fileSize > size) {
+      return false;
+    }
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = header->fileSize;
+    if(!CheckSection<Peripheral>(header->peripherals) || !CheckSection<Cluster>(header->clusters) ||
+       !CheckSection<Register>(header->registers) || !CheckSection<Field>(header->fields) ||
+       !CheckSection<Enum>(header->enums) || !CheckSection<uint32_t>(header->addressIndex) ||
+       !CheckSection<uint32_t>(header->nameIndex) || !CheckSection<char>(header->strings) ||
+       header->addressIndex.count != header->registers.count || header->nameIndex.count != header->registers.count ||
+       header->strings.count == 0 || m_data[header->strings.offset + header->strings.count - 1] != '\0') {
+      m_data = nullptr;
+      m_size = 0;
+      return false;
+    }
+    return true;
+  }
+
+  void Close() {
+#if defined(_WIN32)
+    if(m_mapped) {
+      UnmapViewOfFile(m_mapped);
+    }
+    if(m_mapping) {
+      CloseHandle(m_mapping);
+    }
+    if(m_file != INVALID_HANDLE_VALUE) {
+      CloseHandle(m_file);
+    }
+    m_mapping = nullptr;
+    m_file = INVALID_HANDLE_VALUE;
+#else
+    if(m_mapped) {
+      munmap(m_mapped, m_mappedSize);
+    }
+#endif
+    m_mapped = nullptr;
+    m_mappedSize = 0;
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  bool IsOpen() const { return m_data != nullptr; }
+
+  const Header& GetHeader() const { return *reinterpret_cast<const Header*>(m_data); }
+
+  /**
+   * @brief string of the string section
+   * @param offset string offset
+   * @return string, empty for an invalid offset
+  */
+  const char* GetString(uint32_t offset) const {
+    const auto& strings = GetHeader().strings;
+    return offset < strings.count ? reinterpret_cast<const char*>(m_data + strings.offset + offset) : "";
+  }
+
+  const char*            GetDeviceName()   const { return GetString(GetHeader().deviceName); }
+  Range<Peripheral>      GetPeripherals()  const { return GetSection<Peripheral>(GetHeader().peripherals); }
+  Range<Cluster>         GetClusters()     const { return GetSection<Cluster>(GetHeader().clusters); }
+  Range<Register>        GetRegisters()    const { return GetSection<Register>(GetHeader().registers); }
+
+  Range<Register> GetRegisters(const Peripheral& peripheral) const {
+    return GetSubRange(GetRegisters(), peripheral.firstRegister, peripheral.registerCount);
+  }
+
+  Range<Field> GetFields(const Register& reg) const {
+    return GetSubRange(GetSection<Field>(GetHeader().fields), reg.firstField, reg.fieldCount);
+  }
+
+  Range<Enum> GetEnums(const Field& field) const {
+    return field.firstEnum == NONE ? Range<Enum>() : GetSubRange(GetSection<Enum>(GetHeader().enums), field.firstEnum, field.enumCount);
+  }
+
+  const Peripheral* GetPeripheral(const Register& reg) const {
+    const auto peripherals = GetPeripherals();
+    return reg.peripheral < peripherals.size() ? &peripherals[reg.peripheral] : nullptr;
+  }
+
+  const Cluster* GetCluster(const Register& reg) const {
+    const auto clusters = GetClusters();
+    return reg.cluster < clusters.size() ? &clusters[reg.cluster] : nullptr;
+  }
+
+  /**
+   * @brief find the register covering an address, the first one in SVD order for alternate registers
+   * @param address absolute address
+   * @return register or nullptr
+  */
+  const Register* FindRegister(uint64_t address) const {
+    if(!m_data) {
+      return nullptr;
+    }
+    const auto registers = GetRegisters();
+    const auto index = GetSection<uint32_t>(GetHeader().addressIndex);
+    auto it = std::upper_bound(index.begin(), index.end(), address, [&registers](uint64_t addr, uint32_t i) {
+      return i < registers.size() && addr < registers[i].address;
+    });
+
+    const Register* found = nullptr;
+    while(it != index.begin()) {
+      --it;
+      if(*it >= registers.size()) {
+        break;
+      }
+      const auto& reg = registers[*it];
+      if(found) {
+        if(reg.address != found->address) {
+          break;
+        }
+        found = &reg;
+      }
+      else if(address < reg.address + std::max<uint64_t>(reg.bitWidth / 8, 1)) {
+        found = &reg;
+      }
+      else if(address - reg.address >= 8) {
+        break;                        // registers are at most 64 bit wide
+      }
+    }
+    return found;
+  }
+
+  /**
+   * @brief find a register by its full name
+   * @param fullName PERIPHERAL.REGISTER or PERIPHERAL.CLUSTER.REGISTER
+   * @return register or nullptr
+  */
+  const Register* FindRegister(const std::string& fullName) const {
+    if(!m_data) {
+      return nullptr;
+    }
+    const auto registers = GetRegisters();
+    const auto index = GetSection<uint32_t>(GetHeader().nameIndex);
+    auto it = std::lower_bound(index.begin(), index.end(), fullName, [this, &registers](uint32_t i, const std::string& name) {
+      return i < registers.size() && name.compare(GetString(registers[i].fullName)) > 0;
+    });
+    if(it != index.end() && *it < registers.size() && fullName == GetString(registers[*it].fullName)) {
+      return &registers[*it];
+    }
+    return nullptr;
+  }
+
+private:
+  template<typename T>
+  bool CheckSection(const Section& section) const {
+    return section.offset % ALIGN == 0 && section.offset <= m_size && section.count <= (m_size - section.offset) / sizeof(T);
+  }
+
+  template<typename T>
+  Range<T> GetSection(const Section& section) const {
+    return m_data ? Range<T>(reinterpret_cast<const T*>(m_data + section.offset), section.count) : Range<T>();
+  }
+
+  template<typename T>
+  static Range<T> GetSubRange(const Range<T>& range, uint32_t first, uint32_t count) {
+    if(first > range.size() || count > range.size() - first) {
+      return Range<T>();
+    }
+    return Range<T>(range.begin() + first, count);
+  }
+
+  const uint8_t* m_data = nullptr;
+  size_t         m_size = 0;
+  void*          m_mapped = nullptr;
+  size_t         m_mappedSize = 0;
+#if defined(_WIN32)
+  HANDLE         m_file = INVALID_HANDLE_VALUE;
+  HANDLE         m_mapping = nullptr;
+#endif
+};
+
+} // namespace SvdRegDb
+
+#endif // SvdRegDb_H
@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <fstream>
+#include <ctime>
 
 using namespace std;
 
@@ -33,7 +34,9 @@ const string FileIo::genericLicenseText = \
 
 
 FileIo::FileIo() :
-  m_tabSpaceCnt(0)
+  m_tabSpaceCnt(0),
+  m_lineCharCnt(0),
+  m_writer(FILE_BUF_SIZE)
 {
 }
 
@@ -49,13 +52,12 @@ bool FileIo::Create(const string &fileName)
     return false;
   }
 
-  ofstream fileStream(fileName);
-  if(!fileStream.is_open()) {
+  m_outFileStr.clear();
+  if(!m_writer.Open(fileName)) {
     LogMsg("M130", NAME(fileName));
     return false;
   }
 
-  fileStream.close();
   SetFileName(fileName);
   CreateFileDescription();
 
@@ -63,12 +65,17 @@ bool FileIo::Create(const string &fileName)
 }
 
 bool FileIo::Write(const string& text)
+{
+  return Write(text.data(), text.length());
+}
+
+bool FileIo::Write(const char* text, size_t len)
 {
   if(m_outFileStr.length() > FILE_BUF_SIZE) {
     Flush();
   }
 
-  ConvertTab(m_outFileStr, text);
+  ConvertTab(m_outFileStr, text, len);
 
   return true;
 }
@@ -79,40 +86,55 @@ bool FileIo::WriteLine(const char *text, ...)
   char outBuf[1024];
 
   va_start (marker, text);
-  vsnprintf(outBuf, 1024-2, text, marker);
+  int len = vsnprintf(outBuf, sizeof(outBuf), text, marker);
   va_end(marker);
 
-  Write(outBuf);
-  Write("\n");
+  if(len < 0) {
+    return false;
+  }
+
+  if((size_t)len < sizeof(outBuf)) {
+    Write(outBuf, len);
+  }
+  else {
+    string longBuf(len + 1, '\0');       // formatted text exceeds the stack buffer
+    va_start (marker, text);
+    vsnprintf(&longBuf[0], longBuf.size(), text, marker);
+    va_end(marker);
+    Write(longBuf.data(), len);
+  }
+  Write("\n", 1);
 
   return true;
 }
 
 bool FileIo::Flush()
 {
-  if(m_outFileStr.empty()) {
+  if(m_outFileStr.empty() || !m_writer.IsOpen()) {
     return false;
   }
 
-  const auto& fileName = GetFileName();
-  ofstream fileStream(fileName, ofstream::out | ofstream::binary | ofstream::app);   // append
-  if (!fileStream.is_open()) {
-    return false;
-  }
-
-  fileStream << m_outFileStr;
-  fileStream.flush();
-  fileStream.close();
+  const bool success = m_writer.Write(m_outFileStr);
   m_outFileStr.clear();
 
-  return true;
+  return success;
 }
 
 bool FileIo::Close()
 {
-  Write("\n");
+  if(!m_writer.IsOpen()) {
+    m_outFileStr.clear();
+    return false;
+  }
+
+  Write("\n", 1);
   Flush();
 
+  if(!m_writer.Commit()) {
+    LogMsg("M130", NAME(GetFileName()));
+    return false;
+  }
+
   return true;
 }
 
@@ -125,23 +147,21 @@ bool FileIo::WriteText(const string& text)
 
 bool FileIo::WriteChar(const char c)
 {
-  string text;
-  text += c;
-  Write(text);
+  Write(&c, 1);
 
   return true;
 }
 
-uint32_t FileIo::ConvertTab(string& dest, const string& src)
+uint32_t FileIo::ConvertTab(string& dest, const char* src, size_t len)
 {
-  static uint32_t s_charCnt = 0;
   uint32_t j;
   uint32_t lenToNextTab = 0;
   uint32_t charCnt = 0;
 
-  for(auto c : src) {
+  for(size_t i = 0; i < len; i++) {
+    const char c = src[i];
     if(c == '\n') {
-      s_charCnt = 0;
+      m_lineCharCnt = 0;
       m_tabSpaceCnt = 0;
       dest += c;
       charCnt++;
@@ -150,11 +170,11 @@ uint32_t FileIo::ConvertTab(string& dest, const string& src)
       m_tabSpaceCnt = 0;
     }
     else if(c == '\t') {
-      if(m_tabSpaceCnt <=  s_charCnt) {  // if((m_tabSpaceCnt + SPACES_PER_TAB_FIO) <=  s_charCnt) {
+      if(m_tabSpaceCnt <=  m_lineCharCnt) {  // if((m_tabSpaceCnt + SPACES_PER_TAB_FIO) <=  m_lineCharCnt) {
         m_tabSpaceCnt += SPACES_PER_TAB_FIO;
       }
       else {
-        lenToNextTab = SPACES_PER_TAB_FIO - (s_charCnt % SPACES_PER_TAB_FIO);      // calculate len to next tab
+        lenToNextTab = SPACES_PER_TAB_FIO - (m_lineCharCnt % SPACES_PER_TAB_FIO);      // calculate len to next tab
         if(!lenToNextTab) {
           lenToNextTab = SPACES_PER_TAB_FIO;
         }
@@ -163,14 +183,14 @@ uint32_t FileIo::ConvertTab(string& dest, const string& src)
         for(j=0; j<lenToNextTab; j++) {
           dest += ' ';
           charCnt++;
-          s_charCnt++;
+          m_lineCharCnt++;
         }
       }
     }
     else {
       dest += c;
       charCnt++;
-      s_charCnt++;
+      m_lineCharCnt++;
       m_tabSpaceCnt++;
     }
   }
@@ -178,32 +198,42 @@ uint32_t FileIo::ConvertTab(string& dest, const string& src)
   return charCnt;
 }
 
+/**
+ * @brief asctime() formatted local time without trailing newline, reentrant for concurrent generators
+*/
+static string TimeToText(time_t t)
+{
+  struct tm tmBuf;
+  char buf[64];
+#ifdef _WIN32
+  if(localtime_s(&tmBuf, &t) || asctime_s(buf, sizeof(buf), &tmBuf)) {
+    return "<unknown>";
+  }
+#else
+  if(!localtime_r(&t, &tmBuf) || !asctime_r(&tmBuf, buf)) {
+    return "<unknown>";
+  }
+#endif
+
+  string timeText = buf;
+  if(!timeText.empty() && *timeText.rbegin() == '\n') {
+    timeText.pop_back();    // erase '\n'
+  }
+
+  return timeText;
+}
+
 bool FileIo::CreateFileDescription()
 {
   const string& fileName = GetSvdFileName();
 
   time_t result = time(nullptr);
-  const char* timeAsc = asctime(std::localtime(&result));
-  string timeText { "<unknown>" };
-  if(timeAsc) {
-    timeText = timeAsc;
-
-    if(*timeText.rbegin() == '\n') {
-      timeText.pop_back();    // erase '\n'
-    }
-  }
+  const string timeText = TimeToText(result);
 
   error_code ec;
   auto ftime = filesystem::last_write_time(fileName, ec);
   time_t cftime = ToTime(ftime);
-  const char* fTimeAsc = asctime(std::localtime(&cftime));
-  string fTimeText { "<unknown>" };
-  if(fTimeAsc) {
-    fTimeText = fTimeAsc;
-    if(*fTimeText.rbegin() == '\n') {
-      fTimeText.pop_back();    // erase '\n'
-    }
-  }
+  const string fTimeText = TimeToText(cftime);
 
   string::size_type pos;
   string outFileName = GetFileName();
@@ -77,7 +77,8 @@ HeaderData::HeaderData(const FileHeaderInfo &fileHeaderInfo, const SvdOptions& o
   m_prevWasUnion(0),
   m_structUnionPos(0),
   m_maxBitWidth(32),
-  m_rootNode(nullptr)
+  m_rootNode(nullptr),
+  m_regTreeNodeCnt(0)
 {
   memset(&m_structUnionStack, 0, sizeof(StructUnion) * 32);
   memset(&m_regTreeNodes, 0, sizeof(RegTreeNode) * 32);     // 32 placeholder
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2010-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "RegDbData.h"
+#include "SvdItem.h"
+#include "SvdDevice.h"
+#include "SvdPeripheral.h"
+#include "SvdCluster.h"
+#include "SvdRegister.h"
+#include "SvdField.h"
+#include "SvdEnum.h"
+#include "SvdDimension.h"
+#include "ErrLog.h"
+#include "RteFileWriter.h"
+
+#include <algorithm>
+#include <numeric>
+#include <cstring>
+
+using namespace std;
+
+
+RegDbData::RegDbData() :
+  m_deviceName(0)
+{
+  AddString("");        // offset 0: empty string
+}
+
+RegDbData::~RegDbData()
+{
+}
+
+uint32_t RegDbData::AddString(const string &text)
+{
+  const auto it = m_stringOffsets.find(text);
+  if(it != m_stringOffsets.end()) {
+    return it->second;
+  }
+
+  const auto offset = (uint32_t)m_strings.size();
+  m_strings.append(text);
+  m_strings.push_back('\0');
+  m_stringOffsets.emplace(text, offset);
+
+  return offset;
+}
+
+bool RegDbData::AddEnums(SvdField *field, SvdRegDb::Field &dbField)
+{
+  dbField.firstEnum = SvdRegDb::NONE;
+  dbField.enumCount = 0;
+
+  const auto first = (uint32_t)m_enums.size();
+  for(const auto enumCont : field->GetEnumContainer()) {
+    if(!enumCont || !enumCont->IsValid()) {
+      continue;
+    }
+
+    for(const auto child : enumCont->GetChildren()) {
+      const auto enu = dynamic_cast<SvdEnum*>(child);
+      if(!enu || !enu->IsValid()) {
+        continue;
+      }
+
+      SvdRegDb::Enum dbEnum = {};
+      dbEnum.value        = enu->GetValue().u64;
+      dbEnum.name         = AddString(enu->GetName());
+      dbEnum.description  = AddString(enu->GetDescription());
+      dbEnum.isDefault    = enu->IsDefault() ? 1 : 0;
+      m_enums.push_back(dbEnum);
+    }
+  }
+
+  if(m_enums.size() > first) {
+    dbField.firstEnum = first;
+    dbField.enumCount = (uint32_t)m_enums.size() - first;
+  }
+
+  return true;
+}
+
+bool RegDbData::AddFields(SvdRegister *reg)
+{
+  const auto fieldCont = reg->GetFieldContainer();
+  if(!fieldCont) {
+    return true;
+  }
+
+  for(const auto child : fieldCont->GetChildren()) {
+    const auto field = dynamic_cast<SvdField*>(child);
+    if(!field || !field->IsValid()) {
+      continue;
+    }
+
+    list<SvdItem*> fields;
+    const auto dim = field->GetDimension();
+    if(dim) {
+      fields = dim->GetChildren();
+    }
+    else {
+      fields.push_back(field);
+    }
+
+    for(const auto item : fields) {
+      const auto dimField = dynamic_cast<SvdField*>(item);
+      if(!dimField || !dimField->IsValid()) {
+        continue;
+      }
+
+      SvdRegDb::Field dbField = {};
+      dbField.name        = AddString(dimField->GetName());
+      dbField.description = AddString(dimField->GetDescriptionCalculated(true));
+      dbField.bitOffset   = (uint8_t)dimField->GetOffset();
+      dbField.bitWidth    = (uint8_t)dimField->GetEffectiveBitWidth();
+      dbField.access      = (uint8_t)dimField->GetEffectiveAccess();
+      AddEnums(dimField, dbField);
+      m_fields.push_back(dbField);
+    }
+  }
+
+  return true;
+}
+
+bool RegDbData::AddRegister(SvdRegister *reg, uint32_t cluster, const string &prefix)
+{
+  const auto& name = reg->GetName();
+
+  SvdRegDb::Register dbReg = {};
+  dbReg.address     = reg->GetAbsoluteAddress();
+  dbReg.resetValue  = reg->GetEffectiveResetValue();
+  dbReg.resetMask   = reg->GetEffectiveResetMask();
+  dbReg.name        = AddString(name);
+  dbReg.fullName    = AddString(prefix + name);
+  dbReg.description = AddString(reg->GetDescriptionCalculated(true));
+  dbReg.peripheral  = (uint32_t)m_peripherals.size() - 1;
+  dbReg.cluster     = cluster;
+  dbReg.bitWidth    = (uint8_t)reg->GetEffectiveBitWidth();
+  dbReg.access      = (uint8_t)reg->GetEffectiveAccess();
+  dbReg.firstField  = (uint32_t)m_fields.size();
+
+  AddFields(reg);
+  dbReg.fieldCount  = (uint32_t)m_fields.size() - dbReg.firstField;
+  m_registers.push_back(dbReg);
+
+  return true;
+}
+
+bool RegDbData::AddCluster(SvdCluster *cluster, uint32_t parent, const string &prefix)
+{
+  const auto& name = cluster->GetName();
+
+  SvdRegDb::Cluster dbCluster = {};
+  dbCluster.address     = cluster->GetAbsoluteAddress();
+  dbCluster.name        = AddString(name);
+  dbCluster.description = AddString(cluster->GetDescriptionCalculated(true));
+  dbCluster.peripheral  = (uint32_t)m_peripherals.size() - 1;
+  dbCluster.parent      = parent;
+  m_clusters.push_back(dbCluster);
+
+  return AddRegisters(cluster, (uint32_t)m_clusters.size() - 1, prefix + name + ".");
+}
+
+bool RegDbData::AddRegisters(SvdItem *container, uint32_t cluster, const string &prefix)
+{
+  for(const auto child : container->GetChildren()) {
+    if(!child || !child->IsValid()) {
+      continue;
+    }
+
+    list<SvdItem*> items;
+    const auto dim = child->GetDimension();
+    if(dim) {
+      items = dim->GetChildren();
+    }
+    else {
+      items.push_back(child);
+    }
+
+    for(const auto item : items) {
+      if(!item || !item->IsValid()) {
+        continue;
+      }
+
+      const auto reg = dynamic_cast<SvdRegister*>(item);
+      if(reg) {
+        AddRegister(reg, cluster, prefix);
+        continue;
+      }
+
+      const auto clust = dynamic_cast<SvdCluster*>(item);
+      if(clust) {
+        AddCluster(clust, cluster, prefix);
+      }
+    }
+  }
+
+  return true;
+}
+
+bool RegDbData::AddPeripheral(SvdPeripheral *peripheral)
+{
+  const auto& name = peripheral->GetName();
+
+  SvdRegDb::Peripheral dbPeripheral = {};
+  dbPeripheral.address        = peripheral->GetAbsoluteAddress();
+  dbPeripheral.name           = AddString(name);
+  dbPeripheral.description    = AddString(peripheral->GetDescriptionCalculated(true));
+  dbPeripheral.firstCluster   = (uint32_t)m_clusters.size();
+  dbPeripheral.firstRegister  = (uint32_t)m_registers.size();
+  m_peripherals.push_back(dbPeripheral);
+
+  const auto registerCont = peripheral->GetRegisterContainer();
+  if(registerCont) {
+    AddRegisters(registerCont, SvdRegDb::NONE, name + ".");
+  }
+
+  auto& added = m_peripherals.back();
+  added.clusterCount  = (uint32_t)m_clusters.size()  - added.firstCluster;
+  added.registerCount = (uint32_t)m_registers.size() - added.firstRegister;
+
+  return true;
+}
+
+bool RegDbData::AddPeripherals(SvdDevice *device)
+{
+  const auto peripheralCont = device->GetPeripheralContainer();
+  if(!peripheralCont) {
+    return false;
+  }
+
+  for(const auto child : peripheralCont->GetChildren()) {
+    const auto peri = dynamic_cast<SvdPeripheral*>(child);
+    if(!peri || !peri->IsValid()) {
+      continue;
+    }
+
+    const auto dim = peri->GetDimension();
+    if(!dim) {
+      AddPeripheral(peri);
+      continue;
+    }
+
+    for(const auto dimChild : dim->GetChildren()) {
+      const auto dimPeri = dynamic_cast<SvdPeripheral*>(dimChild);
+      if(dimPeri && dimPeri->IsValid()) {
+        AddPeripheral(dimPeri);
+      }
+    }
+  }
+
+  return true;
+}
+
+bool RegDbData::Write(const string &fileName)
+{
+  // lookup indices: by address (SVD order for alternate registers) and by full name
+  vector<uint32_t> addressIndex(m_registers.size());
+  iota(addressIndex.begin(), addressIndex.end(), 0);
+  stable_sort(addressIndex.begin(), addressIndex.end(), [this](uint32_t a, uint32_t b) {
+    return m_registers[a].address < m_registers[b].address;
+  });
+
+  vector<uint32_t> nameIndex(m_registers.size());
+  iota(nameIndex.begin(), nameIndex.end(), 0);
+  stable_sort(nameIndex.begin(), nameIndex.end(), [this](uint32_t a, uint32_t b) {
+    return strcmp(&m_strings[m_registers[a].fullName], &m_strings[m_registers[b].fullName]) < 0;
+  });
+
+  SvdRegDb::Header header = {};
+  memcpy(header.magic, SvdRegDb::MAGIC, sizeof(header.magic));
+  header.version = SvdRegDb::VERSION;
+  header.deviceName = m_deviceName;
+
+  string image(sizeof(header), '\0');
+  auto addSection = [&image](SvdRegDb::Section& section, const void* data, size_t size, size_t count) {
+    image.resize((image.size() + SvdRegDb::ALIGN - 1) / SvdRegDb::ALIGN * SvdRegDb::ALIGN, '\0');
+    section.offset = (uint32_t)image.size();
+    section.count  = (uint32_t)count;
+    image.append(static_cast<const char*>(data), size);
+  };
+
+  addSection(header.peripherals,  m_peripherals.data(), m_peripherals.size() * sizeof(SvdRegDb::Peripheral), m_peripherals.size());
+  addSection(header.clusters,     m_clusters.data(),    m_clusters.size()    * sizeof(SvdRegDb::Cluster),    m_clusters.size());
+  addSection(header.registers,    m_registers.data(),   m_registers.size()   * sizeof(SvdRegDb::Register),   m_registers.size());
+  addSection(header.fields,       m_fields.data(),      m_fields.size()      * sizeof(SvdRegDb::Field),      m_fields.size());
+  addSection(header.enums,        m_enums.data(),       m_enums.size()       * sizeof(SvdRegDb::Enum),       m_enums.size());
+  addSection(header.addressIndex, addressIndex.data(),  addressIndex.size()  * sizeof(uint32_t),             addressIndex.size());
+  addSection(header.nameIndex,    nameIndex.data(),     nameIndex.size()     * sizeof(uint32_t),             nameIndex.size());
+  addSection(header.strings,      m_strings.data(),     m_strings.size(),                                    m_strings.size());
+
+  header.fileSize = (uint32_t)image.size();
+  memcpy(&image[0], &header, sizeof(header));
+
+  if(!RteFileWriter::WriteFile(fileName, image)) {
+    LogMsg("M130", NAME(fileName));
+    return false;
+  }
+
+  return true;
+}
+
+bool RegDbData::Create(SvdItem *item, const string &fileName)
+{
+  const auto device = dynamic_cast<SvdDevice*>(item);
+  if(!device) {
+    return false;
+  }
+
+  m_deviceName = AddString(device->GetName());
+  AddPeripherals(device);
+
+  return Write(fileName);
+}
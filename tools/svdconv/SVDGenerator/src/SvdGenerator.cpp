@@ -9,6 +9,7 @@
 #include "MemoryMap.h"
 #include "HeaderData.h"
 #include "PartitionData.h"
+#include "RegDbData.h"
 #include "SfdData.h"
 #include "SfrccInterface.h"
 #include "SvdDevice.h"
@@ -179,6 +180,20 @@ bool SvdGenerator::FieldListing(SvdDevice *device, const string &path)
   return true;
 }
 
+bool SvdGenerator::RegisterDbFile(SvdDevice *device, const string &path)
+{
+  SetOutPath(path);
+  SetDeviceName(device->GetName());
+  const auto fileName = GetRegisterDbFileName();
+
+  const auto regDbData = new RegDbData();
+  bool status = regDbData->Create(device, fileName);
+
+  delete regDbData;
+
+  return status;
+}
+
 const string SvdGenerator::GetDeviceName()
 {
   return m_deviceName;
@@ -280,3 +295,15 @@ string SvdGenerator::GetFieldListFileName()
 
   return name;
 }
+
+string SvdGenerator::GetRegisterDbFileName()
+{
+  string name = GetOutPath();
+  if(!name.empty()) {
+    name += '/';
+  }
+  name += GetDeviceName();
+  name += ".regdb";
+
+  return name;
+}
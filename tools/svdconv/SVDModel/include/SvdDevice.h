@@ -35,6 +35,7 @@ public:
   virtual SvdDevice* GetDevice() const;
   virtual const std::string& GetHeaderDefinitionsPrefix() { return m_headerDefinitionsPrefix; }
   virtual bool Construct(XMLTreeElement* xmlElement);
+  virtual bool BeginConstruct(XMLTreeElement* xmlElement);
   virtual bool Calculate();
   virtual bool CopyItem(SvdItem *from) { return false; }
   virtual bool            CheckItem();
@@ -87,11 +88,17 @@ public:
 
   SvdCExpression::RegList& GetExpressionRegistersList   () { return m_expressionRegList; }
 
+  bool                ReportUnknownTag                  () { return m_deferUnknownTagLimit || CountUnknownTag(); }
+  bool                CountUnknownTag                   () { return m_unknownTagCnt++ < 10; }   // limits "Tag unknown" messages per device
+  void                SetDeferUnknownTagLimit           (bool defer) { m_deferUnknownTagLimit = defer; }   // limit is applied when recorded messages are replayed
+
 protected:
 
 private:
   SvdCpu                           *m_cpu;
   bool                              m_hasAnnonUnions;
+  bool                              m_deferUnknownTagLimit;
+  uint32_t                          m_unknownTagCnt;
   uint32_t                          m_addressUnitBits;
   uint32_t                          m_width;
   uint64_t                          m_resetValue;
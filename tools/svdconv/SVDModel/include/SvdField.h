@@ -56,6 +56,7 @@ public:
   bool AddToMap(SvdEnum *enu,           std::map<std::string, SvdEnum*> &map);
   bool AddToMap(SvdEnumContainer *enu,  std::map<std::string, SvdEnumContainer*> &map);
   bool AddToMap(SvdEnum *enu,           std::map<uint32_t, SvdEnum*> &map);
+  bool IsSameBitWidth(SvdEnumContainer *enuCont);
 
   virtual uint64_t                  GetAddress              () { return m_offset;               }
 
@@ -13,6 +13,7 @@
 #include <string>
 #include <list>
 #include <map>
+#include <unordered_map>
 
 
 // Configuration
@@ -123,6 +124,8 @@ public:
 
 
   virtual bool                          Construct                         (XMLTreeElement* xmlElement);
+  virtual bool                          BeginConstruct                    (XMLTreeElement* xmlElement);   // item data and attributes, children follow
+  virtual bool                          EndConstruct                      ();                             // calculations and checks after all children
   virtual bool                          ProcessXmlChildren                (XMLTreeElement* xmlElement);
   virtual bool                          ProcessXmlElement                 (XMLTreeElement* xmlElement);
   virtual bool                          ProcessXmlAttributes              (XMLTreeElement* xmlElement);
@@ -136,6 +139,10 @@ public:
   void                                  Invalidate                        ();
   void                                  ClearChildren                     ();
   bool                                  CopyChilds                        (SvdItem *from, SvdItem *hook);
+  bool                                  ShareChildren                     (SvdItem *from);              // children stay owned by 'from'
+  bool                                  HasSharedChildren                 () const                { return m_sharedChildren; }
+  bool                                  MakeChildrenPrivate               ();
+  bool                                  IsInDimElement                    ();                           // dim elements are deleted when the dim is recalculated
 
   virtual bool                          Validate                          ();
   virtual bool                          CopyItem                          (SvdItem *from);
@@ -192,8 +199,10 @@ public:
   SVD_LEVEL                             GetSvdLevel                         ()                    { return m_svdLevel; }
 
   bool                                  FindChild                           (SvdItem *&item, const std::string &name);
-  bool                                  FindChild                           (const std::list<SvdItem*> childs, SvdItem *&item, const std::string &name);
+  bool                                  FindChild                           (const std::list<SvdItem*>& childs, SvdItem *&item, const std::string &name);
   bool                                  FindChildFromItem                   (SvdItem *&item, const std::string &name);
+  bool                                  IsConstructed                       ()                    { return m_constructed; }
+  bool                                  IsInConstructedScope                ();
 
   void                                  SetModified                         ();
   bool                                  IsModified                          () { return m_modified; }
@@ -230,8 +239,18 @@ public:
   bool                                  IsUsedForCExpression                ()                    { return m_bUsedForCExpression; }
 
 protected:
+  bool                                  FindChildInSymbols                  (SvdItem *&item, const std::string &name);
+  void                                  UpdateSymbols                       ();
+  static void                           AddSymbols                          (std::unordered_map<std::string, SvdItem*>& symbols, SvdItem* item);
 
 private:
+  // derive names of the children in FindChild() search order, built incrementally for children which are fully constructed
+  struct SymbolTable {
+    std::unordered_map<std::string, SvdItem*>   symbols;
+    std::list<SvdItem*>::const_iterator         lastIndexed;
+    bool                                        hasIndexed = false;
+  };
+
   static const std::string  m_svdLevelStr[];
 
   SvdItem*                  m_parent;
@@ -243,8 +262,11 @@ private:
   uint32_t                  m_dimElementIndex;
   bool                      m_modified;
   bool                      m_bUsedForCExpression;
+  bool                      m_constructed;
+  bool                      m_sharedChildren;
   SvdTypes::ProtectionType  m_protection;
   std::list<SvdItem*>       m_children;
+  SymbolTable*              m_symbols;
   std::string               m_displayName;
   std::string               m_description;
 
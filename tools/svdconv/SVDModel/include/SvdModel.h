@@ -30,6 +30,7 @@ public:
   bool                SetShowMissingEnums ()                                  { m_showMissingEnums = true;        return true; }
   bool                GetShowMissingEnums ()                                  { return m_showMissingEnums; }
   SvdDevice*          GetDevice           () const                            { return m_device; }
+  bool                SetDevice           (SvdDevice* device)                 { m_device = device;                return true; }
 
 protected:
 
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2010-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef SvdModelBuilder_H
+#define SvdModelBuilder_H
+
+#include "XMLTree.h"
+#include "XmlTreeItemBuilder.h"
+
+#include <string>
+#include <vector>
+
+class SvdModel;
+class SvdDevice;
+class SvdPeripheralContainer;
+
+/**
+ * @brief XML item builder constructing the SvdModel while the SVD file is read.
+ *        Every completed child of <device> and every completed <peripheral> is
+ *        handed to the model and released immediately, so the XML tree never
+ *        holds more than the element path currently being parsed.
+ *        With more than one job, completed <peripheral> elements are queued and
+ *        constructed in parallel. Messages are collected per peripheral and
+ *        reported in source order, so the result equals sequential construction.
+*/
+class SvdModelBuilder : public XmlTreeItemBuilder<XMLTreeElement>
+{
+public:
+  SvdModelBuilder(SvdModel* model);
+  ~SvdModelBuilder() override;
+
+  void Clear(bool bDeleteContent = false) override;
+  void PostCreateItem(bool success) override;
+
+  /**
+   * @brief set file name reported by ErrLog for model messages, empty to keep the XML file name
+   * @param logFileName file name to report
+  */
+  void SetLogFileName(const std::string& logFileName) { m_logFileName = logFileName; }
+
+  /**
+   * @brief set number of jobs constructing peripherals in parallel
+   * @param jobs number of jobs, 0 for the number of hardware threads, 1 constructs each peripheral as soon as it is read
+  */
+  void SetJobs(uint32_t jobs);
+
+  /**
+   * @brief complete model construction after parsing, also if no root element has been read
+   * @return false if constructing the device failed, equivalent to SvdModel::Construct()
+  */
+  bool Finish();
+
+protected:
+  XMLTreeElement* CreateRootItem(const std::string& tag) override;
+
+  bool BeginDevice();
+  bool ConstructDeviceElement(XMLTreeElement* xmlElement);
+  bool BeginPeripherals(XMLTreeElement* peripherals);
+  bool ConstructPeripheral(XMLTreeElement* xmlElement);
+  bool QueuePeripheral(XMLTreeElement* xmlElement);
+  bool ConstructQueuedPeripherals();
+  void ConstructModel(XMLTreeElement* xmlElement, bool valid);
+
+private:
+  SvdModel*               m_model;
+  SvdDevice*              m_device;
+  SvdPeripheralContainer* m_peripheralContainer;
+  XMLTreeElement*         m_peripherals;      // <peripherals> element the container is constructed from
+  std::string             m_logFileName;
+  std::vector<XMLTreeElement*> m_queuedPeripherals;   // <peripheral> elements read but not constructed yet
+  uint32_t                m_jobs;
+  bool                    m_success;
+  bool                    m_modelDone;        // model has been constructed from a root element
+  bool                    m_failed;           // an element failed, following elements are skipped
+};
+
+#endif // SvdModelBuilder_H
@@ -26,6 +26,8 @@ SvdDevice::SvdDevice(SvdItem* parent):
   SvdItem(parent),
   m_cpu(nullptr),
   m_hasAnnonUnions(false),
+  m_deferUnknownTagLimit(false),
+  m_unknownTagCnt(0),
   m_addressUnitBits(0),
   m_width(0),
   m_resetValue(0),
@@ -45,11 +47,20 @@ SvdDevice::~SvdDevice()
 
 bool SvdDevice::Construct(XMLTreeElement* xmlElement)
 {
+  return SvdItem::Construct(xmlElement);
+}
+
+bool SvdDevice::BeginConstruct(XMLTreeElement* xmlElement)
+{
+  if(!xmlElement) {
+    return false;
+  }
+
   // we are not interested in XML attributes for package
 	m_fileName = xmlElement->GetRootFileName();
   AddAttribute("schemaVersion", xmlElement->GetAttribute("schemaVersion"), false);
 
-  return SvdItem::Construct(xmlElement);
+  return SvdItem::BeginConstruct(xmlElement);
 }
 
 bool SvdDevice::ProcessXmlElement(XMLTreeElement* xmlElement)
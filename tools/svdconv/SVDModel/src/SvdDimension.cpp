@@ -10,6 +10,8 @@
 #include "XMLTree.h"
 #include "ErrLog.h"
 
+#include <mutex>
+
 using namespace std;
 
 map<SVD_LEVEL, list<string> > SvdDimension::m_allowedTagsDim;
@@ -60,6 +62,9 @@ SvdDimension::~SvdDimension()
 
 bool SvdDimension::InitAllowedTags()
 {
+  static mutex initMutex;     // dimensions may be constructed by concurrent jobs
+  lock_guard<mutex> lock(initMutex);
+
   if(!m_allowedTagsDim.empty()) {
     return true;
   }
@@ -107,9 +112,12 @@ bool SvdDimension::IsTagAllowed(const string& tag)
   }
 
   const auto svdLevel = parent->GetSvdLevel();
-  const auto& allowedTags = m_allowedTagsDim[svdLevel];
+  const auto it = m_allowedTagsDim.find(svdLevel);
+  if(it == m_allowedTagsDim.end()) {
+    return false;
+  }
 
-  for(const auto& t : allowedTags) {
+  for(const auto& t : it->second) {
     if(t == tag) {
       return true;
     }
@@ -430,6 +430,19 @@ bool SvdField::AddToMap(SvdEnum *enu, map<string, SvdEnum*> &map)
   return true;
 }
 
+bool SvdField::IsSameBitWidth(SvdEnumContainer *enuCont)
+{
+  const auto& childs = enuCont->GetChildren();
+  if(childs.empty()) {
+    return true;
+  }
+
+  const auto owner = childs.front()->GetParent();
+  const auto field = owner? owner->GetParent() : nullptr;
+
+  return field && field->GetBitWidth() == GetBitWidth();
+}
+
 bool SvdField::AddToMap(SvdEnumContainer *enuCont, map<string, SvdEnumContainer*> &map)
 {
   const auto name = enuCont->GetNameCalculated();
@@ -592,6 +605,11 @@ bool SvdField::CheckItem()
       continue;
     }
 
+    // shared enumerated values are checked in the field owning them, other bit width needs a private copy
+    if(cont->HasSharedChildren() && !IsSameBitWidth(cont)) {
+      cont->MakeChildrenPrivate();
+    }
+
     auto enumContainerName = cont->GetNameCalculated();
     //AddToMap(cont, enumContMap);       // 14.03.2016 Enum Container for "read" and "write" can have the same name, because they are suffixed with "_R" or "_W"
 
@@ -13,6 +13,7 @@
 #include "SvdRegister.h"
 #include "SvdPeripheral.h"
 #include "SvdCluster.h"
+#include "SvdDevice.h"
 #include "SvdAddressBlock.h"
 #include "SvdDimension.h"
 #include "SvdTypes.h"
@@ -114,7 +115,10 @@ SvdItem::SvdItem(SvdItem* parent):
   m_dimElementIndex(SvdItem::VALUE32_NOT_INIT),
   m_modified(false),
   m_bUsedForCExpression(false),
-  m_protection(SvdTypes::ProtectionType::UNDEF)
+  m_constructed(false),
+  m_sharedChildren(false),
+  m_protection(SvdTypes::ProtectionType::UNDEF),
+  m_symbols(nullptr)
 {
 }
 
@@ -168,6 +172,18 @@ void SvdItem::Invalidate()
 
 
 bool SvdItem::Construct(XMLTreeElement* xmlElement)
+{
+	if(!BeginConstruct(xmlElement)) {
+		return false;
+  }
+
+  bool success = ProcessXmlChildren(xmlElement);
+  EndConstruct();
+
+	return success;
+}
+
+bool SvdItem::BeginConstruct(XMLTreeElement* xmlElement)
 {
 	if(!xmlElement) {
 		return false;
@@ -178,14 +194,20 @@ bool SvdItem::Construct(XMLTreeElement* xmlElement)
   SetColNumber(0); //xmlElement->GetColNumber();
 	SetTag(xmlElement->GetTag());
   SetText(xmlElement->GetText());
-	bool success = ProcessXmlAttributes(xmlElement);
-  success = ProcessXmlChildren(xmlElement);
+	ProcessXmlAttributes(xmlElement);
+
+  return true;
+}
 
+bool SvdItem::EndConstruct()
+{
   CalculateDim();
   Calculate();
   CheckItem();
 
-	return success;
+  m_constructed = true;
+
+  return true;
 }
 
 bool SvdItem::ProcessXmlChildren(XMLTreeElement* xmlElement)
@@ -207,8 +229,6 @@ bool SvdItem::ProcessXmlChildren(XMLTreeElement* xmlElement)
 
 bool SvdItem::ProcessXmlElement(XMLTreeElement* xmlElement)
 {
-  static uint32_t tagCnt=0;
-
   // default inserts element's text as attribute
 	const auto& tag = xmlElement->GetTag();
 	const auto& value = xmlElement->GetText();
@@ -257,7 +277,8 @@ bool SvdItem::ProcessXmlElement(XMLTreeElement* xmlElement)
     return dimension->Construct(xmlElement);
   }
   else {    // report "Tag unknown"
-    if(tagCnt++ < 10) {
+    const auto device = GetDevice();
+    if(!device || device->ReportUnknownTag()) {
       LogMsg("M201", TAG(tag), lineNo);
     }
   }
@@ -342,20 +363,32 @@ void SvdItem::AddItem(SvdItem* item)
     return;
   }
 
+  if(m_sharedChildren) {
+    MakeChildrenPrivate();
+  }
+
   m_children.push_back(item);
 }
 
 void SvdItem::ClearChildren()
 {
+  const bool shared = m_sharedChildren;     // shared children are owned and deleted by the item they are copied from
+  m_sharedChildren = false;
+
   if(m_children.empty()) {
     return;
   }
 
-  for(auto child : m_children) {
-    delete child;
+  if(!shared) {
+    for(auto child : m_children) {
+      delete child;
+    }
   }
 
   m_children.clear();
+
+  delete m_symbols;
+  m_symbols = nullptr;
 }
 
 string SvdItem::GetHeaderTypeNameCalculated()
@@ -827,7 +860,7 @@ bool SvdItem::FindChild (SvdItem *&item, const string &name)
   return FindChild(m_children, item, name);
 }
 
-bool SvdItem::FindChild (const list<SvdItem*> childs, SvdItem *&item, const string &name)
+bool SvdItem::FindChild (const list<SvdItem*>& childs, SvdItem *&item, const string &name)
 {
   if(FindChildFromItem(item, name)) {
     return true;
@@ -837,6 +870,10 @@ bool SvdItem::FindChild (const list<SvdItem*> childs, SvdItem *&item, const stri
     return false;
   }
 
+  if(&childs == &m_children) {
+    return FindChildInSymbols(item, name);
+  }
+
   for(const auto child : childs) {
     if(!child) {
       continue;
@@ -850,6 +887,93 @@ bool SvdItem::FindChild (const list<SvdItem*> childs, SvdItem *&item, const stri
   return false;
 }
 
+bool SvdItem::FindChildInSymbols (SvdItem *&item, const string &name)
+{
+  UpdateSymbols();
+
+  const auto it = m_symbols->symbols.find(name);
+  if(it != m_symbols->symbols.end()) {
+    item = it->second;
+    return true;
+  }
+
+  // children still under construction
+  auto childIt = m_symbols->hasIndexed ? next(m_symbols->lastIndexed) : m_children.cbegin();
+  for(; childIt != m_children.cend(); childIt++) {
+    const auto child = *childIt;
+    if(!child) {
+      continue;
+    }
+
+    if(child->FindChildFromItem(item, name)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void SvdItem::UpdateSymbols()
+{
+  if(!m_symbols) {
+    m_symbols = new SymbolTable;
+  }
+
+  // children of a constructed item do not change any more, others only when constructed
+  const bool constructedScope = IsInConstructedScope();
+  auto childIt = m_symbols->hasIndexed ? next(m_symbols->lastIndexed) : m_children.cbegin();
+  for(; childIt != m_children.cend(); childIt++) {
+    const auto child = *childIt;
+    if(child) {
+      if(!constructedScope && !child->IsConstructed()) {
+        break;
+      }
+      AddSymbols(m_symbols->symbols, child);
+    }
+
+    m_symbols->lastIndexed = childIt;
+    m_symbols->hasIndexed = true;
+  }
+}
+
+void SvdItem::AddSymbols(unordered_map<string, SvdItem*>& symbols, SvdItem* item)
+{
+  // same order as FindChildFromItem(), the first item found for a name wins
+  const auto name = item->GetDeriveName();
+  if(!name.empty()) {
+    symbols.emplace(name, item);
+  }
+
+  const auto dimension = item->GetDimension();
+  if(!dimension) {
+    return;
+  }
+
+  for(const auto dimChild : dimension->GetChildren()) {
+    if(!dimChild) {
+      continue;
+    }
+
+    AddSymbols(symbols, dimChild);
+    for(const auto child : dimChild->GetChildren()) {
+      if(child) {
+        AddSymbols(symbols, child);
+      }
+    }
+  }
+}
+
+bool SvdItem::IsInConstructedScope()
+{
+  for(SvdItem* item = this; item; item = item->GetParent()) {
+    if(item->IsConstructed()) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 bool SvdItem::FindChildFromItem (SvdItem *&item, const string &name)
 {
   // search item
@@ -922,6 +1046,49 @@ bool SvdItem::CopyItem(SvdItem *from)
   return true;
 }
 
+bool SvdItem::ShareChildren(SvdItem *from)
+{
+  ClearChildren();
+
+  for(const auto child : from->GetChildren()) {
+    if(child && child->IsValid()) {
+      m_children.push_back(child);
+    }
+  }
+
+  m_sharedChildren = true;
+
+  return true;
+}
+
+bool SvdItem::IsInDimElement()
+{
+  for(auto item = this; item; item = item->GetParent()) {
+    const auto parent = item->GetParent();
+    if(parent && parent->GetSvdLevel() == L_Dim) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool SvdItem::MakeChildrenPrivate()
+{
+  if(!m_sharedChildren) {
+    return true;
+  }
+
+  // copy from the item owning the shared children, this item's source may have been a sharing copy itself
+  const auto owner = m_children.empty() ? nullptr : m_children.front()->GetParent();
+  ClearChildren();
+  if(!owner) {
+    return true;
+  }
+
+  return CopyChilds(owner, this);
+}
+
 bool SvdItem::CopyChilds(SvdItem *from, SvdItem *hook)
 {
   const auto& childs = from->GetChildren();
@@ -940,7 +1107,15 @@ bool SvdItem::CopyChilds(SvdItem *from, SvdItem *hook)
     if(lv == L_EnumeratedValues) {      // more <enumeratedValues> containers can be set!
       const auto nItem = new SvdEnumContainer(hook);
       hook->AddItem(nItem);
-      CopyChilds(copy, nItem);
+      // enumerated values of a checked field do not change any more and are shared instead of copied.
+      // Only fields constructed from the XML file own shared values: they are deleted together with
+      // the device only, while copies in dim elements are deleted and rebuilt by CalculateDim().
+      if((from->IsConstructed() && from->IsValid() && !from->IsInDimElement()) || copy->HasSharedChildren()) {
+        nItem->ShareChildren(copy);
+      }
+      else {
+        CopyChilds(copy, nItem);
+      }
       nItem->CopyItem(copy);
     }
     else if(lv == L_Fields) {
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2010-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "SvdModelBuilder.h"
+#include "SvdModel.h"
+#include "SvdDevice.h"
+#include "SvdPeripheral.h"
+#include "ErrLog.h"
+#include "JobPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+using namespace std;
+
+static constexpr size_t MAX_QUEUED_PERIPHERALS = 512;   // bounds the XML kept in memory
+
+
+
+SvdModelBuilder::SvdModelBuilder(SvdModel* model) :
+  XmlTreeItemBuilder<XMLTreeElement>(),
+  m_model(model),
+  m_device(nullptr),
+  m_peripheralContainer(nullptr),
+  m_peripherals(nullptr),
+  m_jobs(1),
+  m_success(true),
+  m_modelDone(false),
+  m_failed(false)
+{
+}
+
+SvdModelBuilder::~SvdModelBuilder()
+{
+  SvdModelBuilder::Clear(true);
+}
+
+void SvdModelBuilder::SetJobs(uint32_t jobs)
+{
+  m_jobs = static_cast<uint32_t>(JobPool::GetThreadCount(jobs));
+}
+
+void SvdModelBuilder::Clear(bool bDeleteContent)
+{
+  XmlTreeItemBuilder<XMLTreeElement>::Clear(bDeleteContent);
+
+  for(const auto xmlElement : m_queuedPeripherals) {
+    delete xmlElement;
+  }
+  m_queuedPeripherals.clear();
+
+  m_device = nullptr;                   // owned by the model
+  m_peripheralContainer = nullptr;
+  m_peripherals = nullptr;
+  m_failed = false;
+}
+
+XMLTreeElement* SvdModelBuilder::CreateRootItem(const string& tag)
+{
+  // the document is not attached to an XMLTree, it is released as soon as the model is constructed
+  XMLTreeDoc* pDoc = new XMLTreeDoc(nullptr, GetFileName());
+  pDoc->SetTag(tag);
+  return pDoc;
+}
+
+void SvdModelBuilder::PostCreateItem(bool success)
+{
+  XMLTreeElement* item = m_pCurrent != m_pParent ? m_pCurrent : nullptr;
+  XMLTreeElement* parent = m_pParent;
+  bool release = false;
+  bool queued = false;
+
+  if(item) {
+    if(!m_logFileName.empty()) {
+      ErrLog::Get()->SetFileName(m_logFileName);
+    }
+
+    if(item == m_pRoot) {
+      ConstructModel(item, success);
+    }
+    else if(success && m_pRoot->GetTag() == "device") {
+      if(parent == m_pRoot) {
+        ConstructDeviceElement(item);
+        release = true;
+      }
+      else if(item->GetTag() == "peripheral" && parent->GetTag() == "peripherals" && parent->GetParent() == m_pRoot) {
+        if(m_jobs > 1) {
+          queued = QueuePeripheral(item);
+        }
+        else {
+          ConstructPeripheral(item);
+          release = true;
+        }
+      }
+    }
+
+    if(!m_logFileName.empty()) {
+      ErrLog::Get()->SetFileName(GetFileName());
+    }
+  }
+
+  const bool rootDone = item && item == m_pRoot;
+  XmlTreeItemBuilder<XMLTreeElement>::PostCreateItem(success);
+
+  if(release) {
+    parent->RemoveChild(item, true);
+  }
+  else if(queued) {
+    parent->RemoveChild(item, false);     // owned by the queue until constructed
+    if(m_queuedPeripherals.size() >= MAX_QUEUED_PERIPHERALS) {
+      if(!m_logFileName.empty()) {
+        ErrLog::Get()->SetFileName(m_logFileName);
+      }
+      ConstructQueuedPeripherals();
+      if(!m_logFileName.empty()) {
+        ErrLog::Get()->SetFileName(GetFileName());
+      }
+    }
+  }
+  else if(rootDone) {
+    delete m_pRoot;
+    m_pRoot = nullptr;
+  }
+}
+
+bool SvdModelBuilder::BeginDevice()
+{
+  if(m_device) {
+    return true;
+  }
+
+  m_device = new SvdDevice(m_model);
+  m_model->SetDevice(m_device);
+
+  return m_device->BeginConstruct(m_pRoot);
+}
+
+bool SvdModelBuilder::ConstructDeviceElement(XMLTreeElement* xmlElement)
+{
+  if(xmlElement == m_peripherals) {
+    // all <peripheral> elements have been read, construct the queued ones
+    ConstructQueuedPeripherals();
+    m_peripheralContainer->EndConstruct();
+    m_peripheralContainer = nullptr;
+    m_peripherals = nullptr;
+    return true;
+  }
+
+  if(m_failed) {
+    return false;
+  }
+
+  BeginDevice();
+  if(!m_device->ProcessXmlElement(xmlElement)) {
+    m_failed = true;
+    return false;
+  }
+
+  return true;
+}
+
+bool SvdModelBuilder::BeginPeripherals(XMLTreeElement* peripherals)
+{
+  BeginDevice();
+
+  if(m_peripherals == peripherals) {
+    return true;
+  }
+
+  ConstructQueuedPeripherals();
+
+  auto peripheralContainer = m_device->GetPeripheralContainer();
+  if(!peripheralContainer) {
+    peripheralContainer = new SvdPeripheralContainer(m_device);
+    m_device->AddItem(peripheralContainer);
+  }
+  peripheralContainer->BeginConstruct(peripherals);
+  m_peripheralContainer = peripheralContainer;
+  m_peripherals = peripherals;
+
+  return true;
+}
+
+bool SvdModelBuilder::ConstructPeripheral(XMLTreeElement* xmlElement)
+{
+  if(m_failed) {
+    return false;
+  }
+
+  BeginPeripherals(xmlElement->GetParent());
+
+  if(!m_peripheralContainer->ProcessXmlElement(xmlElement)) {
+    m_failed = true;
+    return false;
+  }
+
+  return true;
+}
+
+bool SvdModelBuilder::QueuePeripheral(XMLTreeElement* xmlElement)
+{
+  if(m_failed) {
+    return false;
+  }
+
+  BeginPeripherals(xmlElement->GetParent());
+  m_queuedPeripherals.push_back(xmlElement);
+
+  return true;
+}
+
+static bool HasDerivedFrom(XMLTreeElement* xmlElement)
+{
+  if(xmlElement->HasAttribute("derivedFrom")) {
+    return true;
+  }
+
+  for(const auto child : xmlElement->GetChildren()) {
+    if(HasDerivedFrom(child)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool SvdModelBuilder::ConstructQueuedPeripherals()
+{
+  if(m_queuedPeripherals.empty()) {
+    return !m_failed;
+  }
+
+  // A peripheral without any derivedFrom does not look at other peripherals: it is constructed
+  // by a worker, detached from the container. Derived peripherals resolve their references in
+  // the container, they are constructed in source order once all preceding peripherals are added.
+  struct PeripheralJob {
+    XMLTreeElement* xmlElement = nullptr;
+    SvdPeripheral*  peripheral = nullptr;
+    ErrLogRecorder  errLog;
+    bool            independent = false;
+    bool            success = true;
+    bool            done = false;
+  };
+
+  vector<PeripheralJob> jobs(m_queuedPeripherals.size());
+  size_t independentCnt = 0;
+  for(size_t i = 0; i < jobs.size(); i++) {
+    auto& job = jobs[i];
+    job.xmlElement = m_queuedPeripherals[i];
+    job.independent = !HasDerivedFrom(job.xmlElement);
+    if(job.independent) {
+      independentCnt++;
+    }
+  }
+  if(independentCnt < 2) {
+    for(auto& job : jobs) {
+      job.independent = false;
+    }
+  }
+
+  mutex jobMutex;
+  condition_variable jobDone;
+  atomic<bool> cancel(false);
+  const auto peripheralContainer = m_peripheralContainer;
+
+  auto construct = [&](size_t i) {
+    auto& job = jobs[i];
+    if(!job.independent) {
+      return;
+    }
+
+    if(!cancel) {
+      job.errLog.Activate();
+      job.peripheral = new SvdPeripheral(peripheralContainer);
+      job.success = job.peripheral->Construct(job.xmlElement);
+      job.errLog.Deactivate();
+    }
+
+    lock_guard<mutex> lock(jobMutex);
+    job.done = true;
+    jobDone.notify_all();
+  };
+
+  // "Tag unknown" is limited per device, count the recorded messages in source order
+  const auto device = m_device;
+  const auto filter = [device](const PdscMsg& msg) {
+    if(msg.GetMsgNum() == "M201" && msg.GetSubstitute("TAG") != "protection") {
+      return device->CountUnknownTag();
+    }
+    return true;
+  };
+  device->SetDeferUnknownTagLimit(true);
+
+  // workers construct the independent peripherals while this thread adds them in source order
+  JobPool pool(jobs.size(), construct, independentCnt > 1 ? min<size_t>(m_jobs, independentCnt) : 0);
+
+  for(auto& job : jobs) {
+    if(job.independent) {
+      unique_lock<mutex> lock(jobMutex);
+      jobDone.wait(lock, [&job]() { return job.done; });
+    }
+
+    if(m_failed) {
+      // sequential construction stops at the failing peripheral
+      delete job.peripheral;
+      job.peripheral = nullptr;
+      continue;
+    }
+
+    if(job.independent) {
+      peripheralContainer->AddItem(job.peripheral);
+    }
+    else {
+      job.errLog.Activate();
+      job.peripheral = new SvdPeripheral(peripheralContainer);
+      peripheralContainer->AddItem(job.peripheral);
+      job.success = job.peripheral->Construct(job.xmlElement);
+      job.errLog.Deactivate();
+    }
+
+    job.errLog.Replay(ErrLog::Get(), filter);
+    if(!job.success) {
+      m_failed = true;
+      cancel = true;
+    }
+  }
+
+  pool.Wait();
+  device->SetDeferUnknownTagLimit(false);
+
+  for(const auto xmlElement : m_queuedPeripherals) {
+    delete xmlElement;
+  }
+  m_queuedPeripherals.clear();
+
+  return !m_failed;
+}
+
+void SvdModelBuilder::ConstructModel(XMLTreeElement* xmlElement, bool valid)
+{
+  m_modelDone = true;
+  ConstructQueuedPeripherals();         // <peripherals> incomplete
+
+  if(valid) {
+    m_model->SetLineNumber(xmlElement->GetLineNumber());
+    m_model->SetColNumber(0);
+    m_model->SetTag(xmlElement->GetTag());
+    m_model->SetText(xmlElement->GetText());
+
+    if(xmlElement->GetTag() == "device") {
+      BeginDevice();
+      m_device->EndConstruct();
+      if(!m_failed) {
+        m_model->AddItem(m_device);
+        m_device = nullptr;
+      }
+      else {
+        m_success = false;
+      }
+    }
+  }
+
+  if(m_device) {
+    // construction failed or XML is incomplete: discard what has been constructed so far
+    delete m_device;
+    m_device = nullptr;
+    m_model->SetDevice(nullptr);
+  }
+
+  m_model->CheckItem();
+}
+
+bool SvdModelBuilder::Finish()
+{
+  if(!m_modelDone) {
+    m_modelDone = true;
+    ConstructQueuedPeripherals();
+    m_model->CheckItem();
+  }
+
+  return m_success;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2010-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "RegDbData.h"
+#include "SvdRegDb.h"
+#include "SvdModel.h"
+#include "SvdModelBuilder.h"
+#include "SvdDevice.h"
+#include "XMLTreeSlim.h"
+
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static const string svdRegDb =
+  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+  "<device schemaVersion=\"1.3\">\n"
+  "  <name>TEST</name>\n"
+  "  <addressUnitBits>8</addressUnitBits><width>32</width><size>32</size><resetValue>0</resetValue><resetMask>0xFFFFFFFF</resetMask>\n"
+  "  <peripherals>\n"
+  "    <peripheral>\n"
+  "      <name>UART0</name><description>UART</description>\n"
+  "      <baseAddress>0x40000000</baseAddress>\n"
+  "      <addressBlock><offset>0</offset><size>0x100</size><usage>registers</usage></addressBlock>\n"
+  "      <registers>\n"
+  "        <register><name>CTRL</name><description>Control</description><addressOffset>0</addressOffset><resetValue>0x12</resetValue>\n"
+  "          <fields>\n"
+  "            <field><name>EN</name><description>Enable</description><bitOffset>0</bitOffset><bitWidth>1</bitWidth></field>\n"
+  "            <field><name>MODE</name><description>Mode</description><bitOffset>4</bitOffset><bitWidth>2</bitWidth>\n"
+  "              <enumeratedValues>\n"
+  "                <enumeratedValue><name>OFF</name><description>Off</description><value>0</value></enumeratedValue>\n"
+  "                <enumeratedValue><name>ON</name><description>On</description><value>2</value></enumeratedValue>\n"
+  "              </enumeratedValues>\n"
+  "            </field>\n"
+  "          </fields>\n"
+  "        </register>\n"
+  "        <register><name>STAT</name><description>Status</description><addressOffset>4</addressOffset><size>16</size><access>read-only</access></register>\n"
+  "        <cluster><dim>2</dim><dimIncrement>0x10</dimIncrement><name>CH%s</name><description>Channel</description><addressOffset>0x20</addressOffset>\n"
+  "          <register><name>DATA</name><description>Data</description><addressOffset>4</addressOffset></register>\n"
+  "        </cluster>\n"
+  "      </registers>\n"
+  "    </peripheral>\n"
+  "    <peripheral derivedFrom=\"UART0\">\n"
+  "      <name>UART1</name>\n"
+  "      <baseAddress>0x40001000</baseAddress>\n"
+  "    </peripheral>\n"
+  "  </peripherals>\n"
+  "</device>\n";
+
+TEST(RegDbUnitTests, CreateAndRead) {
+  SvdModel model(nullptr);
+  model.SetInputFileName("Test.svd");
+  SvdModelBuilder builder(&model);
+  XMLTreeSlim xmlTree(&builder);
+
+  EXPECT_TRUE(xmlTree.ParseString(svdRegDb));
+  EXPECT_TRUE(builder.Finish());
+  ASSERT_TRUE(model.GetDevice() != nullptr);
+
+  const string fileName = "RegDbUnitTests.regdb";
+  RegDbData regDbData;
+  ASSERT_TRUE(regDbData.Create(model.GetDevice(), fileName));
+
+  SvdRegDb::Reader regDb;
+  ASSERT_TRUE(regDb.Open(fileName));
+  EXPECT_EQ(string("TEST"), regDb.GetDeviceName());
+
+  const auto peripherals = regDb.GetPeripherals();
+  ASSERT_EQ(2, peripherals.size());
+  EXPECT_EQ(string("UART1"), regDb.GetString(peripherals[1].name));
+  EXPECT_EQ(0x40001000, peripherals[1].address);
+  EXPECT_EQ(4, regDb.GetRegisters(peripherals[1]).size());    // CTRL, STAT, CH0.DATA, CH1.DATA
+  EXPECT_EQ(4, regDb.GetClusters().size());
+
+  // lookup by address: derived peripheral and cluster array elements have absolute addresses
+  auto reg = regDb.FindRegister(0x40001034);
+  ASSERT_TRUE(reg != nullptr);
+  EXPECT_EQ(string("UART1.CH1.DATA"), regDb.GetString(reg->fullName));
+  ASSERT_TRUE(regDb.GetCluster(*reg) != nullptr);
+  EXPECT_EQ(0x40001030, regDb.GetCluster(*reg)->address);
+  EXPECT_EQ(regDb.FindRegister(0x40001034), regDb.FindRegister(0x40001037));
+
+  reg = regDb.FindRegister(0x40000005);
+  ASSERT_TRUE(reg != nullptr);
+  EXPECT_EQ(string("STAT"), regDb.GetString(reg->name));
+  EXPECT_EQ(16, reg->bitWidth);
+  EXPECT_EQ(SvdRegDb::READONLY, reg->access);
+  EXPECT_TRUE(regDb.FindRegister(0x40000006) == nullptr);
+  EXPECT_TRUE(regDb.FindRegister(0x3FFFFFFF) == nullptr);
+
+  // lookup by name, fields and enumerated values
+  reg = regDb.FindRegister("UART0.CTRL");
+  ASSERT_TRUE(reg != nullptr);
+  EXPECT_EQ(0x40000000, reg->address);
+  EXPECT_EQ(0x12, reg->resetValue);
+  EXPECT_TRUE(regDb.FindRegister("UART0.CTRL.EN") == nullptr);
+
+  const auto fields = regDb.GetFields(*reg);
+  ASSERT_EQ(2, fields.size());
+  EXPECT_EQ(string("MODE"), regDb.GetString(fields[1].name));
+  EXPECT_EQ(string("Mode"), regDb.GetString(fields[1].description));
+  EXPECT_EQ(4, fields[1].bitOffset);
+  EXPECT_EQ(2, fields[1].bitWidth);
+  EXPECT_TRUE(regDb.GetEnums(fields[0]).empty());
+
+  const auto enums = regDb.GetEnums(fields[1]);
+  ASSERT_EQ(2, enums.size());
+  EXPECT_EQ(string("ON"), regDb.GetString(enums[1].name));
+  EXPECT_EQ(2, enums[1].value);
+
+  regDb.Close();
+  remove(fileName.c_str());
+}
+
+TEST(RegDbUnitTests, InvalidImage) {
+  SvdRegDb::Reader regDb;
+  EXPECT_FALSE(regDb.Open("UnknownFile.regdb"));
+
+  vector<uint64_t> image(16, 0);
+  EXPECT_FALSE(regDb.Attach(image.data(), image.size() * sizeof(uint64_t)));
+  EXPECT_FALSE(regDb.IsOpen());
+  EXPECT_TRUE(regDb.FindRegister(0x40000000) == nullptr);
+  EXPECT_TRUE(regDb.FindRegister("UART0.CTRL") == nullptr);
+}
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2010-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "SvdModel.h"
+#include "SvdModelBuilder.h"
+#include "SvdDevice.h"
+#include "SvdDerivedFrom.h"
+#include "SvdDimension.h"
+#include "SvdEnum.h"
+#include "SvdField.h"
+#include "SvdPeripheral.h"
+#include "SvdRegister.h"
+#include "XMLTreeSlim.h"
+
+#include "gtest/gtest.h"
+#include <string>
+
+using namespace std;
+
+static const string svdDerived =
+  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+  "<device schemaVersion=\"1.3\">\n"
+  "  <name>TEST</name>\n"
+  "  <peripherals>\n"
+  "    <peripheral>\n"
+  "      <name>UART0</name>\n"
+  "      <baseAddress>0x40000000</baseAddress>\n"
+  "      <registers>\n"
+  "        <register><name>CTRL</name><addressOffset>0</addressOffset></register>\n"
+  "        <register derivedFrom=\"CTRL\"><name>STAT</name><addressOffset>4</addressOffset></register>\n"
+  "      </registers>\n"
+  "    </peripheral>\n"
+  "    <peripheral>\n"
+  "      <dim>2</dim><dimIncrement>0x1000</dimIncrement>\n"
+  "      <name>TIMER%s</name>\n"
+  "      <baseAddress>0x40001000</baseAddress>\n"
+  "    </peripheral>\n"
+  "    <peripheral derivedFrom=\"UART0\">\n"
+  "      <name>UART1</name>\n"
+  "      <baseAddress>0x40003000</baseAddress>\n"
+  "      <registers>\n"
+  "        <register derivedFrom=\"UART0.STAT\"><name>DATA</name><addressOffset>8</addressOffset></register>\n"
+  "      </registers>\n"
+  "    </peripheral>\n"
+  "    <peripheral derivedFrom=\"TIMER1\">\n"
+  "      <name>TIMER2</name>\n"
+  "      <baseAddress>0x40004000</baseAddress>\n"
+  "    </peripheral>\n"
+  "  </peripherals>\n"
+  "</device>\n";
+
+static SvdItem* GetDerivedFromItem(SvdItem* item) {
+  const auto derivedFrom = item ? item->GetDerivedFrom() : nullptr;
+  return derivedFrom ? derivedFrom->GetDerivedFromItem() : nullptr;
+}
+
+TEST(SvdItemUnitTests, FindChild_DerivedFrom) {
+  SvdModel model(nullptr);
+  model.SetInputFileName("Test.svd");
+  SvdModelBuilder builder(&model);
+  XMLTreeSlim xmlTree(&builder);
+
+  EXPECT_TRUE(xmlTree.ParseString(svdDerived));
+  EXPECT_TRUE(builder.Finish());
+
+  const auto device = model.GetDevice();
+  ASSERT_TRUE(device != nullptr);
+  const auto peripheralContainer = device->GetPeripheralContainer();
+  ASSERT_TRUE(peripheralContainer != nullptr);
+  const auto& peripherals = peripheralContainer->GetChildren();
+  ASSERT_EQ(4, peripherals.size());
+
+  auto it = peripherals.begin();
+  const auto uart0 = dynamic_cast<SvdPeripheral*>(*it++);
+  const auto timer = *it++;
+  const auto uart1 = dynamic_cast<SvdPeripheral*>(*it++);
+  const auto timer2 = *it++;
+  ASSERT_TRUE(uart0 != nullptr);
+  ASSERT_TRUE(uart1 != nullptr);
+
+  // sibling, peripheral and path lookups
+  const auto& uart0Regs = uart0->GetRegisterContainer()->GetChildren();
+  ASSERT_EQ(2, uart0Regs.size());
+  EXPECT_EQ(uart0Regs.front(), GetDerivedFromItem(uart0Regs.back()));
+  EXPECT_EQ(uart0, GetDerivedFromItem(uart1));
+
+  SvdItem* found = nullptr;
+  EXPECT_TRUE(peripheralContainer->FindChild(found, "UART1"));
+  EXPECT_EQ(uart1, found);
+  EXPECT_FALSE(peripheralContainer->FindChild(found, "UART2"));
+
+  // dim element names are resolved through the dim children
+  const auto timer1 = GetDerivedFromItem(timer2);
+  ASSERT_TRUE(timer1 != nullptr);
+  EXPECT_EQ("TIMER1", timer1->GetName());
+  EXPECT_EQ(static_cast<SvdItem*>(timer->GetDimension()), timer1->GetParent());
+
+  // registers copied from UART0 are found next to the own ones
+  SvdItem* data = nullptr;
+  ASSERT_TRUE(uart1->GetRegisterContainer()->FindChild(data, "DATA"));
+  EXPECT_TRUE(uart1->GetRegisterContainer()->FindChild(found, "CTRL"));
+  EXPECT_EQ(uart0Regs.back(), GetDerivedFromItem(data));
+}
+
+static const string svdEnums =
+  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+  "<device schemaVersion=\"1.3\">\n"
+  "  <name>TEST</name>\n"
+  "  <addressUnitBits>8</addressUnitBits><width>32</width><size>32</size>\n"
+  "  <peripherals>\n"
+  "    <peripheral>\n"
+  "      <name>UART0</name>\n"
+  "      <baseAddress>0x40000000</baseAddress>\n"
+  "      <registers>\n"
+  "        <register>\n"
+  "          <dim>2</dim><dimIncrement>4</dimIncrement>\n"
+  "          <name>CTRL[%s]</name><description>Control</description><addressOffset>0</addressOffset>\n"
+  "          <fields>\n"
+  "            <field><name>MODE</name><bitOffset>0</bitOffset><bitWidth>2</bitWidth>\n"
+  "              <enumeratedValues>\n"
+  "                <enumeratedValue><name>OFF</name><value>0</value></enumeratedValue>\n"
+  "                <enumeratedValue><name>ON</name><value>1</value></enumeratedValue>\n"
+  "              </enumeratedValues>\n"
+  "            </field>\n"
+  "            <field derivedFrom=\"MODE\"><name>MODE4</name><bitOffset>4</bitOffset><bitWidth>4</bitWidth></field>\n"
+  "          </fields>\n"
+  "        </register>\n"
+  "      </registers>\n"
+  "    </peripheral>\n"
+  "    <peripheral derivedFrom=\"UART0\">\n"
+  "      <name>UART1</name>\n"
+  "      <baseAddress>0x40001000</baseAddress>\n"
+  "    </peripheral>\n"
+  "  </peripherals>\n"
+  "</device>\n";
+
+static SvdEnumContainer* GetFieldEnumContainer(SvdItem* reg, const string& fieldName) {
+  const auto fieldContainer = reg ? dynamic_cast<SvdRegister*>(reg)->GetFieldContainer() : nullptr;
+  if(!fieldContainer) {
+    return nullptr;
+  }
+  for(const auto child : fieldContainer->GetChildren()) {
+    const auto field = dynamic_cast<SvdField*>(child);
+    if(field && field->GetName() == fieldName && !field->GetEnumContainer().empty()) {
+      return field->GetEnumContainer().front();
+    }
+  }
+  return nullptr;
+}
+
+TEST(SvdItemUnitTests, CopyChilds_SharedEnumeratedValues) {
+  SvdModel model(nullptr);
+  model.SetInputFileName("Test.svd");
+  SvdModelBuilder builder(&model);
+  XMLTreeSlim xmlTree(&builder);
+
+  EXPECT_TRUE(xmlTree.ParseString(svdEnums));
+  EXPECT_TRUE(builder.Finish());
+
+  const auto device = model.GetDevice();
+  ASSERT_TRUE(device != nullptr);
+  const auto& peripherals = device->GetPeripheralContainer()->GetChildren();
+  ASSERT_EQ(2, peripherals.size());
+  const auto uart0 = dynamic_cast<SvdPeripheral*>(peripherals.front());
+  const auto uart1 = dynamic_cast<SvdPeripheral*>(peripherals.back());
+  ASSERT_TRUE(uart0 != nullptr);
+  ASSERT_TRUE(uart1 != nullptr);
+
+  const auto ctrl = uart0->GetRegisterContainer()->GetChildren().front();
+  const auto mode = GetFieldEnumContainer(ctrl, "MODE");
+  ASSERT_TRUE(mode != nullptr);
+  EXPECT_FALSE(mode->HasSharedChildren());
+  ASSERT_EQ(2, mode->GetChildCount());
+
+  // other bit width: the derived field owns a private copy of the enumerated values
+  const auto mode4 = GetFieldEnumContainer(ctrl, "MODE4");
+  ASSERT_TRUE(mode4 != nullptr);
+  EXPECT_FALSE(mode4->HasSharedChildren());
+  ASSERT_EQ(2, mode4->GetChildCount());
+  EXPECT_EQ(mode4, mode4->GetChildren().front()->GetParent());
+
+  // dim elements and derived peripherals share the enumerated values of the checked field
+  const auto& ctrlElements = ctrl->GetDimension()->GetChildren();
+  ASSERT_EQ(2, ctrlElements.size());
+  const auto uart1Ctrl = uart1->GetRegisterContainer()->GetChildren().front();
+  for(const auto reg : { ctrlElements.front(), ctrlElements.back(), uart1Ctrl }) {
+    const auto cont = GetFieldEnumContainer(reg, "MODE");
+    ASSERT_TRUE(cont != nullptr);
+    EXPECT_TRUE(cont->HasSharedChildren());
+    EXPECT_EQ(mode->GetChildren(), cont->GetChildren());
+  }
+}
+
+TEST(SvdItemUnitTests, CopyChilds_DimElementOwnerDeleted) {
+  SvdModel model(nullptr);
+  model.SetInputFileName("Test.svd");
+  SvdModelBuilder builder(&model);
+  XMLTreeSlim xmlTree(&builder);
+
+  EXPECT_TRUE(xmlTree.ParseString(svdEnums));
+  EXPECT_TRUE(builder.Finish());
+
+  const auto device = model.GetDevice();
+  ASSERT_TRUE(device != nullptr);
+  const auto uart0 = dynamic_cast<SvdPeripheral*>(device->GetPeripheralContainer()->GetChildren().front());
+  ASSERT_TRUE(uart0 != nullptr);
+  const auto ctrl = uart0->GetRegisterContainer()->GetChildren().front();
+  const auto element = dynamic_cast<SvdRegister*>(ctrl->GetDimension()->GetChildren().front());
+  ASSERT_TRUE(element != nullptr);
+
+  // let the dim element own its enumerated values and copy its field
+  const auto elementCont = GetFieldEnumContainer(element, "MODE");
+  ASSERT_TRUE(elementCont != nullptr);
+  elementCont->MakeChildrenPrivate();
+  EXPECT_FALSE(elementCont->HasSharedChildren());
+  const auto elementField = elementCont->GetParent();
+  ASSERT_TRUE(elementField != nullptr);
+  EXPECT_TRUE(elementField->IsInDimElement());
+
+  SvdField field(nullptr);
+  field.CopyChilds(elementField, &field);
+  ASSERT_EQ(1, field.GetEnumContainer().size());
+  const auto cont = field.GetEnumContainer().front();
+  EXPECT_FALSE(cont->HasSharedChildren());
+
+  // recalculating the dim deletes the dim elements owning the source values
+  EXPECT_TRUE(ctrl->CalculateDim());
+  ASSERT_EQ(2, cont->GetChildCount());
+  EXPECT_EQ(cont, cont->GetChildren().front()->GetParent());
+  EXPECT_EQ("OFF", cont->GetChildren().front()->GetName());
+  EXPECT_EQ("ON", cont->GetChildren().back()->GetName());
+}
+
+TEST(SvdItemUnitTests, CopyChilds_SharedOwnerDeletedFirst) {
+  const auto sharer = new SvdField(nullptr);
+  {
+    SvdModel model(nullptr);
+    model.SetInputFileName("Test.svd");
+    SvdModelBuilder builder(&model);
+    XMLTreeSlim xmlTree(&builder);
+
+    EXPECT_TRUE(xmlTree.ParseString(svdEnums));
+    EXPECT_TRUE(builder.Finish());
+
+    const auto device = model.GetDevice();
+    ASSERT_TRUE(device != nullptr);
+    const auto uart0 = dynamic_cast<SvdPeripheral*>(device->GetPeripheralContainer()->GetChildren().front());
+    ASSERT_TRUE(uart0 != nullptr);
+    const auto mode = GetFieldEnumContainer(uart0->GetRegisterContainer()->GetChildren().front(), "MODE");
+    ASSERT_TRUE(mode != nullptr);
+    EXPECT_FALSE(mode->GetParent()->IsInDimElement());
+
+    sharer->CopyChilds(mode->GetParent(), sharer);
+    ASSERT_EQ(1, sharer->GetEnumContainer().size());
+    EXPECT_TRUE(sharer->GetEnumContainer().front()->HasSharedChildren());
+    EXPECT_EQ(mode->GetChildren(), sharer->GetEnumContainer().front()->GetChildren());
+  }
+
+  // the owning field has been deleted with the device, the sharer must not delete the values again
+  delete sharer;
+}
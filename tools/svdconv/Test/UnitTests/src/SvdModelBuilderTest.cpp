@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2010-2024 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include "SvdModel.h"
+#include "SvdModelBuilder.h"
+#include "SvdDevice.h"
+#include "SvdPeripheral.h"
+#include "XMLTreeSlim.h"
+#include "ErrLog.h"
+#include "ErrOutputter.h"
+
+#include "gtest/gtest.h"
+#include <list>
+#include <string>
+
+using namespace std;
+
+static const string svdDevice =
+  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+  "<device schemaVersion=\"1.3\">\n"
+  "  <name>TEST</name>\n"
+  "  <version>1.0</version>\n"
+  "  <addressUnitBits>8</addressUnitBits>\n"
+  "  <width>32</width>\n"
+  "  <peripherals>\n"
+  "    <peripheral>\n"
+  "      <name>TIMER0</name>\n"
+  "      <baseAddress>0x40000000</baseAddress>\n"
+  "    </peripheral>\n"
+  "    <peripheral derivedFrom=\"TIMER0\">\n"
+  "      <name>TIMER1</name>\n"
+  "      <baseAddress>0x40001000</baseAddress>\n"
+  "    </peripheral>\n"
+  "  </peripherals>\n"
+  "</device>\n";
+
+TEST(SvdModelBuilderUnitTests, ConstructWhileReading) {
+  SvdModel model(nullptr);
+  model.SetInputFileName("Test.svd");
+  SvdModelBuilder builder(&model);
+  XMLTreeSlim xmlTree(&builder);
+
+  EXPECT_TRUE(xmlTree.ParseString(svdDevice));
+  EXPECT_TRUE(builder.Finish());
+
+  // the XML elements have been released while reading
+  EXPECT_EQ(0, xmlTree.GetChildCount());
+
+  const auto device = model.GetDevice();
+  ASSERT_TRUE(device != nullptr);
+  EXPECT_EQ("TEST", device->GetName());
+  EXPECT_EQ(2, device->GetLineNumber());
+  EXPECT_EQ(1, model.GetChildCount());
+
+  const auto peripheralContainer = device->GetPeripheralContainer();
+  ASSERT_TRUE(peripheralContainer != nullptr);
+  const auto& peripherals = peripheralContainer->GetChildren();
+  ASSERT_EQ(2, peripherals.size());
+  EXPECT_EQ("TIMER0", peripherals.front()->GetName());
+  EXPECT_EQ(8, peripherals.front()->GetLineNumber());
+  EXPECT_EQ("TIMER1", peripherals.back()->GetName());
+  EXPECT_EQ(12, peripherals.back()->GetLineNumber());
+  EXPECT_TRUE(peripherals.back()->GetDerivedFrom() != nullptr);
+}
+
+TEST(SvdModelBuilderUnitTests, IncompleteXml) {
+  SvdModel model(nullptr);
+  model.SetInputFileName("Test.svd");
+  SvdModelBuilder builder(&model);
+  XMLTreeSlim xmlTree(&builder);
+
+  EXPECT_FALSE(xmlTree.ParseString(svdDevice.substr(0, svdDevice.find("</peripherals>"))));
+  EXPECT_TRUE(builder.Finish());
+
+  // constructed peripherals are discarded with the incomplete device
+  EXPECT_TRUE(model.GetDevice() == nullptr);
+  EXPECT_EQ(0, model.GetChildCount());
+}
+
+static string CreateSvdPeripherals(unsigned count) {
+  string svd =
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+    "<device schemaVersion=\"1.3\">\n"
+    "  <name>TEST</name>\n"
+    "  <addressUnitBits>8</addressUnitBits><width>32</width><size>32</size>\n"
+    "  <peripherals>\n";
+
+  for(unsigned i = 0; i < count; i++) {
+    const string num = to_string(i);
+    if(i % 5 == 4) {
+      // derived from the preceding peripheral, and a register derived from another peripheral
+      svd += "    <peripheral derivedFrom=\"P" + to_string(i - 1) + "\"><name>P" + num + "</name>"
+             "<baseAddress>" + to_string(0x40000000 + i * 0x1000) + "</baseAddress>"
+             "<registers><register derivedFrom=\"P0.R0\"><name>D" + num + "</name><addressOffset>0x20</addressOffset></register></registers>"
+             "</peripheral>\n";
+      continue;
+    }
+    svd += "    <peripheral><name>P" + num + "</name><unknownTag" + num + "/>"
+           "<baseAddress>" + to_string(0x40000000 + i * 0x1000) + "</baseAddress>"
+           "<addressBlock><offset>0</offset><size>0x100</size><usage>registers</usage></addressBlock>"
+           "<registers>"
+           "<register><name>R0</name><description>R0</description><addressOffset>0</addressOffset><size>32</size>"
+           "<fields><field><name>F</name><bitOffset>30</bitOffset><bitWidth>" + to_string(1 + i % 4) + "</bitWidth></field></fields></register>"
+           "<register><dim>4</dim><dimIncrement>4</dimIncrement><name>A%s</name><description>A</description><addressOffset>4</addressOffset></register>"
+           "</registers>"
+           "</peripheral>\n";
+  }
+
+  svd +=
+    "  </peripherals>\n"
+    "</device>\n";
+
+  return svd;
+}
+
+static list<string> ConstructPeripherals(const string& svd, uint32_t jobs, list<string>& names) {
+  ErrLog::Get()->ClearLogMessages();
+
+  SvdModel model(nullptr);
+  model.SetInputFileName("Test.svd");
+  SvdModelBuilder builder(&model);
+  builder.SetJobs(jobs);
+  XMLTreeSlim xmlTree(&builder);
+
+  EXPECT_TRUE(xmlTree.ParseString(svd));
+  EXPECT_TRUE(builder.Finish());
+
+  names.clear();
+  const auto device = model.GetDevice();
+  if(device && device->GetPeripheralContainer()) {
+    for(const auto peripheral : device->GetPeripheralContainer()->GetChildren()) {
+      names.push_back(peripheral->GetName() + ":" + to_string(peripheral->GetAbsoluteAddress()) + ":" + to_string(peripheral->GetChildCount()));
+    }
+  }
+
+  const auto messages = ErrLog::Get()->GetLogMessages();
+  ErrLog::Get()->ClearLogMessages();
+
+  return messages;
+}
+
+TEST(SvdModelBuilderUnitTests, ConstructInParallel) {
+  ErrOutputter* prevOutputter = ErrLog::Get()->SetOutputter(new ErrOutputter());
+  const auto svd = CreateSvdPeripherals(60);
+
+  list<string> names, parallelNames;
+  const auto messages = ConstructPeripherals(svd, 1, names);
+  ASSERT_EQ(60, names.size());
+  EXPECT_FALSE(messages.empty());
+
+  // same model and same messages in the same order, "Tag unknown" limited in source order
+  for(const uint32_t jobs : { 2, 4, 16 }) {
+    const auto parallelMessages = ConstructPeripherals(svd, jobs, parallelNames);
+    EXPECT_EQ(names, parallelNames);
+    EXPECT_EQ(messages, parallelMessages);
+  }
+
+  delete ErrLog::Get()->SetOutputter(prevOutputter);
+}
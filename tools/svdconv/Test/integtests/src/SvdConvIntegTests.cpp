@@ -157,3 +157,72 @@ TEST_F(SvdConvIntegTests, CheckSauNumRegions_Errors) {
     FAIL() << "Occurrences of M219, M364 are wrong.";
   }
 }
+
+TEST_F(SvdConvIntegTests, CheckBatch) {
+  const string& inFiles = SvdConvIntegTestEnv::localtestdata_dir + "/sauConfig/SSE300_*.svd";
+  const string testOut = SvdConvIntegTestEnv::testoutput_dir + "/batch";
+  const string summaryFile = testOut + "/summary.json";
+  const string traceFile = testOut + "/trace.json";
+
+  Arguments args("SVDConv.exe");
+  args.add({ "--batch", inFiles, "-j", "2", "--summary", summaryFile, "--trace", traceFile });
+  args.add({ "-o", testOut, "--generate=partition", "--create-folder" });
+
+  SvdConv svdConv;
+  EXPECT_EQ(2, svdConv.Check(args, args, nullptr));
+
+  // each file has its own output directory and log, errors of one file do not show up in the other
+  for(const string name : { "SSE300_errs", "SSE300_ok" }) {
+    const string logFile = testOut + "/" + name + "/" + name + ".log";
+    ASSERT_TRUE(RteFsUtils::Exists(logFile));
+    string log;
+    RteFsUtils::ReadFile(logFile, log);
+    EXPECT_EQ(name == "SSE300_errs", log.find("M364") != string::npos);
+  }
+
+  // results are summarized in input order
+  string summary;
+  ASSERT_TRUE(RteFsUtils::ReadFile(summaryFile, summary));
+  const size_t errsPos = summary.find("SSE300_errs.svd");
+  const size_t okPos = summary.find("SSE300_ok.svd");
+  ASSERT_NE(string::npos, errsPos);
+  ASSERT_NE(string::npos, okPos);
+  EXPECT_LT(errsPos, okPos);
+  EXPECT_NE(string::npos, summary.find("\"status\": \"error\""));
+  EXPECT_NE(string::npos, summary.find("\"status\": \"ok\""));
+  EXPECT_NE(string::npos, summary.find("\"name\": \"Generate CMSIS Partitionfile\""));
+
+  // phases of both files are traced
+  string trace;
+  ASSERT_TRUE(RteFsUtils::ReadFile(traceFile, trace));
+  EXPECT_EQ(0, trace.find("{\"traceEvents\":["));
+  EXPECT_NE(string::npos, trace.find("SSE300_errs.svd"));
+  EXPECT_NE(string::npos, trace.find("SSE300_ok.svd"));
+  EXPECT_NE(string::npos, trace.find("\"name\":\"Generate CMSIS Partitionfile\",\"cat\":\"svdconv\""));
+}
+
+TEST_F(SvdConvIntegTests, CheckBatchQuiet) {
+  const string& inFiles = SvdConvIntegTestEnv::localtestdata_dir + "/sauConfig/SSE300_*.svd";
+  const string testOut = SvdConvIntegTestEnv::testoutput_dir + "/batchQuiet";
+  RteFsUtils::RemoveDir(testOut);
+
+  Arguments args("SVDConv.exe");
+  args.add({ "--batch", inFiles, "-j", "2", "--quiet", "-n", "Override" });
+  args.add({ "-o", testOut, "--generate=sfd", "--create-folder" });
+
+  SvdConv svdConv;
+  EXPECT_EQ(2, svdConv.Check(args, args, nullptr));
+  ErrLog::Get()->SetQuietMode(false);
+
+  // job logs are written in quiet mode, the output file name override does not apply to batch jobs
+  for(const string name : { "SSE300_errs", "SSE300_ok" }) {
+    const string logFile = testOut + "/" + name + "/" + name + ".log";
+    ASSERT_TRUE(RteFsUtils::Exists(logFile));
+    string log;
+    RteFsUtils::ReadFile(logFile, log);
+    EXPECT_EQ(name == "SSE300_errs", log.find("M364") != string::npos);
+    EXPECT_NE(string::npos, log.find("Found"));
+    EXPECT_TRUE(RteFsUtils::Exists(testOut + "/" + name + "/" + name + ".sfd"));
+    EXPECT_FALSE(RteFsUtils::Exists(testOut + "/" + name + "/Override.sfd"));
+  }
+}